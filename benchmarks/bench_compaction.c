@@ -0,0 +1,91 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../include/array.h"
+
+/*
+ * Removes every element equal to a target (~10% of the array) with
+ * repeated array_remove (O(n) memmove each) versus one array_remove_all
+ * pass, then batch-deletes every 7th index with array_remove_indices.
+ *
+ * Usage: bench_compaction [num_elements]   (default 200000)
+ */
+
+static double _now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static DynamicArray* _fill(size_t n) {
+    DynamicArray *arr = array_create(n);
+    srand(42);
+    for (size_t i = 0; i < n; i++) {
+        array_push(arr, rand() % 10);
+    }
+    return arr;
+}
+
+int main(int argc, char **argv) {
+    size_t n = 200000;
+    if (argc > 1) {
+        n = (size_t)strtoull(argv[1], NULL, 10);
+    }
+    
+    printf("=== Compaction Benchmark (%zu elements) ===\n\n", n);
+    
+    DynamicArray *arr = _fill(n);
+    double start = _now();
+    size_t i = 0;
+    while (i < array_size(arr)) {
+        int val;
+        array_get(arr, i, &val);
+        if (val == 0) {
+            array_remove(arr, i, NULL);
+        } else {
+            i++;
+        }
+    }
+    double naive = _now() - start;
+    size_t naive_size = array_size(arr);
+    array_destroy(arr);
+    
+    arr = _fill(n);
+    start = _now();
+    array_remove_all(arr, 0);
+    double single = _now() - start;
+    size_t single_size = array_size(arr);
+    array_destroy(arr);
+    
+    printf("repeated array_remove:  %10.4f s  (size %zu)\n", naive, naive_size);
+    printf("array_remove_all:       %10.4f s  (size %zu)\n", single, single_size);
+    printf("speedup:                %10.1fx\n\n", naive / single);
+    
+    size_t k = n / 7;
+    size_t *idx = malloc(k * sizeof(size_t));
+    for (size_t j = 0; j < k; j++) {
+        idx[j] = j * 7;
+    }
+    
+    arr = _fill(n);
+    start = _now();
+    for (size_t j = k; j > 0; j--) {
+        array_remove(arr, idx[j - 1], NULL);
+    }
+    naive = _now() - start;
+    array_destroy(arr);
+    
+    arr = _fill(n);
+    start = _now();
+    array_remove_indices(arr, idx, k);
+    single = _now() - start;
+    array_destroy(arr);
+    
+    printf("remove %zu indices one by one: %10.4f s\n", k, naive);
+    printf("array_remove_indices:          %10.4f s\n", single);
+    printf("speedup:                       %10.1fx\n", naive / single);
+    
+    free(idx);
+    return 0;
+}
@@ -0,0 +1,135 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include "../include/doubly_linked_list.h"
+
+/*
+ * 1. Sequential editing: insert a new element after every existing one,
+ *    with dlist_insert_at (walks from an end each time) vs a cursor.
+ * 2. LRU touch: move a random key to the front, with dlist_find +
+ *    dlist_remove_at + dlist_push_front vs dlist_cursor_move_to_front on
+ *    a cursor kept per key (as an LRU cache's hash map would).
+ * 3. Splice then drain: splice many two-element dlist_from_array lists
+ *    into one and pop every node. Each splice adopts a slab, so the drain
+ *    must stay O(1) per pop however many slabs the list owns; the 4x run
+ *    should take about 4x as long.
+ *
+ * Usage: bench_dlist_cursor [num_elements] [num_touches]   (default 20000)
+ */
+
+static double _now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static double _splice_and_drain(size_t lists) {
+    DoublyLinkedList *all = dlist_create();
+    double start = _now();
+    for (size_t i = 0; i < lists; i++) {
+        int pair[2] = {(int)i, (int)i + 1};
+        DoublyLinkedList *part = dlist_from_array(pair, 2);
+        dlist_splice(all, part);
+        dlist_destroy(part);
+    }
+    int value;
+    volatile int64_t sink = 0;
+    while (dlist_pop_front(all, &value) == 0) {
+        sink += value;
+    }
+    double elapsed = _now() - start;
+    dlist_destroy(all);
+    return elapsed;
+}
+
+static DoublyLinkedList* _fill(size_t n) {
+    DoublyLinkedList *list = dlist_create();
+    for (size_t i = 0; i < n; i++) {
+        dlist_push_back(list, (int)i);
+    }
+    return list;
+}
+
+int main(int argc, char **argv) {
+    size_t n = 20000;
+    size_t touches = 20000;
+    if (argc > 1) {
+        n = (size_t)strtoull(argv[1], NULL, 10);
+    }
+    if (argc > 2) {
+        touches = (size_t)strtoull(argv[2], NULL, 10);
+    }
+    if (n == 0) {
+        fprintf(stderr, "num_elements must be positive\n");
+        return 1;
+    }
+    
+    printf("=== DList Cursor Benchmark (%zu elements, %zu touches) ===\n\n",
+           n, touches);
+    
+    DoublyLinkedList *list = _fill(n);
+    double start = _now();
+    for (size_t i = 0; i < n; i++) {
+        dlist_insert_at(list, 2 * i + 1, -1);
+    }
+    double indexed = _now() - start;
+    dlist_destroy(list);
+    
+    list = _fill(n);
+    start = _now();
+    DListCursor cursor;
+    dlist_cursor_front(list, &cursor);
+    while (dlist_cursor_valid(&cursor)) {
+        dlist_cursor_insert_after(&cursor, -1);
+        dlist_cursor_next(&cursor);
+        dlist_cursor_next(&cursor);
+    }
+    double cursored = _now() - start;
+    dlist_destroy(list);
+    
+    printf("insert after each, dlist_insert_at: %9.4f s\n", indexed);
+    printf("insert after each, cursor:          %9.4f s\n", cursored);
+    printf("speedup:                            %9.1fx\n\n", indexed / cursored);
+    
+    list = _fill(n);
+    srand(42);
+    start = _now();
+    for (size_t i = 0; i < touches; i++) {
+        int key = rand() % (int)n;
+        int index = dlist_find(list, key);
+        dlist_remove_at(list, (size_t)index, NULL);
+        dlist_push_front(list, key);
+    }
+    indexed = _now() - start;
+    dlist_destroy(list);
+    
+    list = _fill(n);
+    DListCursor *by_key = malloc(n * sizeof(DListCursor));
+    dlist_cursor_front(list, &cursor);
+    for (size_t i = 0; i < n; i++) {
+        by_key[i] = cursor;
+        dlist_cursor_next(&cursor);
+    }
+    srand(42);
+    start = _now();
+    for (size_t i = 0; i < touches; i++) {
+        dlist_cursor_move_to_front(&by_key[rand() % (int)n]);
+    }
+    cursored = _now() - start;
+    free(by_key);
+    dlist_destroy(list);
+    
+    printf("LRU touch, find + remove + push:    %9.4f s\n", indexed);
+    printf("LRU touch, cursor move-to-front:    %9.4f s\n", cursored);
+    printf("speedup:                            %9.1fx\n\n", indexed / cursored);
+    
+    double small = _splice_and_drain(n);
+    double large = _splice_and_drain(4 * n);
+    printf("splice + drain, %7zu lists:       %9.4f s\n", n, small);
+    printf("splice + drain, %7zu lists:       %9.4f s\n", 4 * n, large);
+    printf("growth for 4x input:                %9.1fx\n", large / small);
+    
+    return 0;
+}
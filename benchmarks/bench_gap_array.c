@@ -0,0 +1,75 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../include/array.h"
+#include "../include/gap_array.h"
+
+/*
+ * Editor-style workload: the cursor jumps to a random spot every 64 edits
+ * and the edits in between insert (and occasionally delete) there.
+ * DynamicArray pays a tail memmove per edit, GapArray only per jump.
+ *
+ * Usage: bench_gap_array [num_edits]   (default 200000)
+ */
+
+#define EDITS_PER_JUMP 64
+
+static double _now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char **argv) {
+    size_t n = 200000;
+    if (argc > 1) {
+        n = (size_t)strtoull(argv[1], NULL, 10);
+    }
+    
+    printf("=== Gap Array Benchmark (%zu edits, jump every %d) ===\n\n",
+           n, EDITS_PER_JUMP);
+    
+    DynamicArray *arr = array_create(16);
+    srand(42);
+    double start = _now();
+    size_t pos = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (i % EDITS_PER_JUMP == 0) {
+            pos = (size_t)rand() % (array_size(arr) + 1);
+        }
+        if (i % 8 == 7 && pos > 0) {
+            array_remove(arr, --pos, NULL);
+        } else {
+            array_insert(arr, pos++, (int)i);
+        }
+    }
+    double dynamic = _now() - start;
+    size_t dynamic_size = array_size(arr);
+    array_destroy(arr);
+    
+    GapArray *gap = gap_array_create(16);
+    srand(42);
+    start = _now();
+    for (size_t i = 0; i < n; i++) {
+        if (i % EDITS_PER_JUMP == 0) {
+            gap_array_move_cursor(gap, (size_t)rand() % (gap_array_size(gap) + 1));
+        }
+        if (i % 8 == 7 && gap_array_cursor(gap) > 0) {
+            gap_array_cursor_backspace(gap, NULL);
+        } else {
+            gap_array_cursor_insert(gap, (int)i);
+        }
+    }
+    double gapped = _now() - start;
+    size_t gap_size = gap_array_size(gap);
+    gap_array_destroy(gap);
+    
+    printf("DynamicArray insert/remove: %10.4f s  (size %zu)\n",
+           dynamic, dynamic_size);
+    printf("GapArray cursor edits:      %10.4f s  (size %zu)\n",
+           gapped, gap_size);
+    printf("speedup:                    %10.1fx\n", dynamic / gapped);
+    
+    return 0;
+}
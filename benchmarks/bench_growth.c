@@ -0,0 +1,111 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "../include/array.h"
+
+/*
+ * Appends N ints to a DynamicArray under each growth policy and reports
+ * wall time and peak RSS. Every configuration runs in its own child
+ * process so the peak-memory numbers do not bleed into each other.
+ *
+ * Usage: bench_growth [num_elements]   (default 64M ints = 256 MiB)
+ */
+
+typedef struct {
+    const char *name;
+    GrowthPolicy policy;
+} Config;
+
+static double _now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static void _run(const Config *cfg, size_t n) {
+    DynamicArray *arr = array_create(16);
+    if (!arr || array_set_growth_policy(arr, cfg->policy) != 0) {
+        fprintf(stderr, "setup failed for %s\n", cfg->name);
+        exit(1);
+    }
+    
+    double start = _now();
+    for (size_t i = 0; i < n; i++) {
+        if (array_push(arr, (int)i) != 0) {
+            fprintf(stderr, "push failed for %s at %zu\n", cfg->name, i);
+            exit(1);
+        }
+    }
+    double elapsed = _now() - start;
+    
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    
+    double data_mib = (double)(n * sizeof(int)) / (1024.0 * 1024.0);
+    double peak_mib = (double)usage.ru_maxrss / 1024.0;
+    printf("%-26s %9.3f s %10.1f MiB %8.2fx  (capacity %zu)\n",
+           cfg->name, elapsed, peak_mib, peak_mib / data_mib,
+           array_capacity(arr));
+    fflush(stdout);
+    
+    array_destroy(arr);
+}
+
+int main(int argc, char **argv) {
+    size_t n = (size_t)64 << 20;
+    if (argc > 1) {
+        n = (size_t)strtoull(argv[1], NULL, 10);
+    }
+    
+    GrowthPolicy heap_double = growth_policy_default();
+    heap_double.mmap_threshold = 0;
+    
+    GrowthPolicy heap_half = heap_double;
+    heap_half.kind = GROWTH_HALF;
+    
+    GrowthPolicy heap_fixed = heap_double;
+    heap_fixed.kind = GROWTH_FIXED;
+    heap_fixed.increment = (size_t)4 << 20;
+    
+    GrowthPolicy heap_paged = heap_double;
+    heap_paged.kind = GROWTH_PAGE_ALIGNED;
+    
+    GrowthPolicy mapped_double = growth_policy_default();
+    
+    GrowthPolicy mapped_half = mapped_double;
+    mapped_half.kind = GROWTH_HALF;
+    
+    const Config configs[] = {
+        { "realloc 2x", heap_double },
+        { "realloc 1.5x", heap_half },
+        { "realloc +4M elems", heap_fixed },
+        { "realloc 2x page-aligned", heap_paged },
+        { "mremap 2x (default)", mapped_double },
+        { "mremap 1.5x", mapped_half },
+    };
+    
+    printf("=== Growth Policy Benchmark (%zu ints, %.1f MiB) ===\n\n",
+           n, (double)(n * sizeof(int)) / (1024.0 * 1024.0));
+    printf("%-26s %11s %14s %9s\n", "policy", "time", "peak RSS", "peak/data");
+    fflush(stdout);
+    
+    for (size_t i = 0; i < sizeof(configs) / sizeof(configs[0]); i++) {
+        pid_t pid = fork();
+        if (pid < 0) {
+            perror("fork");
+            return 1;
+        }
+        if (pid == 0) {
+            _run(&configs[i], n);
+            _exit(0);
+        }
+        int status;
+        waitpid(pid, &status, 0);
+    }
+    
+    return 0;
+}
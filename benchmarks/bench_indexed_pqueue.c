@@ -0,0 +1,311 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <time.h>
+#include "../include/indexed_pqueue.h"
+
+/*
+ * Dijkstra on a synthetic road-like graph: a side x side grid of local
+ * streets (weights 20..100) crossed by a highway every 32 rows and
+ * columns (weights 1..5). Compares the usual lazy heap of (dist, node)
+ * pairs, which pushes a duplicate on every improvement and skips stale
+ * pops, against IndexedPQ with decrease_key. A dense random graph
+ * (degree 16) follows, where improvements and so duplicates are common.
+ *
+ * Usage: bench_indexed_pqueue [side]   (default 1000, i.e. 1e6 nodes)
+ */
+
+#define HIGHWAY_EVERY 32
+#define DENSE_DEGREE 16
+
+typedef struct {
+    size_t *offsets;
+    size_t *targets;
+    int *weights;
+    size_t nodes;
+} Graph;
+
+typedef struct {
+    int dist;
+    size_t node;
+} Entry;
+
+static double _now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static unsigned _next(unsigned *state) {
+    *state = *state * 1103515245u + 12345u;
+    return *state >> 1;
+}
+
+static int _road_weight(size_t a, size_t b, size_t side, unsigned *state) {
+    int highway = (a / side == b / side && (a / side) % HIGHWAY_EVERY == 0) ||
+                  (a % side == b % side && (a % side) % HIGHWAY_EVERY == 0);
+    if (highway) {
+        return 1 + (int)(_next(state) % 5);
+    }
+    return 20 + (int)(_next(state) % 81);
+}
+
+static int _graph_build(Graph *g, size_t side) {
+    size_t n = side * side;
+    g->nodes = n;
+    g->offsets = malloc((n + 1) * sizeof(size_t));
+    g->targets = malloc(4 * n * sizeof(size_t));
+    g->weights = malloc(4 * n * sizeof(int));
+    if (!g->offsets || !g->targets || !g->weights) {
+        return -1;
+    }
+    
+    unsigned state = 7;
+    size_t edges = 0;
+    for (size_t v = 0; v < n; v++) {
+        size_t row = v / side;
+        size_t col = v % side;
+        size_t nbr[4];
+        size_t count = 0;
+        if (row > 0) {
+            nbr[count++] = v - side;
+        }
+        if (row + 1 < side) {
+            nbr[count++] = v + side;
+        }
+        if (col > 0) {
+            nbr[count++] = v - 1;
+        }
+        if (col + 1 < side) {
+            nbr[count++] = v + 1;
+        }
+        
+        g->offsets[v] = edges;
+        for (size_t i = 0; i < count; i++) {
+            g->targets[edges] = nbr[i];
+            g->weights[edges] = _road_weight(v, nbr[i], side, &state);
+            edges++;
+        }
+    }
+    g->offsets[n] = edges;
+    
+    return 0;
+}
+
+static int _graph_build_dense(Graph *g, size_t n) {
+    g->nodes = n;
+    g->offsets = malloc((n + 1) * sizeof(size_t));
+    g->targets = malloc(DENSE_DEGREE * n * sizeof(size_t));
+    g->weights = malloc(DENSE_DEGREE * n * sizeof(int));
+    if (!g->offsets || !g->targets || !g->weights) {
+        return -1;
+    }
+    
+    unsigned state = 11;
+    for (size_t v = 0; v < n; v++) {
+        g->offsets[v] = v * DENSE_DEGREE;
+        for (size_t i = 0; i < DENSE_DEGREE; i++) {
+            g->targets[v * DENSE_DEGREE + i] = _next(&state) % n;
+            g->weights[v * DENSE_DEGREE + i] = 1 + (int)(_next(&state) % 1000);
+        }
+    }
+    g->offsets[n] = n * DENSE_DEGREE;
+    
+    return 0;
+}
+
+static void _graph_free(Graph *g) {
+    free(g->offsets);
+    free(g->targets);
+    free(g->weights);
+}
+
+// Minimal lazy binary heap of pairs, as Dijkstra is usually written
+static void _lazy_push(Entry *heap, size_t *size, Entry e) {
+    size_t i = (*size)++;
+    while (i > 0) {
+        size_t parent = (i - 1) / 2;
+        if (heap[parent].dist <= e.dist) {
+            break;
+        }
+        heap[i] = heap[parent];
+        i = parent;
+    }
+    heap[i] = e;
+}
+
+static Entry _lazy_pop(Entry *heap, size_t *size) {
+    Entry top = heap[0];
+    Entry last = heap[--(*size)];
+    size_t i = 0;
+    while (1) {
+        size_t child = 2 * i + 1;
+        if (child >= *size) {
+            break;
+        }
+        if (child + 1 < *size && heap[child + 1].dist < heap[child].dist) {
+            child++;
+        }
+        if (heap[child].dist >= last.dist) {
+            break;
+        }
+        heap[i] = heap[child];
+        i = child;
+    }
+    heap[i] = last;
+    return top;
+}
+
+static size_t _dijkstra_lazy(const Graph *g, int *dist, size_t *out_peak) {
+    Entry *heap = malloc(g->offsets[g->nodes] * sizeof(Entry) + sizeof(Entry));
+    if (!heap) {
+        return 0;
+    }
+    
+    for (size_t v = 0; v < g->nodes; v++) {
+        dist[v] = INT_MAX;
+    }
+    
+    size_t size = 0;
+    size_t peak = 0;
+    size_t pops = 0;
+    dist[0] = 0;
+    _lazy_push(heap, &size, (Entry){0, 0});
+    while (size > 0) {
+        Entry e = _lazy_pop(heap, &size);
+        pops++;
+        if (e.dist > dist[e.node]) {
+            continue;
+        }
+        for (size_t k = g->offsets[e.node]; k < g->offsets[e.node + 1]; k++) {
+            int nd = e.dist + g->weights[k];
+            size_t t = g->targets[k];
+            if (nd < dist[t]) {
+                dist[t] = nd;
+                _lazy_push(heap, &size, (Entry){nd, t});
+                if (size > peak) {
+                    peak = size;
+                }
+            }
+        }
+    }
+    
+    free(heap);
+    *out_peak = peak;
+    return pops;
+}
+
+static size_t _dijkstra_indexed(const Graph *g, int *dist, size_t *out_peak) {
+    IndexedPQ *pq = ipqueue_create(g->nodes);
+    if (!pq) {
+        return 0;
+    }
+    
+    for (size_t v = 0; v < g->nodes; v++) {
+        dist[v] = INT_MAX;
+    }
+    
+    size_t peak = 0;
+    size_t pops = 0;
+    size_t v;
+    int d;
+    dist[0] = 0;
+    ipqueue_push(pq, 0, 0);
+    while (ipqueue_pop(pq, &v, &d) == 0) {
+        pops++;
+        for (size_t k = g->offsets[v]; k < g->offsets[v + 1]; k++) {
+            int nd = d + g->weights[k];
+            size_t t = g->targets[k];
+            if (nd < dist[t]) {
+                if (dist[t] == INT_MAX) {
+                    ipqueue_push(pq, t, nd);
+                } else {
+                    ipqueue_decrease_key(pq, t, nd);
+                }
+                dist[t] = nd;
+            }
+        }
+        if (ipqueue_size(pq) > peak) {
+            peak = ipqueue_size(pq);
+        }
+    }
+    
+    ipqueue_destroy(pq);
+    *out_peak = peak;
+    return pops;
+}
+
+static int _compare(const char *title, const Graph *g) {
+    int *dist_lazy = malloc(g->nodes * sizeof(int));
+    int *dist_indexed = malloc(g->nodes * sizeof(int));
+    if (!dist_lazy || !dist_indexed) {
+        fprintf(stderr, "allocation failed\n");
+        free(dist_lazy);
+        free(dist_indexed);
+        return -1;
+    }
+    
+    printf("%s (%zu nodes, %zu arcs)\n", title, g->nodes, g->offsets[g->nodes]);
+    
+    size_t peak_lazy = 0;
+    size_t peak_indexed = 0;
+    double start = _now();
+    size_t pops_lazy = _dijkstra_lazy(g, dist_lazy, &peak_lazy);
+    double t_lazy = _now() - start;
+    
+    start = _now();
+    size_t pops_indexed = _dijkstra_indexed(g, dist_indexed, &peak_indexed);
+    double t_indexed = _now() - start;
+    
+    int same = memcmp(dist_lazy, dist_indexed, g->nodes * sizeof(int)) == 0;
+    
+    printf("  lazy pair heap     %8.3f s   pops %10zu   peak heap %9zu\n",
+           t_lazy, pops_lazy, peak_lazy);
+    printf("  IndexedPQ          %8.3f s   pops %10zu   peak heap %9zu   (%.2fx)\n",
+           t_indexed, pops_indexed, peak_indexed, t_lazy / t_indexed);
+    printf("  distances %s\n", same ? "match" : "DIFFER");
+    
+    free(dist_lazy);
+    free(dist_indexed);
+    return same ? 0 : -1;
+}
+
+int main(int argc, char **argv) {
+    size_t side = 1000;
+    if (argc > 1) {
+        side = (size_t)strtoull(argv[1], NULL, 10);
+    }
+    if (side < 2) {
+        fprintf(stderr, "side must be at least 2\n");
+        return 1;
+    }
+    
+    printf("=== Indexed Priority Queue Benchmark ===\n\n");
+    
+    int status = 0;
+    char title[64];
+    Graph g;
+    
+    if (_graph_build(&g, side) == 0) {
+        snprintf(title, sizeof(title), "Road grid %zux%zu", side, side);
+        status |= _compare(title, &g);
+    } else {
+        fprintf(stderr, "allocation failed\n");
+        status = -1;
+    }
+    _graph_free(&g);
+    
+    printf("\n");
+    if (_graph_build_dense(&g, side * side / 4) == 0) {
+        snprintf(title, sizeof(title), "Random graph, degree %d", DENSE_DEGREE);
+        status |= _compare(title, &g);
+    } else {
+        fprintf(stderr, "allocation failed\n");
+        status = -1;
+    }
+    _graph_free(&g);
+    
+    return status == 0 ? 0 : 1;
+}
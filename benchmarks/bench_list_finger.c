@@ -0,0 +1,112 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../include/singly_linked_list.h"
+#include "../include/doubly_linked_list.h"
+
+/*
+ * Indexed scans over linked lists: `for i: get(list, i)` loops that used
+ * to restart from head/tail on every call. The "restart" column replays
+ * that old walk with a container iterator so both costs show side by side.
+ *
+ * Usage: bench_list_finger [num_elements]   (default 20000)
+ */
+
+static double _now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+// Walks i steps from the front for every i, like the uncached lookup did
+static long _restart_scan(ContainerIter *template, size_t n) {
+    long sum = 0;
+    for (size_t i = 0; i < n; i++) {
+        ContainerIter it = *template;
+        const int *span = NULL;
+        for (size_t k = 0; k <= i; k++) {
+            container_iter_next(&it, &span);
+        }
+        sum += *span;
+    }
+    return sum;
+}
+
+static void _report(const char *name, double restart, double finger) {
+    printf("%-22s restart %9.4f s   finger %9.4f s   speedup %8.1fx\n",
+           name, restart, finger, restart / finger);
+}
+
+int main(int argc, char **argv) {
+    size_t n = 20000;
+    if (argc > 1) {
+        n = (size_t)strtoull(argv[1], NULL, 10);
+    }
+    if (n == 0) {
+        fprintf(stderr, "num_elements must be positive\n");
+        return 1;
+    }
+    
+    printf("=== Linked List Finger Benchmark (%zu elements) ===\n\n", n);
+    
+    SinglyLinkedList *slist = slist_create();
+    DoublyLinkedList *dlist = dlist_create();
+    for (size_t i = n; i > 0; i--) {
+        slist_push_front(slist, (int)(i - 1));
+        dlist_push_front(dlist, (int)(i - 1));
+    }
+    
+    volatile long sink = 0;
+    ContainerIter it;
+    int val;
+    
+    slist_iter_init(slist, &it);
+    double start = _now();
+    sink += _restart_scan(&it, n);
+    double t_restart = _now() - start;
+    start = _now();
+    for (size_t i = 0; i < n; i++) {
+        slist_get(slist, i, &val);
+        sink += val;
+    }
+    _report("slist ascending get", t_restart, _now() - start);
+    
+    start = _now();
+    for (size_t i = 0; i < n; i++) {
+        slist_set(slist, i, (int)i * 2);
+    }
+    _report("slist ascending set", t_restart, _now() - start);
+    
+    // The old dlist walk started from the nearer end: about half the cost
+    dlist_iter_init(dlist, &it);
+    start = _now();
+    sink += _restart_scan(&it, n / 2);
+    t_restart = (_now() - start) * 2;
+    start = _now();
+    for (size_t i = 0; i < n; i++) {
+        dlist_get(dlist, i, &val);
+        sink += val;
+    }
+    _report("dlist ascending get", t_restart, _now() - start);
+    
+    start = _now();
+    for (size_t i = n; i > 0; i--) {
+        dlist_get(dlist, i - 1, &val);
+        sink += val;
+    }
+    _report("dlist descending get", t_restart, _now() - start);
+    
+    // Nearby accesses: small forward/backward hops around a moving point
+    start = _now();
+    for (size_t i = 0; i < n; i++) {
+        size_t index = (i + (i % 7) * 3) % n;
+        dlist_set(dlist, index, (int)i);
+    }
+    _report("dlist nearby set", t_restart, _now() - start);
+    
+    (void)sink;
+    slist_destroy(slist);
+    dlist_destroy(dlist);
+    return 0;
+}
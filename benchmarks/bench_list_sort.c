@@ -0,0 +1,116 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../include/singly_linked_list.h"
+#include "../include/doubly_linked_list.h"
+
+/*
+ * Bulk construction, merge sort and export for linked lists.
+ * Node-at-a-time builds (slist_push_back/dlist_push_back) against the
+ * single-slab *_from_array, then slist_sort/dlist_sort on random data
+ * with qsort on a plain array as the reference, then *_to_array.
+ *
+ * Usage: bench_list_sort [num_elements]   (default 10M)
+ */
+
+static double _now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static int _compare_ints(const void *a, const void *b) {
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+static int _is_sorted(const int *data, size_t n) {
+    for (size_t i = 1; i < n; i++) {
+        if (data[i - 1] > data[i]) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+int main(int argc, char **argv) {
+    size_t n = 10000000;
+    if (argc > 1) {
+        n = (size_t)strtoull(argv[1], NULL, 10);
+    }
+    if (n == 0) {
+        fprintf(stderr, "num_elements must be positive\n");
+        return 1;
+    }
+    
+    printf("=== Linked List Sort Benchmark (%zu elements) ===\n\n", n);
+    
+    int *values = malloc(n * sizeof(int));
+    int *out = malloc(n * sizeof(int));
+    if (!values || !out) {
+        free(values);
+        free(out);
+        return 1;
+    }
+    srand(1);
+    for (size_t i = 0; i < n; i++) {
+        values[i] = rand();
+    }
+    
+    double start = _now();
+    SinglyLinkedList *slist = slist_create();
+    for (size_t i = 0; i < n; i++) {
+        slist_push_back(slist, values[i]);
+    }
+    double t_push = _now() - start;
+    slist_destroy(slist);
+    start = _now();
+    slist = slist_from_array(values, n);
+    double t_bulk = _now() - start;
+    printf("slist build      push %8.4f s   from_array %8.4f s   speedup %5.2fx\n",
+           t_push, t_bulk, t_push / t_bulk);
+    
+    start = _now();
+    DoublyLinkedList *dlist = dlist_create();
+    for (size_t i = 0; i < n; i++) {
+        dlist_push_back(dlist, values[i]);
+    }
+    t_push = _now() - start;
+    dlist_destroy(dlist);
+    start = _now();
+    dlist = dlist_from_array(values, n);
+    t_bulk = _now() - start;
+    printf("dlist build      push %8.4f s   from_array %8.4f s   speedup %5.2fx\n\n",
+           t_push, t_bulk, t_push / t_bulk);
+    
+    start = _now();
+    slist_sort(slist);
+    double t_slist = _now() - start;
+    start = _now();
+    dlist_sort(dlist);
+    double t_dlist = _now() - start;
+    start = _now();
+    qsort(values, n, sizeof(int), _compare_ints);
+    double t_qsort = _now() - start;
+    printf("sort             slist %7.4f s   dlist %7.4f s   qsort(array) %7.4f s\n",
+           t_slist, t_dlist, t_qsort);
+    
+    start = _now();
+    slist_to_array(slist, out);
+    double t_export = _now() - start;
+    printf("slist_to_array   %7.4f s   sorted: %s\n", t_export,
+           _is_sorted(out, n) ? "yes" : "no");
+    start = _now();
+    dlist_to_array(dlist, out);
+    t_export = _now() - start;
+    printf("dlist_to_array   %7.4f s   sorted: %s\n", t_export,
+           _is_sorted(out, n) ? "yes" : "no");
+    
+    slist_destroy(slist);
+    dlist_destroy(dlist);
+    free(values);
+    free(out);
+    return 0;
+}
@@ -0,0 +1,138 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../include/priority_queue.h"
+#include "../include/minmax_heap.h"
+#include "../include/skip_list.h"
+
+/*
+ * Max-first and double-ended priority queues on n random values:
+ *   - pqueue_create_max vs a min-heap fed negated values (the old trick)
+ *   - MinMaxHeap popping alternately from both ends vs a SkipList used
+ *     as an ordered multiset (min/max + erase)
+ *
+ * Usage: bench_minmax_heap [n]   (default 1e6)
+ */
+
+static double _now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static unsigned _next(unsigned *state) {
+    *state = *state * 1103515245u + 12345u;
+    return *state >> 1;
+}
+
+static void _bench_max(const int *values, size_t n) {
+    volatile long sink = 0;
+    int val;
+    
+    double start = _now();
+    PriorityQueue *pq = pqueue_create(n);
+    for (size_t i = 0; i < n; i++) {
+        pqueue_push(pq, -values[i]);
+    }
+    while (pqueue_pop(pq, &val) == 0) {
+        sink += -val;
+    }
+    double t_negated = _now() - start;
+    pqueue_destroy(pq);
+    
+    start = _now();
+    pq = pqueue_create_max(n);
+    for (size_t i = 0; i < n; i++) {
+        pqueue_push(pq, values[i]);
+    }
+    while (pqueue_pop(pq, &val) == 0) {
+        sink += val;
+    }
+    double t_max = _now() - start;
+    pqueue_destroy(pq);
+    
+    printf("Largest first, %zu push + pop:\n", n);
+    printf("  negated min-heap  %8.3f s\n", t_negated);
+    printf("  pqueue_create_max %8.3f s   (%.2fx)\n", t_max, t_negated / t_max);
+    (void)sink;
+}
+
+// The skip list is a map, so it stores each value with its multiplicity
+static void _bench_double_ended(const int *values, size_t n) {
+    volatile long sink = 0;
+    int val, key;
+    
+    double start = _now();
+    MinMaxHeap *heap = mmheap_create(n);
+    for (size_t i = 0; i < n; i++) {
+        mmheap_push(heap, values[i]);
+    }
+    for (size_t i = 0; !mmheap_is_empty(heap); i++) {
+        if (i & 1) {
+            mmheap_pop_max(heap, &val);
+        } else {
+            mmheap_pop_min(heap, &val);
+        }
+        sink += val;
+    }
+    double t_heap = _now() - start;
+    mmheap_destroy(heap);
+    
+    start = _now();
+    SkipList *list = skiplist_create_seeded(1);
+    for (size_t i = 0; i < n; i++) {
+        int count = 0;
+        skiplist_find(list, values[i], &count);
+        skiplist_insert(list, values[i], count + 1);
+    }
+    for (size_t i = 0; !skiplist_is_empty(list); i++) {
+        if (i & 1) {
+            skiplist_max(list, &key, &val);
+        } else {
+            skiplist_min(list, &key, &val);
+        }
+        if (val > 1) {
+            skiplist_insert(list, key, val - 1);
+        } else {
+            skiplist_erase(list, key, NULL);
+        }
+        sink += key;
+    }
+    double t_list = _now() - start;
+    skiplist_destroy(list);
+    
+    printf("\nBoth ends, %zu push + alternating pop_min/pop_max:\n", n);
+    printf("  SkipList          %8.3f s\n", t_list);
+    printf("  MinMaxHeap        %8.3f s   (%.2fx)\n", t_heap, t_list / t_heap);
+    (void)sink;
+}
+
+int main(int argc, char **argv) {
+    size_t n = 1000000;
+    if (argc > 1) {
+        n = (size_t)strtoull(argv[1], NULL, 10);
+    }
+    if (n == 0) {
+        fprintf(stderr, "n must be positive\n");
+        return 1;
+    }
+    
+    int *values = malloc(n * sizeof(int));
+    if (!values) {
+        fprintf(stderr, "allocation failed\n");
+        return 1;
+    }
+    
+    unsigned state = 42;
+    for (size_t i = 0; i < n; i++) {
+        values[i] = (int)(_next(&state) % 1000000000u);
+    }
+    
+    printf("=== Max-Heap and Min-Max Heap Benchmark ===\n\n");
+    _bench_max(values, n);
+    _bench_double_ended(values, n);
+    
+    free(values);
+    return 0;
+}
@@ -0,0 +1,142 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../include/priority_queue.h"
+#include "../include/radix_heap.h"
+#include "../include/bucket_queue.h"
+
+/*
+ * Discrete-event "hold" model: n pending events, then ops rounds of
+ * pop the earliest and schedule a new one 1..MAX_DELAY later, then drain.
+ * Event times never go backwards, which is all RadixHeap needs;
+ * BucketQueue is sized to the span the binary-heap run actually reached.
+ *
+ * Usage: bench_monotone_pqueue [n] [ops]   (default 1e6, 1e7)
+ */
+
+#define INITIAL_SPAN 1000000
+#define MAX_DELAY 1000
+
+typedef struct {
+    const char *name;
+    void *queue;
+    int (*push)(void *queue, int value);
+    int (*pop)(void *queue, int *out_value);
+} Target;
+
+static double _now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static unsigned _next(unsigned *state) {
+    *state = *state * 1103515245u + 12345u;
+    return *state >> 1;
+}
+
+static int _pq_push(void *q, int v) {
+    return pqueue_push(q, v);
+}
+
+static int _pq_pop(void *q, int *v) {
+    return pqueue_pop(q, v);
+}
+
+static int _radix_push(void *q, int v) {
+    return radixheap_push(q, v);
+}
+
+static int _radix_pop(void *q, int *v) {
+    return radixheap_pop(q, v);
+}
+
+static int _bucket_push(void *q, int v) {
+    return bqueue_push(q, v);
+}
+
+static int _bucket_pop(void *q, int *v) {
+    return bqueue_pop(q, v);
+}
+
+// Returns the latest event time scheduled, or -1 if a push failed
+static long _run(const Target *t, size_t n, size_t ops, double *seconds) {
+    unsigned state = 42;
+    long latest = 0;
+    long checksum = 0;
+    int now;
+    
+    double start = _now();
+    for (size_t i = 0; i < n; i++) {
+        int time = (int)(_next(&state) % INITIAL_SPAN);
+        if (t->push(t->queue, time) != 0) {
+            return -1;
+        }
+        latest = time > latest ? time : latest;
+    }
+    for (size_t i = 0; i < ops; i++) {
+        t->pop(t->queue, &now);
+        checksum += now;
+        int time = now + 1 + (int)(_next(&state) % MAX_DELAY);
+        if (t->push(t->queue, time) != 0) {
+            return -1;
+        }
+        latest = time > latest ? time : latest;
+    }
+    while (t->pop(t->queue, &now) == 0) {
+        checksum += now;
+    }
+    *seconds = _now() - start;
+    
+    printf("  %-16s %8.3f s   (checksum %ld)\n", t->name, *seconds, checksum);
+    return latest;
+}
+
+int main(int argc, char **argv) {
+    size_t n = 1000000;
+    size_t ops = 10000000;
+    if (argc > 1) {
+        n = (size_t)strtoull(argv[1], NULL, 10);
+    }
+    if (argc > 2) {
+        ops = (size_t)strtoull(argv[2], NULL, 10);
+    }
+    if (n == 0) {
+        fprintf(stderr, "n must be positive\n");
+        return 1;
+    }
+    
+    printf("=== Monotone Priority Queue Benchmark ===\n\n");
+    printf("Hold model: %zu pending events, %zu pop+push rounds, drain\n", n, ops);
+    
+    double t_binary, t_4ary, t_radix, t_bucket;
+    
+    PriorityQueue *pq = pqueue_create(n);
+    Target binary = {"binary heap", pq, _pq_push, _pq_pop};
+    long latest = _run(&binary, n, ops, &t_binary);
+    pqueue_destroy(pq);
+    
+    pq = pqueue_create_with_arity(n, 4);
+    Target quad = {"4-ary heap", pq, _pq_push, _pq_pop};
+    _run(&quad, n, ops, &t_4ary);
+    pqueue_destroy(pq);
+    
+    RadixHeap *radix = radixheap_create();
+    Target rh = {"RadixHeap", radix, _radix_push, _radix_pop};
+    _run(&rh, n, ops, &t_radix);
+    radixheap_destroy(radix);
+    
+    BucketQueue *bq = bqueue_create(0, (size_t)latest + 1);
+    Target bucket = {"BucketQueue", bq, _bucket_push, _bucket_pop};
+    if (!bq || _run(&bucket, n, ops, &t_bucket) < 0) {
+        printf("  BucketQueue: could not allocate %ld buckets\n", latest + 1);
+        t_bucket = 0;
+    }
+    bqueue_destroy(bq);
+    
+    printf("\n  RadixHeap %.2fx, BucketQueue %.2fx vs binary heap\n",
+           t_binary / t_radix, t_bucket > 0 ? t_binary / t_bucket : 0.0);
+    
+    return 0;
+}
@@ -0,0 +1,258 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <time.h>
+#include "../include/priority_queue.h"
+#include "../include/pairing_heap.h"
+#include "../include/indexed_pqueue.h"
+
+/*
+ * Part 1 merges per-worker queues into one: popping each PriorityQueue
+ * into the target, pqueue_merge (append + bulk heapify), and pheap_meld.
+ * Each result is then drained and checksummed against the others.
+ * Part 2 pops every item of n/4 while lowering random live keys, as an
+ * event simulation or Dijkstra would: IndexedPQ decrease_key by id
+ * against PairingHeap decrease_key by handle.
+ *
+ * Usage: bench_pairing_heap [n]   (default 2000000)
+ */
+
+#define WORKERS 16
+#define ID_BITS 20
+#define ID_MASK ((1u << ID_BITS) - 1)
+#define KEY_RANGE 2048
+#define DECREASES_PER_POP 4
+
+static double _now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static unsigned _next(unsigned *state) {
+    *state = *state * 1103515245u + 12345u;
+    return *state >> 1;
+}
+
+static long long _drain_pqueue(PriorityQueue *pq) {
+    long long sum = 0;
+    int prev = INT_MIN;
+    int val;
+    while (pqueue_pop(pq, &val) == 0) {
+        if (val < prev) {
+            return -1;
+        }
+        sum += val;
+        prev = val;
+    }
+    return sum;
+}
+
+static long long _drain_pheap(PairingHeap *heap) {
+    long long sum = 0;
+    int prev = INT_MIN;
+    int val;
+    while (pheap_pop(heap, &val) == 0) {
+        if (val < prev) {
+            return -1;
+        }
+        sum += val;
+        prev = val;
+    }
+    return sum;
+}
+
+static int _bench_merge(size_t n) {
+    size_t per = n / WORKERS;
+    PriorityQueue *pop_parts[WORKERS];
+    PriorityQueue *merge_parts[WORKERS];
+    PairingHeap *meld_parts[WORKERS];
+    
+    unsigned state = 1;
+    for (size_t w = 0; w < WORKERS; w++) {
+        pop_parts[w] = pqueue_create(per);
+        merge_parts[w] = pqueue_create(per);
+        meld_parts[w] = pheap_create();
+        if (!pop_parts[w] || !merge_parts[w] || !meld_parts[w]) {
+            fprintf(stderr, "allocation failed\n");
+            return -1;
+        }
+        for (size_t i = 0; i < per; i++) {
+            int v = (int)(_next(&state) % 1000000000u);
+            pqueue_push(pop_parts[w], v);
+            pqueue_push(merge_parts[w], v);
+            pheap_push(meld_parts[w], v);
+        }
+    }
+    
+    printf("Merging %d worker queues of %zu values\n", WORKERS, per);
+    
+    double start = _now();
+    int val;
+    for (size_t w = 1; w < WORKERS; w++) {
+        while (pqueue_pop(pop_parts[w], &val) == 0) {
+            pqueue_push(pop_parts[0], val);
+        }
+    }
+    double t_pop = _now() - start;
+    
+    start = _now();
+    for (size_t w = 1; w < WORKERS; w++) {
+        pqueue_merge(merge_parts[0], merge_parts[w]);
+    }
+    double t_merge = _now() - start;
+    
+    start = _now();
+    for (size_t w = 1; w < WORKERS; w++) {
+        pheap_meld(meld_parts[0], meld_parts[w]);
+    }
+    double t_meld = _now() - start;
+    
+    printf("  pop + push         %8.3f s\n", t_pop);
+    printf("  pqueue_merge       %8.3f s   (%.1fx)\n", t_merge, t_pop / t_merge);
+    printf("  pheap_meld         %8.6f s\n", t_meld);
+    
+    start = _now();
+    long long sum_pop = _drain_pqueue(pop_parts[0]);
+    long long sum_merge = _drain_pqueue(merge_parts[0]);
+    double t_drain_pq = (_now() - start) / 2;
+    start = _now();
+    long long sum_meld = _drain_pheap(meld_parts[0]);
+    double t_drain_ph = _now() - start;
+    
+    printf("  drain afterwards: PriorityQueue %.3f s, PairingHeap %.3f s\n",
+           t_drain_pq, t_drain_ph);
+    int same = sum_pop >= 0 && sum_pop == sum_merge && sum_pop == sum_meld;
+    printf("  results %s\n", same ? "match" : "DIFFER");
+    
+    for (size_t w = 0; w < WORKERS; w++) {
+        pqueue_destroy(pop_parts[w]);
+        pqueue_destroy(merge_parts[w]);
+    }
+    pheap_destroy(meld_parts[0]);
+    return same ? 0 : -1;
+}
+
+// Values pack key << ID_BITS | id, so a popped value names its handle
+static int _pack(int key, size_t id) {
+    return (int)(((unsigned)key << ID_BITS) | (unsigned)id);
+}
+
+static long long _rekey_indexed(size_t n, size_t rounds) {
+    IndexedPQ *pq = ipqueue_create(n);
+    unsigned char *live = malloc(n);
+    int *keys = malloc(n * sizeof(int));
+    if (!pq || !live || !keys) {
+        ipqueue_destroy(pq);
+        free(live);
+        free(keys);
+        return -1;
+    }
+    
+    unsigned state = 5;
+    for (size_t i = 0; i < n; i++) {
+        keys[i] = KEY_RANGE / 2 + (int)(_next(&state) % (KEY_RANGE / 2));
+        live[i] = 1;
+        ipqueue_push(pq, i, _pack(keys[i], i));
+    }
+    
+    long long sum = 0;
+    size_t id;
+    int prio;
+    for (size_t r = 0; r < rounds && ipqueue_pop(pq, &id, &prio) == 0; r++) {
+        live[id] = 0;
+        sum += prio;
+        for (int k = 0; k < DECREASES_PER_POP; k++) {
+            size_t t = _next(&state) % n;
+            if (live[t] && keys[t] > 0) {
+                keys[t] = (int)(_next(&state) % (unsigned)keys[t]);
+                ipqueue_decrease_key(pq, t, _pack(keys[t], t));
+            }
+        }
+    }
+    
+    ipqueue_destroy(pq);
+    free(live);
+    free(keys);
+    return sum;
+}
+
+static long long _rekey_pairing(size_t n, size_t rounds) {
+    PairingHeap *heap = pheap_create();
+    PHeapNode **handles = malloc(n * sizeof(PHeapNode*));
+    int *keys = malloc(n * sizeof(int));
+    if (!heap || !handles || !keys) {
+        pheap_destroy(heap);
+        free(handles);
+        free(keys);
+        return -1;
+    }
+    
+    unsigned state = 5;
+    for (size_t i = 0; i < n; i++) {
+        keys[i] = KEY_RANGE / 2 + (int)(_next(&state) % (KEY_RANGE / 2));
+        handles[i] = pheap_push(heap, _pack(keys[i], i));
+    }
+    
+    long long sum = 0;
+    int val;
+    for (size_t r = 0; r < rounds && pheap_pop(heap, &val) == 0; r++) {
+        handles[(unsigned)val & ID_MASK] = NULL;
+        sum += val;
+        for (int k = 0; k < DECREASES_PER_POP; k++) {
+            size_t t = _next(&state) % n;
+            if (handles[t] && keys[t] > 0) {
+                keys[t] = (int)(_next(&state) % (unsigned)keys[t]);
+                pheap_decrease_key(heap, handles[t], _pack(keys[t], t));
+            }
+        }
+    }
+    
+    pheap_destroy(heap);
+    free(handles);
+    free(keys);
+    return sum;
+}
+
+static int _bench_rekey(size_t n) {
+    printf("Decrease-key workload: %zu items, %d decreases per pop\n",
+           n, DECREASES_PER_POP);
+    
+    double start = _now();
+    long long sum_indexed = _rekey_indexed(n, n);
+    double t_indexed = _now() - start;
+    
+    start = _now();
+    long long sum_pairing = _rekey_pairing(n, n);
+    double t_pairing = _now() - start;
+    
+    printf("  IndexedPQ          %8.3f s\n", t_indexed);
+    printf("  PairingHeap        %8.3f s   (%.2fx)\n", t_pairing,
+           t_indexed / t_pairing);
+    int same = sum_indexed >= 0 && sum_indexed == sum_pairing;
+    printf("  results %s\n", same ? "match" : "DIFFER");
+    return same ? 0 : -1;
+}
+
+int main(int argc, char **argv) {
+    size_t n = 2000000;
+    if (argc > 1) {
+        n = (size_t)strtoull(argv[1], NULL, 10);
+    }
+    if (n < WORKERS) {
+        fprintf(stderr, "n must be at least %d\n", WORKERS);
+        return 1;
+    }
+    
+    printf("=== Pairing Heap Benchmark ===\n\n");
+    
+    int status = _bench_merge(n);
+    printf("\n");
+    
+    size_t items = n / 4 < ID_MASK ? n / 4 : ID_MASK;
+    status |= _bench_rekey(items);
+    
+    return status == 0 ? 0 : 1;
+}
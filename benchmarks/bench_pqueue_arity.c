@@ -0,0 +1,86 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../include/priority_queue.h"
+
+/*
+ * Binary vs 4-ary vs 8-ary PriorityQueue on the same random data:
+ * n pushes, then n pop+push pairs at steady size (the "hold" model used
+ * by event simulators), then n pops. Sizes go from 1e6 up to max_n by 10x.
+ *
+ * Usage: bench_pqueue_arity [max_n]   (default 1e7; pass 100000000 for 1e8)
+ */
+
+static double _now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static unsigned _next(unsigned *state) {
+    *state = *state * 1103515245u + 12345u;
+    return *state >> 1;
+}
+
+static void _run(size_t n, unsigned arity) {
+    PriorityQueue *pq = pqueue_create_with_arity(n, arity);
+    if (!pq) {
+        printf("  %u-ary: allocation failed\n", arity);
+        return;
+    }
+    
+    unsigned state = 42;
+    volatile long sink = 0;
+    int val;
+    
+    double start = _now();
+    for (size_t i = 0; i < n; i++) {
+        pqueue_push(pq, (int)(_next(&state) % 1000000000u));
+    }
+    double t_push = _now() - start;
+    
+    // Increments keep the new key above the popped one, as in a simulator
+    start = _now();
+    for (size_t i = 0; i < n; i++) {
+        pqueue_pop(pq, &val);
+        sink += val;
+        pqueue_push(pq, val + (int)(_next(&state) % 1000000u));
+    }
+    double t_hold = _now() - start;
+    
+    start = _now();
+    for (size_t i = 0; i < n; i++) {
+        pqueue_pop(pq, &val);
+        sink += val;
+    }
+    double t_pop = _now() - start;
+    
+    printf("  %u-ary   push %8.3f s   pop+push %8.3f s   pop %8.3f s   total %8.3f s\n",
+           arity, t_push, t_hold, t_pop, t_push + t_hold + t_pop);
+    
+    (void)sink;
+    pqueue_destroy(pq);
+}
+
+int main(int argc, char **argv) {
+    size_t max_n = 10000000;
+    if (argc > 1) {
+        max_n = (size_t)strtoull(argv[1], NULL, 10);
+    }
+    if (max_n == 0) {
+        fprintf(stderr, "max_n must be positive\n");
+        return 1;
+    }
+    
+    printf("=== Priority Queue Arity Benchmark ===\n");
+    
+    for (size_t n = 1000000; n <= max_n; n *= 10) {
+        printf("\n%zu elements:\n", n);
+        _run(n, 2);
+        _run(n, 4);
+        _run(n, 8);
+    }
+    
+    return 0;
+}
@@ -0,0 +1,148 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../include/priority_queue.h"
+
+/*
+ * Building a PriorityQueue from n random values: n single pushes vs
+ * pqueue_create_from_array (Floyd, O(n)) vs pqueue_push_n into an empty
+ * queue, on random and on descending input (every push climbs to the
+ * root). Then a batch scheduler loop: refill with a batch, drain half of
+ * it with pqueue_pop_n vs one pqueue_pop per element.
+ *
+ * Usage: bench_pqueue_bulk [n] [batch]   (default 1e7, 1000)
+ */
+
+static double _now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static unsigned _next(unsigned *state) {
+    *state = *state * 1103515245u + 12345u;
+    return *state >> 1;
+}
+
+static void _bench_build(const char *label, const int *values, size_t n) {
+    volatile int sink = 0;
+    int top;
+    
+    double start = _now();
+    PriorityQueue *pq = pqueue_create(n);
+    for (size_t i = 0; i < n; i++) {
+        pqueue_push(pq, values[i]);
+    }
+    double t_push = _now() - start;
+    pqueue_peek(pq, &top);
+    sink += top;
+    pqueue_destroy(pq);
+    
+    start = _now();
+    pq = pqueue_create_from_array(values, n);
+    double t_floyd = _now() - start;
+    pqueue_peek(pq, &top);
+    sink += top;
+    pqueue_destroy(pq);
+    
+    start = _now();
+    pq = pqueue_create(n);
+    pqueue_push_n(pq, values, n);
+    double t_push_n = _now() - start;
+    pqueue_peek(pq, &top);
+    sink += top;
+    pqueue_destroy(pq);
+    
+    printf("Build %zu %s elements:\n", n, label);
+    printf("  n x push          %8.3f s\n", t_push);
+    printf("  from_array        %8.3f s   (%.1fx)\n", t_floyd, t_push / t_floyd);
+    printf("  push_n            %8.3f s   (%.1fx)\n", t_push_n, t_push / t_push_n);
+    (void)sink;
+}
+
+static void _bench_batches(const int *values, size_t n, size_t batch) {
+    size_t rounds = n / batch;
+    int *out = malloc(batch * sizeof(int));
+    if (!out || rounds == 0) {
+        free(out);
+        return;
+    }
+    
+    volatile long sink = 0;
+    
+    PriorityQueue *pq = pqueue_create(0);
+    double start = _now();
+    for (size_t r = 0; r < rounds; r++) {
+        for (size_t i = 0; i < batch; i++) {
+            pqueue_push(pq, values[r * batch + i]);
+        }
+        for (size_t i = 0; i < batch / 2; i++) {
+            pqueue_pop(pq, &out[i]);
+        }
+        sink += out[0];
+    }
+    double t_single = _now() - start;
+    pqueue_destroy(pq);
+    
+    pq = pqueue_create(0);
+    start = _now();
+    for (size_t r = 0; r < rounds; r++) {
+        pqueue_push_n(pq, values + r * batch, batch);
+        pqueue_pop_n(pq, out, batch / 2);
+        sink += out[0];
+    }
+    double t_bulk = _now() - start;
+    pqueue_destroy(pq);
+    
+    printf("\n%zu rounds of push %zu / pop %zu:\n", rounds, batch, batch / 2);
+    printf("  push + pop        %8.3f s\n", t_single);
+    printf("  push_n + pop_n    %8.3f s   (%.1fx)\n", t_bulk, t_single / t_bulk);
+    
+    (void)sink;
+    free(out);
+}
+
+int main(int argc, char **argv) {
+    size_t n = 10000000;
+    size_t batch = 1000;
+    if (argc > 1) {
+        n = (size_t)strtoull(argv[1], NULL, 10);
+    }
+    if (argc > 2) {
+        batch = (size_t)strtoull(argv[2], NULL, 10);
+    }
+    if (n == 0 || batch == 0) {
+        fprintf(stderr, "n and batch must be positive\n");
+        return 1;
+    }
+    
+    int *values = malloc(n * sizeof(int));
+    if (!values) {
+        fprintf(stderr, "allocation failed\n");
+        return 1;
+    }
+    
+    unsigned state = 42;
+    for (size_t i = 0; i < n; i++) {
+        values[i] = (int)(_next(&state) % 1000000000u);
+    }
+    
+    printf("=== Priority Queue Bulk Benchmark ===\n\n");
+    _bench_build("random", values, n);
+    
+    int *descending = malloc(n * sizeof(int));
+    if (descending) {
+        for (size_t i = 0; i < n; i++) {
+            descending[i] = (int)(n - i);
+        }
+        printf("\n");
+        _bench_build("descending", descending, n);
+        free(descending);
+    }
+    
+    _bench_batches(values, n, batch);
+    
+    free(values);
+    return 0;
+}
@@ -0,0 +1,144 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../include/array.h"
+#include "../include/scan.h"
+
+/*
+ * Compares hand-written loops over array_get() and a single-counter
+ * histogram against the scan.h kernels on the same DynamicArray.
+ * The histogram input is skewed (70% one value) to show the effect of
+ * interleaved sub-histograms on repeated increments of one counter.
+ *
+ * Usage: bench_scan [num_elements]   (default 16M)
+ */
+
+#define BINS 256
+#define REPS 5
+
+static double _now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static void _keep_best(double *best, double t) {
+    if (t < *best) {
+        *best = t;
+    }
+}
+
+static void _report(const char *name, double loop, double kernel) {
+    printf("%-16s loop %8.4f s   kernel %8.4f s   speedup %5.1fx\n",
+           name, loop, kernel, loop / kernel);
+}
+
+int main(int argc, char **argv) {
+    size_t n = (size_t)16 << 20;
+    if (argc > 1) {
+        n = (size_t)strtoull(argv[1], NULL, 10);
+    }
+    
+    printf("=== Scan Kernel Benchmark (%zu elements, best of %d) ===\n\n",
+           n, REPS);
+    
+    DynamicArray *arr = array_create(n);
+    srand(42);
+    for (size_t i = 0; i < n; i++) {
+        array_push(arr, rand() % 10 < 7 ? 17 : rand() % BINS);
+    }
+    const int *data = array_data(arr);
+    
+    int64_t *prefix = malloc(n * sizeof(int64_t));
+    uint64_t bins[BINS];
+    volatile int64_t sink = 0;
+    double best_loop[4] = { 1e9, 1e9, 1e9, 1e9 };
+    double best_kernel[4] = { 1e9, 1e9, 1e9, 1e9 };
+    
+    for (int rep = 0; rep < REPS; rep++) {
+        double start = _now();
+        int64_t total = 0;
+        for (size_t i = 0; i < n; i++) {
+            int v;
+            array_get(arr, i, &v);
+            total += v;
+        }
+        sink = total;
+        double t = _now() - start;
+        _keep_best(&best_loop[0], t);
+        
+        start = _now();
+        sink = scan_sum(data, n);
+        t = _now() - start;
+        _keep_best(&best_kernel[0], t);
+        
+        start = _now();
+        int hi = 0;
+        for (size_t i = 0; i < n; i++) {
+            int v;
+            array_get(arr, i, &v);
+            if (i == 0 || v > hi) {
+                hi = v;
+            }
+        }
+        sink = hi;
+        t = _now() - start;
+        _keep_best(&best_loop[1], t);
+        
+        start = _now();
+        scan_max(data, n, &hi);
+        sink = hi;
+        t = _now() - start;
+        _keep_best(&best_kernel[1], t);
+        
+        start = _now();
+        int64_t running = 0;
+        for (size_t i = 0; i < n; i++) {
+            int v;
+            array_get(arr, i, &v);
+            running += v;
+            prefix[i] = running;
+        }
+        sink = prefix[n - 1];
+        t = _now() - start;
+        _keep_best(&best_loop[2], t);
+        
+        start = _now();
+        scan_prefix_sum_inclusive(data, prefix, n);
+        sink = prefix[n - 1];
+        t = _now() - start;
+        _keep_best(&best_kernel[2], t);
+        
+        memset(bins, 0, sizeof(bins));
+        start = _now();
+        for (size_t i = 0; i < n; i++) {
+            int v;
+            array_get(arr, i, &v);
+            if (v >= 0 && v < BINS) {
+                bins[v]++;
+            }
+        }
+        sink = (int64_t)bins[17];
+        t = _now() - start;
+        _keep_best(&best_loop[3], t);
+        
+        memset(bins, 0, sizeof(bins));
+        start = _now();
+        scan_histogram(data, n, 0, BINS, bins);
+        sink = (int64_t)bins[17];
+        t = _now() - start;
+        _keep_best(&best_kernel[3], t);
+    }
+    (void)sink;
+    
+    _report("sum", best_loop[0], best_kernel[0]);
+    _report("max", best_loop[1], best_kernel[1]);
+    _report("prefix sum", best_loop[2], best_kernel[2]);
+    _report("histogram", best_loop[3], best_kernel[3]);
+    
+    free(prefix);
+    array_destroy(arr);
+    return 0;
+}
@@ -0,0 +1,99 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../include/stack.h"
+#include "../include/seg_stack.h"
+
+/*
+ * Pushes N ints and then pops them, timing every batch of 4096 pushes
+ * to find the worst-case latency. Stack reallocates its buffer when
+ * full (with and without the mremap backend); SegStack links chunks.
+ *
+ * Usage: bench_seg_stack [num_elements]   (default 32M)
+ */
+
+#define BATCH 4096
+
+typedef struct {
+    double total;
+    double worst_batch;
+} Timing;
+
+static double _now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static Timing _run_stack(size_t n, GrowthPolicy policy) {
+    Timing t = { 0.0, 0.0 };
+    Stack *stack = stack_create();
+    stack_set_growth_policy(stack, policy);
+    
+    double start = _now();
+    for (size_t i = 0; i < n; i += BATCH) {
+        double batch_start = _now();
+        for (size_t k = i; k < i + BATCH && k < n; k++) {
+            stack_push(stack, (int)k);
+        }
+        double elapsed = _now() - batch_start;
+        if (elapsed > t.worst_batch) {
+            t.worst_batch = elapsed;
+        }
+    }
+    int v;
+    while (stack_pop(stack, &v) == 0) {
+    }
+    t.total = _now() - start;
+    
+    stack_destroy(stack);
+    return t;
+}
+
+static Timing _run_seg_stack(size_t n) {
+    Timing t = { 0.0, 0.0 };
+    SegStack *stack = seg_stack_create();
+    
+    double start = _now();
+    for (size_t i = 0; i < n; i += BATCH) {
+        double batch_start = _now();
+        for (size_t k = i; k < i + BATCH && k < n; k++) {
+            seg_stack_push(stack, (int)k);
+        }
+        double elapsed = _now() - batch_start;
+        if (elapsed > t.worst_batch) {
+            t.worst_batch = elapsed;
+        }
+    }
+    int v;
+    while (seg_stack_pop(stack, &v) == 0) {
+    }
+    t.total = _now() - start;
+    
+    seg_stack_destroy(stack);
+    return t;
+}
+
+static void _report(const char *name, Timing t) {
+    printf("%-22s total %8.4f s   worst %d-push batch %9.3f ms\n",
+           name, t.total, BATCH, t.worst_batch * 1e3);
+}
+
+int main(int argc, char **argv) {
+    size_t n = (size_t)32 << 20;
+    if (argc > 1) {
+        n = (size_t)strtoull(argv[1], NULL, 10);
+    }
+    
+    printf("=== Segmented Stack Benchmark (%zu elements) ===\n\n", n);
+    
+    GrowthPolicy realloc_only = growth_policy_default();
+    realloc_only.mmap_threshold = 0;
+    
+    _report("Stack (realloc)", _run_stack(n, realloc_only));
+    _report("Stack (mremap)", _run_stack(n, growth_policy_default()));
+    _report("SegStack", _run_seg_stack(n));
+    
+    return 0;
+}
@@ -0,0 +1,165 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../include/array.h"
+#include "../include/skip_list.h"
+
+/*
+ * SkipList vs a sorted DynamicArray with binary search, using the same
+ * random keys: inserts, point lookups, short range scans and erases.
+ * The array pays O(n) shifting per insert/erase; the skip list pays
+ * pointer chasing on every lookup.
+ *
+ * Usage: bench_skip_list [num_keys] [num_lookups]   (default 100k, 1M)
+ */
+
+static double _now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+// First index whose value is >= key
+static size_t _lower_bound(const DynamicArray *arr, int key) {
+    const int *data = array_data(arr);
+    size_t lo = 0;
+    size_t hi = array_size(arr);
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (data[mid] < key) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static int _sorted_insert(DynamicArray *arr, int key) {
+    size_t pos = _lower_bound(arr, key);
+    if (pos < array_size(arr) && array_data(arr)[pos] == key) {
+        return 0;
+    }
+    return array_insert(arr, pos, key);
+}
+
+static int _sorted_erase(DynamicArray *arr, int key) {
+    size_t pos = _lower_bound(arr, key);
+    if (pos == array_size(arr) || array_data(arr)[pos] != key) {
+        return -1;
+    }
+    return array_remove(arr, pos, NULL);
+}
+
+static unsigned _next_key(unsigned *state) {
+    *state = *state * 1103515245u + 12345u;
+    return *state >> 1;
+}
+
+static void _report(const char *name, double sorted, double skip) {
+    printf("%-14s sorted array %9.4f s   skip list %9.4f s   speedup %6.2fx\n",
+           name, sorted, skip, sorted / skip);
+}
+
+int main(int argc, char **argv) {
+    size_t n = 100000;
+    size_t lookups = 1000000;
+    if (argc > 1) {
+        n = (size_t)strtoull(argv[1], NULL, 10);
+    }
+    if (argc > 2) {
+        lookups = (size_t)strtoull(argv[2], NULL, 10);
+    }
+    if (n == 0) {
+        fprintf(stderr, "num_keys must be positive\n");
+        return 1;
+    }
+    
+    printf("=== Skip List Benchmark (%zu keys, %zu lookups) ===\n\n", n, lookups);
+    
+    int *keys = malloc(n * sizeof(int));
+    if (!keys) {
+        return 1;
+    }
+    unsigned state = 12345;
+    for (size_t i = 0; i < n; i++) {
+        keys[i] = (int)(_next_key(&state) % (4 * n));
+    }
+    
+    DynamicArray *arr = array_create(16);
+    SkipList *list = skiplist_create();
+    
+    double start = _now();
+    for (size_t i = 0; i < n; i++) {
+        _sorted_insert(arr, keys[i]);
+    }
+    double t_sorted = _now() - start;
+    start = _now();
+    for (size_t i = 0; i < n; i++) {
+        skiplist_insert(list, keys[i], (int)i);
+    }
+    double t_skip = _now() - start;
+    _report("insert", t_sorted, t_skip);
+    
+    volatile long sink = 0;
+    start = _now();
+    for (size_t i = 0; i < lookups; i++) {
+        int key = keys[(i * 7919) % n];
+        size_t pos = _lower_bound(arr, key);
+        sink += pos < array_size(arr) && array_data(arr)[pos] == key;
+    }
+    t_sorted = _now() - start;
+    start = _now();
+    for (size_t i = 0; i < lookups; i++) {
+        sink += skiplist_contains(list, keys[(i * 7919) % n]);
+    }
+    t_skip = _now() - start;
+    _report("lookup", t_sorted, t_skip);
+    
+    // Ranges of ~64 keys starting at random positions
+    size_t scans = lookups / 10;
+    int width = 64 * 4;
+    start = _now();
+    for (size_t i = 0; i < scans; i++) {
+        int lo = keys[(i * 104729) % n];
+        const int *data = array_data(arr);
+        for (size_t p = _lower_bound(arr, lo); p < array_size(arr) && data[p] <= lo + width; p++) {
+            sink += data[p];
+        }
+    }
+    t_sorted = _now() - start;
+    start = _now();
+    for (size_t i = 0; i < scans; i++) {
+        int lo = keys[(i * 104729) % n];
+        SkipListRange range;
+        int key;
+        skiplist_range_init(list, lo, lo + width, &range);
+        while (skiplist_range_next(&range, &key, NULL) == 0) {
+            sink += key;
+        }
+    }
+    t_skip = _now() - start;
+    _report("range scan", t_sorted, t_skip);
+    
+    start = _now();
+    for (size_t i = 0; i < n; i++) {
+        _sorted_erase(arr, keys[i]);
+    }
+    t_sorted = _now() - start;
+    start = _now();
+    for (size_t i = 0; i < n; i++) {
+        skiplist_erase(list, keys[i], NULL);
+    }
+    t_skip = _now() - start;
+    _report("erase", t_sorted, t_skip);
+    
+    printf("\nBoth empty afterwards: %s\n",
+           array_size(arr) == 0 && skiplist_size(list) == 0 ? "yes" : "no");
+    
+    (void)sink;
+    array_destroy(arr);
+    skiplist_destroy(list);
+    free(keys);
+    return 0;
+}
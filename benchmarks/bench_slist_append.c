@@ -0,0 +1,74 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../include/singly_linked_list.h"
+
+/*
+ * Append throughput for SinglyLinkedList. slist_push_back used to walk
+ * from head to the last node (O(n) per append, O(n^2) per build); with
+ * the tail pointer each append is O(1). The "walk" column replays the
+ * old cost by walking to the end with a container iterator before each
+ * append, so it only runs at small sizes.
+ *
+ * Usage: bench_slist_append [max_elements]   (default 8M)
+ */
+
+#define WALK_LIMIT 40000
+
+static double _now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static double _build(size_t n, int walk) {
+    SinglyLinkedList *list = slist_create();
+    volatile size_t sink = 0;
+    
+    double start = _now();
+    for (size_t i = 0; i < n; i++) {
+        if (walk) {
+            ContainerIter it;
+            const int *span;
+            slist_iter_init(list, &it);
+            while (container_iter_next(&it, &span) > 0) {
+                sink++;
+            }
+        }
+        slist_push_back(list, (int)i);
+    }
+    double elapsed = _now() - start;
+    
+    (void)sink;
+    slist_destroy(list);
+    return elapsed;
+}
+
+int main(int argc, char **argv) {
+    size_t max_n = 8000000;
+    if (argc > 1) {
+        max_n = (size_t)strtoull(argv[1], NULL, 10);
+    }
+    if (max_n == 0) {
+        fprintf(stderr, "max_elements must be positive\n");
+        return 1;
+    }
+    
+    printf("=== Singly Linked List Append Benchmark (up to %zu elements) ===\n\n",
+           max_n);
+    printf("%12s %14s %12s %14s\n", "elements", "walk (s)", "tail (s)", "ns/append");
+    
+    for (size_t n = 10000; n <= max_n; n *= 2) {
+        double t_tail = _build(n, 0);
+        if (n <= WALK_LIMIT) {
+            printf("%12zu %14.4f %12.4f %14.1f\n", n, _build(n, 1), t_tail,
+                   t_tail * 1e9 / (double)n);
+        } else {
+            printf("%12zu %14s %12.4f %14.1f\n", n, "-", t_tail,
+                   t_tail * 1e9 / (double)n);
+        }
+    }
+    
+    return 0;
+}
@@ -0,0 +1,115 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../include/array.h"
+#include "../include/stack.h"
+
+/*
+ * Short-lived containers holding 8 elements, created and destroyed in a
+ * loop: heap buffer (capacity above the inline limit, two allocations),
+ * inline buffer (array_create/stack_create, one allocation) and
+ * array_init/stack_init in a local (no allocation).
+ *
+ * Usage: bench_small_buffer [iterations]   (default 2000000)
+ */
+
+#define ELEMENTS 8
+
+static double _now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static long _fill_array(DynamicArray *arr) {
+    long sum = 0;
+    for (int i = 0; i < ELEMENTS; i++) {
+        array_push(arr, i);
+    }
+    for (size_t i = 0; i < array_size(arr); i++) {
+        int v;
+        array_get(arr, i, &v);
+        sum += v;
+    }
+    array_destroy(arr);
+    return sum;
+}
+
+static long _fill_stack(Stack *stack) {
+    long sum = 0;
+    for (int i = 0; i < ELEMENTS; i++) {
+        stack_push(stack, i);
+    }
+    int v;
+    while (stack_pop(stack, &v) == 0) {
+        sum += v;
+    }
+    stack_destroy(stack);
+    return sum;
+}
+
+int main(int argc, char **argv) {
+    size_t n = 2000000;
+    if (argc > 1) {
+        n = (size_t)strtoull(argv[1], NULL, 10);
+    }
+    
+    printf("=== Small-Buffer Benchmark (%zu containers of %d ints) ===\n\n",
+           n, ELEMENTS);
+    
+    volatile long sink = 0;
+    
+    double start = _now();
+    for (size_t i = 0; i < n; i++) {
+        sink += _fill_array(array_create(ARRAY_INLINE_CAPACITY + 1));
+    }
+    double heap = _now() - start;
+    
+    start = _now();
+    for (size_t i = 0; i < n; i++) {
+        sink += _fill_array(array_create(ELEMENTS));
+    }
+    double inline_buf = _now() - start;
+    
+    start = _now();
+    for (size_t i = 0; i < n; i++) {
+        DynamicArrayStorage storage;
+        sink += _fill_array(array_init(&storage, ELEMENTS));
+    }
+    double in_place = _now() - start;
+    
+    printf("DynamicArray heap buffer:   %8.4f s\n", heap);
+    printf("DynamicArray inline buffer: %8.4f s  (%.1fx)\n",
+           inline_buf, heap / inline_buf);
+    printf("DynamicArray array_init:    %8.4f s  (%.1fx)\n\n",
+           in_place, heap / in_place);
+    
+    start = _now();
+    for (size_t i = 0; i < n; i++) {
+        sink += _fill_stack(stack_create_with_capacity(STACK_INLINE_CAPACITY + 1));
+    }
+    heap = _now() - start;
+    
+    start = _now();
+    for (size_t i = 0; i < n; i++) {
+        sink += _fill_stack(stack_create_with_capacity(ELEMENTS));
+    }
+    inline_buf = _now() - start;
+    
+    start = _now();
+    for (size_t i = 0; i < n; i++) {
+        StackStorage storage;
+        sink += _fill_stack(stack_init(&storage, ELEMENTS));
+    }
+    in_place = _now() - start;
+    
+    printf("Stack heap buffer:          %8.4f s\n", heap);
+    printf("Stack inline buffer:        %8.4f s  (%.1fx)\n",
+           inline_buf, heap / inline_buf);
+    printf("Stack stack_init:           %8.4f s  (%.1fx)\n",
+           in_place, heap / in_place);
+    
+    (void)sink;
+    return 0;
+}
@@ -0,0 +1,125 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../include/stack.h"
+
+/*
+ * Iterative DFS over a random graph in CSR form (adjacency lists stored
+ * back to back). Each visited vertex pushes its whole adjacency list,
+ * either one stack_push per neighbor or a single stack_push_n.
+ *
+ * Usage: bench_stack_dfs [num_vertices] [avg_degree]   (default 1M, 16)
+ */
+
+#define REPS 3
+
+typedef struct {
+    size_t num_vertices;
+    size_t *offsets;   // num_vertices + 1 entries into neighbors
+    int *neighbors;
+} Graph;
+
+static double _now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static Graph _make_graph(size_t n, size_t degree) {
+    Graph g;
+    g.num_vertices = n;
+    g.offsets = malloc((n + 1) * sizeof(size_t));
+    g.neighbors = malloc(n * degree * sizeof(int));
+    
+    srand(42);
+    size_t edges = 0;
+    for (size_t v = 0; v < n; v++) {
+        g.offsets[v] = edges;
+        size_t d = 1 + (size_t)rand() % (2 * degree - 1);
+        if (edges + d > n * degree) {
+            d = n * degree - edges;
+        }
+        for (size_t k = 0; k < d; k++) {
+            g.neighbors[edges++] = rand() % (int)n;
+        }
+    }
+    g.offsets[n] = edges;
+    return g;
+}
+
+static size_t _dfs(const Graph *g, Stack *stack, unsigned char *visited,
+                   int bulk) {
+    memset(visited, 0, g->num_vertices);
+    stack_clear(stack);
+    stack_push(stack, 0);
+    
+    size_t count = 0;
+    int v;
+    while (stack_pop(stack, &v) == 0) {
+        if (visited[v]) {
+            continue;
+        }
+        visited[v] = 1;
+        count++;
+        
+        const int *adj = &g->neighbors[g->offsets[v]];
+        size_t degree = g->offsets[v + 1] - g->offsets[v];
+        if (bulk) {
+            stack_push_n(stack, adj, degree);
+        } else {
+            for (size_t k = 0; k < degree; k++) {
+                stack_push(stack, adj[k]);
+            }
+        }
+    }
+    return count;
+}
+
+int main(int argc, char **argv) {
+    size_t n = 1000000;
+    size_t degree = 16;
+    if (argc > 1) {
+        n = (size_t)strtoull(argv[1], NULL, 10);
+    }
+    if (argc > 2) {
+        degree = (size_t)strtoull(argv[2], NULL, 10);
+    }
+    if (n == 0 || degree == 0) {
+        fprintf(stderr, "num_vertices and avg_degree must be positive\n");
+        return 1;
+    }
+    
+    printf("=== Stack DFS Benchmark (%zu vertices, avg degree %zu) ===\n\n",
+           n, degree);
+    
+    Graph g = _make_graph(n, degree);
+    unsigned char *visited = malloc(n);
+    Stack *stack = stack_create();
+    
+    double best[2] = { 1e9, 1e9 };
+    size_t reached[2] = { 0, 0 };
+    for (int rep = 0; rep < REPS; rep++) {
+        for (int bulk = 0; bulk < 2; bulk++) {
+            double start = _now();
+            reached[bulk] = _dfs(&g, stack, visited, bulk);
+            double t = _now() - start;
+            if (t < best[bulk]) {
+                best[bulk] = t;
+            }
+        }
+    }
+    
+    printf("stack_push per neighbor: %8.4f s  (%zu reached)\n",
+           best[0], reached[0]);
+    printf("stack_push_n per list:   %8.4f s  (%zu reached)\n",
+           best[1], reached[1]);
+    printf("speedup:                 %8.2fx\n", best[0] / best[1]);
+    
+    stack_destroy(stack);
+    free(visited);
+    free(g.offsets);
+    free(g.neighbors);
+    return 0;
+}
@@ -0,0 +1,115 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../include/topk.h"
+#include "../include/priority_queue.h"
+#include "../include/array.h"
+
+/*
+ * Top-K largest of n random values, four ways:
+ *   - push everything into a PriorityQueue (max order), pop K
+ *   - TopK, one topk_offer per value
+ *   - TopK, topk_offer_n over 64K-value chunks (SIMD pre-filter)
+ *   - array_nth_element on a DynamicArray holding all n values
+ *
+ * Usage: bench_topk [n] [k]   (default 1e7, 100)
+ */
+
+#define CHUNK 65536
+
+static double _now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static unsigned _next(unsigned *state) {
+    *state = *state * 1103515245u + 12345u;
+    return *state >> 1;
+}
+
+int main(int argc, char **argv) {
+    size_t n = 10000000;
+    size_t k = 100;
+    if (argc > 1) {
+        n = (size_t)strtoull(argv[1], NULL, 10);
+    }
+    if (argc > 2) {
+        k = (size_t)strtoull(argv[2], NULL, 10);
+    }
+    if (n == 0 || k == 0 || k > n) {
+        fprintf(stderr, "need 0 < k <= n\n");
+        return 1;
+    }
+    
+    int *values = malloc(n * sizeof(int));
+    int *out = malloc(k * sizeof(int));
+    if (!values || !out) {
+        fprintf(stderr, "allocation failed\n");
+        free(values);
+        free(out);
+        return 1;
+    }
+    
+    unsigned state = 42;
+    for (size_t i = 0; i < n; i++) {
+        values[i] = (int)_next(&state);
+    }
+    
+    printf("=== Top-K Benchmark ===\n\n");
+    printf("Top %zu of %zu values:\n", k, n);
+    
+    double start = _now();
+    PriorityQueue *pq = pqueue_create_max(n);
+    pqueue_push_n(pq, values, n);
+    pqueue_pop_n(pq, out, k);
+    double t_full = _now() - start;
+    int best_full = out[0];
+    pqueue_destroy(pq);
+    
+    start = _now();
+    TopK *tk = topk_create(k, PQUEUE_MAX);
+    for (size_t i = 0; i < n; i++) {
+        topk_offer(tk, values[i]);
+    }
+    topk_result(tk, out);
+    double t_offer = _now() - start;
+    int best_offer = out[0];
+    topk_destroy(tk);
+    
+    start = _now();
+    tk = topk_create(k, PQUEUE_MAX);
+    for (size_t i = 0; i < n; i += CHUNK) {
+        topk_offer_n(tk, values + i, n - i < CHUNK ? n - i : CHUNK);
+    }
+    topk_result(tk, out);
+    double t_batch = _now() - start;
+    int best_batch = out[0];
+    int kth_batch = out[k - 1];
+    topk_destroy(tk);
+    
+    DynamicArray *arr = array_create(n);
+    for (size_t i = 0; i < n; i++) {
+        array_push(arr, values[i]);
+    }
+    start = _now();
+    array_nth_element(arr, n - k);
+    double t_select = _now() - start;
+    int kth_select = array_data(arr)[n - k];
+    array_destroy(arr);
+    
+    printf("  full heap + pop K  %8.3f s   (O(n) memory)\n", t_full);
+    printf("  topk_offer         %8.3f s   (%.1fx)\n", t_offer, t_full / t_offer);
+    printf("  topk_offer_n       %8.3f s   (%.1fx)\n", t_batch, t_full / t_batch);
+    printf("  array_nth_element  %8.3f s   (%.1fx, in place, no order)\n",
+           t_select, t_full / t_select);
+    
+    int agree = best_full == best_offer && best_offer == best_batch &&
+                kth_batch == kth_select;
+    printf("  results %s\n", agree ? "match" : "DIFFER");
+    
+    free(values);
+    free(out);
+    return agree ? 0 : 1;
+}
@@ -0,0 +1,121 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../include/singly_linked_list.h"
+#include "../include/unrolled_list.h"
+
+/*
+ * SinglyLinkedList vs UnrolledList on the same data:
+ * full traversal (container iterator), random indexed reads and
+ * random-position inserts.
+ *
+ * Usage: bench_unrolled_list [num_elements] [num_ops]   (default 1M, 2000)
+ */
+
+static double _now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static long _sum(ContainerIter *it) {
+    long sum = 0;
+    const int *span;
+    size_t n;
+    while ((n = container_iter_next(it, &span)) > 0) {
+        for (size_t i = 0; i < n; i++) {
+            sum += span[i];
+        }
+    }
+    return sum;
+}
+
+static void _report(const char *name, double slist, double ulist) {
+    printf("%-18s slist %9.4f s   ulist %9.4f s   speedup %6.1fx\n",
+           name, slist, ulist, slist / ulist);
+}
+
+int main(int argc, char **argv) {
+    size_t n = 1000000;
+    size_t ops = 2000;
+    if (argc > 1) {
+        n = (size_t)strtoull(argv[1], NULL, 10);
+    }
+    if (argc > 2) {
+        ops = (size_t)strtoull(argv[2], NULL, 10);
+    }
+    if (n == 0) {
+        fprintf(stderr, "num_elements must be positive\n");
+        return 1;
+    }
+    
+    printf("=== Unrolled List Benchmark (%zu elements, %zu random ops) ===\n\n",
+           n, ops);
+    
+    SinglyLinkedList *slist = slist_create();
+    UnrolledList *ulist = ulist_create();
+    double start = _now();
+    for (size_t i = 0; i < n; i++) {
+        slist_push_back(slist, (int)i);
+    }
+    double t_slist = _now() - start;
+    start = _now();
+    for (size_t i = 0; i < n; i++) {
+        ulist_push_back(ulist, (int)i);
+    }
+    double t_ulist = _now() - start;
+    _report("build", t_slist, t_ulist);
+    
+    volatile long sink = 0;
+    ContainerIter it;
+    start = _now();
+    slist_iter_init(slist, &it);
+    sink += _sum(&it);
+    t_slist = _now() - start;
+    start = _now();
+    ulist_iter_init(ulist, &it);
+    sink += _sum(&it);
+    t_ulist = _now() - start;
+    _report("traversal", t_slist, t_ulist);
+    
+    srand(42);
+    start = _now();
+    for (size_t i = 0; i < ops; i++) {
+        int v;
+        slist_get(slist, (size_t)rand() % n, &v);
+        sink += v;
+    }
+    t_slist = _now() - start;
+    srand(42);
+    start = _now();
+    for (size_t i = 0; i < ops; i++) {
+        int v;
+        ulist_get(ulist, (size_t)rand() % n, &v);
+        sink += v;
+    }
+    t_ulist = _now() - start;
+    _report("random get", t_slist, t_ulist);
+    
+    srand(7);
+    start = _now();
+    for (size_t i = 0; i < ops; i++) {
+        slist_insert_after(slist, (size_t)rand() % n, (int)i);
+    }
+    t_slist = _now() - start;
+    srand(7);
+    start = _now();
+    for (size_t i = 0; i < ops; i++) {
+        ulist_insert_after(ulist, (size_t)rand() % n, (int)i);
+    }
+    t_ulist = _now() - start;
+    _report("random insert", t_slist, t_ulist);
+    
+    printf("\nnodes: slist %zu (one per element), ulist %zu\n",
+           slist_size(slist), ulist_node_count(ulist));
+    
+    (void)sink;
+    slist_destroy(slist);
+    ulist_destroy(ulist);
+    return 0;
+}
@@ -0,0 +1,28 @@
+#include <stdio.h>
+#include "../include/bucket_queue.h"
+
+int main(void) {
+    printf("=== Bucket Queue Demo ===\n\n");
+    
+    printf("1. Task priorities in [0, 10):\n");
+    BucketQueue *bq = bqueue_create(0, 10);
+    int priorities[] = {7, 2, 9, 2, 5, 0};
+    for (int i = 0; i < 6; i++) {
+        bqueue_push(bq, priorities[i]);
+    }
+    bqueue_print(bq);
+    printf("Out of range push (10): %s\n\n",
+           bqueue_push(bq, 10) == 0 ? "accepted" : "rejected");
+    
+    printf("2. Serving in priority order:\n");
+    int val;
+    while (bqueue_pop(bq, &val) == 0) {
+        printf("%d ", val);
+    }
+    printf("\n");
+    
+    bqueue_destroy(bq);
+    
+    printf("\n=== Demo Complete ===\n");
+    return 0;
+}
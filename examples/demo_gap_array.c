@@ -0,0 +1,42 @@
+#include <stdio.h>
+#include "../include/gap_array.h"
+
+int main(void) {
+    printf("=== Gap Array Demo ===\n\n");
+    
+    printf("1. Typing at the cursor:\n");
+    GapArray *arr = gap_array_create(4);
+    for (int i = 1; i <= 5; i++) {
+        gap_array_cursor_insert(arr, i * 10);
+    }
+    gap_array_print(arr);
+    printf("\n");
+    
+    printf("2. Moving the cursor and inserting:\n");
+    gap_array_move_cursor(arr, 2);
+    gap_array_cursor_insert(arr, 21);
+    gap_array_cursor_insert(arr, 22);
+    gap_array_print(arr);
+    printf("\n");
+    
+    printf("3. Backspace and delete around the cursor:\n");
+    int val;
+    gap_array_cursor_backspace(arr, &val);
+    printf("Backspace removed: %d\n", val);
+    gap_array_cursor_delete(arr, &val);
+    printf("Delete removed: %d\n", val);
+    gap_array_print(arr);
+    printf("\n");
+    
+    printf("4. array.h-style access:\n");
+    gap_array_insert(arr, 0, 5);
+    gap_array_remove(arr, gap_array_size(arr) - 1, &val);
+    printf("Inserted 5 at front, removed last (%d)\n", val);
+    gap_array_get(arr, 1, &val);
+    printf("Element at index 1: %d\n", val);
+    gap_array_print(arr);
+    
+    gap_array_destroy(arr);
+    printf("\n=== Demo Complete ===\n");
+    return 0;
+}
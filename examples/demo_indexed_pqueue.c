@@ -0,0 +1,38 @@
+#include <stdio.h>
+#include "../include/indexed_pqueue.h"
+
+int main(void) {
+    printf("=== Indexed Priority Queue Demo ===\n\n");
+    
+    printf("1. Queueing jobs by id with priorities:\n");
+    IndexedPQ *pq = ipqueue_create(8);
+    int priorities[] = {50, 20, 70, 10, 40};
+    for (size_t id = 0; id < 5; id++) {
+        ipqueue_push(pq, id, priorities[id]);
+    }
+    ipqueue_print(pq);
+    printf("\n");
+    
+    printf("2. Re-prioritizing in place (no duplicate entries):\n");
+    ipqueue_decrease_key(pq, 2, 5);
+    ipqueue_increase_key(pq, 3, 60);
+    ipqueue_print(pq);
+    printf("\n");
+    
+    printf("3. Cancelling job 1:\n");
+    int prio;
+    ipqueue_remove(pq, 1, &prio);
+    printf("Removed job 1 (priority %d), contains 1? %s\n\n", prio,
+           ipqueue_contains(pq, 1) ? "yes" : "no");
+    
+    printf("4. Draining in priority order:\n");
+    size_t id;
+    while (ipqueue_pop(pq, &id, &prio) == 0) {
+        printf("job %zu (priority %d)\n", id, prio);
+    }
+    
+    ipqueue_destroy(pq);
+    
+    printf("\n=== Demo Complete ===\n");
+    return 0;
+}
@@ -0,0 +1,55 @@
+#include <stdio.h>
+#include "../include/intrusive_list.h"
+
+typedef struct Job {
+    const char *name;
+    int urgent;
+    IListLink in_queue;   // Every job is queued
+    IListLink in_urgent;  // Urgent jobs are also on this list
+} Job;
+
+static void _print_queue(const char *title, const IList *list, int urgent_links) {
+    printf("%s:", title);
+    for (IListLink *l = ilist_front(list); l; l = ilist_next(l)) {
+        Job *job = urgent_links ? ILIST_ENTRY(l, Job, in_urgent)
+                                : ILIST_ENTRY(l, Job, in_queue);
+        printf(" %s", job->name);
+    }
+    printf(" (size: %zu)\n", ilist_size(list));
+}
+
+int main(void) {
+    printf("=== Intrusive List Demo ===\n\n");
+    
+    Job jobs[] = {
+        {"build", 0, {0}, {0}}, {"deploy", 1, {0}, {0}},
+        {"test", 0, {0}, {0}}, {"rollback", 1, {0}, {0}}
+    };
+    IList queue = ILIST_INIT;
+    IList urgent = ILIST_INIT;
+    
+    printf("1. Linking caller-owned jobs into two lists (no allocation):\n");
+    for (int i = 0; i < 4; i++) {
+        ilist_push_back(&queue, &jobs[i].in_queue);
+        if (jobs[i].urgent) {
+            ilist_push_back(&urgent, &jobs[i].in_urgent);
+        }
+    }
+    _print_queue("queue", &queue, 0);
+    _print_queue("urgent", &urgent, 1);
+    printf("\n");
+    
+    printf("2. Finishing 'deploy' unlinks it from both lists in O(1):\n");
+    ilist_remove(&queue, &jobs[1].in_queue);
+    ilist_remove(&urgent, &jobs[1].in_urgent);
+    _print_queue("queue", &queue, 0);
+    _print_queue("urgent", &urgent, 1);
+    printf("\n");
+    
+    printf("3. Reversing the queue:\n");
+    ilist_reverse(&queue);
+    _print_queue("queue", &queue, 0);
+    
+    printf("\n=== Demo Complete ===\n");
+    return 0;
+}
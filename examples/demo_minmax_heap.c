@@ -0,0 +1,33 @@
+#include <stdio.h>
+#include "../include/minmax_heap.h"
+
+int main(void) {
+    printf("=== Min-Max Heap Demo ===\n\n");
+    
+    printf("1. Pushing bids into a double-ended queue:\n");
+    MinMaxHeap *heap = mmheap_create(0);
+    int bids[] = {120, 95, 180, 60, 150, 110, 75};
+    for (int i = 0; i < 7; i++) {
+        mmheap_push(heap, bids[i]);
+    }
+    mmheap_print(heap);
+    
+    int lo, hi;
+    mmheap_peek_min(heap, &lo);
+    mmheap_peek_max(heap, &hi);
+    printf("Lowest: %d, highest: %d\n\n", lo, hi);
+    
+    printf("2. Taking from both ends:\n");
+    while (mmheap_size(heap) > 1) {
+        mmheap_pop_max(heap, &hi);
+        mmheap_pop_min(heap, &lo);
+        printf("max %d, min %d\n", hi, lo);
+    }
+    mmheap_pop_min(heap, &lo);
+    printf("Median left over: %d\n", lo);
+    
+    mmheap_destroy(heap);
+    
+    printf("\n=== Demo Complete ===\n");
+    return 0;
+}
@@ -0,0 +1,60 @@
+#include <stdio.h>
+#include "../include/pairing_heap.h"
+#include "../include/priority_queue.h"
+
+int main(void) {
+    printf("=== Pairing Heap Demo ===\n\n");
+    
+    printf("1. Pushing values and keeping a handle:\n");
+    PairingHeap *heap = pheap_create();
+    int values[] = {42, 17, 88, 5, 63};
+    PHeapNode *handle = NULL;
+    for (int i = 0; i < 5; i++) {
+        PHeapNode *node = pheap_push(heap, values[i]);
+        if (values[i] == 88) {
+            handle = node;
+        }
+    }
+    pheap_print(heap);
+    
+    printf("\n2. Decreasing 88 to 1 through its handle:\n");
+    pheap_decrease_key(heap, handle, 1);
+    int val;
+    pheap_peek(heap, &val);
+    printf("New minimum: %d\n", val);
+    
+    printf("\n3. Melding a second worker's heap in O(1):\n");
+    PairingHeap *other = pheap_create();
+    for (int i = 0; i < 4; i++) {
+        pheap_push(other, 10 * i + 3);
+    }
+    pheap_print(other);
+    pheap_meld(heap, other);
+    printf("Merged size: %zu\n", pheap_size(heap));
+    
+    printf("\n4. Popping everything:\n");
+    while (pheap_pop(heap, &val) == 0) {
+        printf("%d ", val);
+    }
+    printf("\n");
+    pheap_destroy(heap);
+    
+    printf("\n5. Merging array-backed PriorityQueues:\n");
+    PriorityQueue *a = pqueue_create(0);
+    PriorityQueue *b = pqueue_create(0);
+    for (int i = 0; i < 5; i++) {
+        pqueue_push(a, 2 * i);
+        pqueue_push(b, 2 * i + 1);
+    }
+    pqueue_merge(a, b);
+    printf("Merged: ");
+    while (pqueue_pop(a, &val) == 0) {
+        printf("%d ", val);
+    }
+    printf("\n");
+    pqueue_destroy(a);
+    pqueue_destroy(b);
+    
+    printf("\n=== Demo Complete ===\n");
+    return 0;
+}
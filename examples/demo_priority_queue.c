@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <limits.h>
 #include "../include/priority_queue.h"
 
 int main(void) {
@@ -154,6 +155,36 @@ int main(void) {
     pqueue_peek(pq, &val);
     printf("%d\n", val);
     
+    pqueue_destroy(pq);
+    printf("\n");
+    
+    printf("11. 4-ary heap (four children per node):\n");
+    pq = pqueue_create_with_arity(16, 4);
+    for (int i = 12; i > 0; i--) {
+        pqueue_push(pq, i * 5);
+    }
+    pqueue_print(pq);
+    printf("Popped in order:");
+    while (pqueue_pop(pq, &val) == 0) {
+        printf(" %d", val);
+    }
+    printf("\n");
+    
+    pqueue_destroy(pq);
+    printf("\n");
+    
+    printf("12. Max-heap (largest first, INT_MIN is fine):\n");
+    pq = pqueue_create_max(8);
+    int mixed[] = {4, INT_MIN, 42, -7, INT_MAX};
+    for (int i = 0; i < 5; i++) {
+        pqueue_push(pq, mixed[i]);
+    }
+    printf("Popped in order:");
+    while (pqueue_pop(pq, &val) == 0) {
+        printf(" %d", val);
+    }
+    printf("\n");
+    
     pqueue_destroy(pq);
     
     printf("\n=== Demo Complete ===\n");
@@ -0,0 +1,33 @@
+#include <stdio.h>
+#include "../include/radix_heap.h"
+
+int main(void) {
+    printf("=== Radix Heap Demo ===\n\n");
+    
+    printf("1. Scheduling events at times 30, 10, 20:\n");
+    RadixHeap *heap = radixheap_create();
+    radixheap_push(heap, 30);
+    radixheap_push(heap, 10);
+    radixheap_push(heap, 20);
+    
+    int now;
+    radixheap_peek(heap, &now);
+    printf("Next event at %d (%zu pending)\n\n", now, radixheap_size(heap));
+    
+    printf("2. Each event schedules a follow-up 15 later:\n");
+    for (int i = 0; i < 5; i++) {
+        radixheap_pop(heap, &now);
+        printf("t=%d -> schedule t=%d\n", now, now + 15);
+        radixheap_push(heap, now + 15);
+    }
+    printf("\n");
+    
+    printf("3. Scheduling in the past is rejected:\n");
+    printf("push(%d): %s\n", now - 1,
+           radixheap_push(heap, now - 1) == 0 ? "accepted" : "rejected");
+    
+    radixheap_destroy(heap);
+    
+    printf("\n=== Demo Complete ===\n");
+    return 0;
+}
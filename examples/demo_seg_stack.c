@@ -0,0 +1,36 @@
+#include <stdio.h>
+#include "../include/seg_stack.h"
+
+int main(void) {
+    printf("=== Segmented Stack Demo ===\n\n");
+    
+    printf("1. Creating a stack with 4 elements per chunk:\n");
+    SegStack *stack = seg_stack_create_with_chunk_size(4);
+    seg_stack_print(stack);
+    printf("\n");
+    
+    printf("2. Pushing 10 elements (links new chunks, no copying):\n");
+    for (int i = 1; i <= 10; i++) {
+        seg_stack_push(stack, i * 10);
+    }
+    seg_stack_print(stack);
+    printf("\n");
+    
+    printf("3. Popping back below a chunk boundary:\n");
+    int val;
+    for (int i = 0; i < 3; i++) {
+        seg_stack_pop(stack, &val);
+        printf("Popped: %d\n", val);
+    }
+    seg_stack_print(stack);
+    printf("The emptied chunk is kept as a spare for the next push\n\n");
+    
+    printf("4. Clearing:\n");
+    seg_stack_clear(stack);
+    seg_stack_print(stack);
+    
+    seg_stack_destroy(stack);
+    
+    printf("\n=== Demo Complete ===\n");
+    return 0;
+}
@@ -0,0 +1,41 @@
+#include <stdio.h>
+#include "../include/skip_list.h"
+
+int main(void) {
+    printf("=== Skip List Demo ===\n\n");
+    
+    printf("1. Inserting keys out of order (kept sorted):\n");
+    SkipList *list = skiplist_create();
+    int keys[] = {42, 7, 19, 88, 3, 61, 25};
+    for (int i = 0; i < 7; i++) {
+        skiplist_insert(list, keys[i], keys[i] * 10);
+    }
+    skiplist_print(list);
+    printf("\n");
+    
+    printf("2. Lookups:\n");
+    int val;
+    if (skiplist_find(list, 19, &val) == 0) {
+        printf("19 -> %d\n", val);
+    }
+    printf("Contains 20? %s\n\n", skiplist_contains(list, 20) ? "yes" : "no");
+    
+    printf("3. Range scan [10, 60]:\n");
+    SkipListRange range;
+    int key;
+    skiplist_range_init(list, 10, 60, &range);
+    while (skiplist_range_next(&range, &key, &val) == 0) {
+        printf("%d: %d\n", key, val);
+    }
+    printf("\n");
+    
+    printf("4. Updating and erasing:\n");
+    skiplist_insert(list, 7, -1);
+    skiplist_erase(list, 88, NULL);
+    skiplist_print(list);
+    
+    skiplist_destroy(list);
+    
+    printf("\n=== Demo Complete ===\n");
+    return 0;
+}
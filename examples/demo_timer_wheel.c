@@ -0,0 +1,68 @@
+#include <stdio.h>
+#include "../include/timer_wheel.h"
+
+typedef struct {
+    const char *name;
+    Timer idle;
+} Session;
+
+static void _on_idle(Timer *timer, void *ctx) {
+    Session *s = ctx;
+    (void)timer;
+    printf("  %s timed out\n", s->name);
+}
+
+static int _heartbeats = 0;
+
+static void _on_heartbeat(Timer *timer, void *ctx) {
+    TimerWheel *wheel = ctx;
+    _heartbeats++;
+    printf("  heartbeat #%d at tick %llu\n", _heartbeats,
+           (unsigned long long)twheel_now(wheel));
+    if (_heartbeats < 3) {
+        twheel_schedule(wheel, timer, 100);
+    }
+}
+
+int main(void) {
+    printf("=== Timer Wheel Demo ===\n\n");
+    
+    TimerWheel *wheel = twheel_create(0);
+    
+    printf("1. Three sessions with idle timeouts:\n");
+    const char *names[3] = {"alice", "bob", "carol"};
+    Session sessions[3];
+    uint64_t timeouts[3] = {50, 5000, 300000};
+    for (int i = 0; i < 3; i++) {
+        sessions[i].name = names[i];
+        twheel_timer_init(&sessions[i].idle, _on_idle, &sessions[i]);
+        twheel_schedule(wheel, &sessions[i].idle, timeouts[i]);
+        printf("  %s expires in %llu ticks\n", sessions[i].name,
+               (unsigned long long)timeouts[i]);
+    }
+    printf("Pending: %zu\n\n", twheel_size(wheel));
+    
+    printf("2. Advancing 100 ticks:\n");
+    size_t fired = twheel_advance(wheel, 100);
+    printf("Fired: %zu, pending: %zu\n\n", fired, twheel_size(wheel));
+    
+    printf("3. Bob is active: push his timeout back, carol logs out:\n");
+    twheel_schedule(wheel, &sessions[1].idle, 5000);
+    twheel_cancel(wheel, &sessions[2].idle);
+    printf("Carol pending: %s\n", twheel_is_pending(&sessions[2].idle) ? "yes" : "no");
+    fired = twheel_advance(wheel, 5100);
+    printf("Fired: %zu at tick %llu, pending: %zu\n\n", fired,
+           (unsigned long long)twheel_now(wheel), twheel_size(wheel));
+    
+    printf("4. Periodic timer rescheduling itself:\n");
+    Timer heartbeat;
+    twheel_timer_init(&heartbeat, _on_heartbeat, wheel);
+    twheel_schedule(wheel, &heartbeat, 100);
+    twheel_advance(wheel, 1000);
+    printf("Pending: %zu\n", twheel_size(wheel));
+    
+    twheel_destroy(wheel);
+    
+    printf("\n=== Demo Complete ===\n");
+    return 0;
+}
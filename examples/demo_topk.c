@@ -0,0 +1,40 @@
+#include <stdio.h>
+#include "../include/topk.h"
+
+int main(void) {
+    printf("=== Top-K Demo ===\n\n");
+    
+    printf("1. Three highest scores from a stream:\n");
+    TopK *tk = topk_create(3, PQUEUE_MAX);
+    int scores[] = {72, 95, 41, 88, 63, 99, 57, 91, 80, 66};
+    for (int i = 0; i < 10; i++) {
+        int kept = topk_offer(tk, scores[i]);
+        printf("offer %d -> %s\n", scores[i], kept ? "kept" : "rejected");
+    }
+    
+    int out[3];
+    int threshold;
+    topk_threshold(tk, &threshold);
+    size_t n = topk_result(tk, out);
+    printf("Top %zu:", n);
+    for (size_t i = 0; i < n; i++) {
+        printf(" %d", out[i]);
+    }
+    printf(" (entry threshold now %d)\n\n", threshold);
+    topk_destroy(tk);
+    
+    printf("2. Two lowest latencies from a batch:\n");
+    tk = topk_create(2, PQUEUE_MIN);
+    int latencies[] = {12, 9, 30, 7, 15, 8, 22, 11};
+    topk_offer_n(tk, latencies, 8);
+    n = topk_result(tk, out);
+    printf("Fastest:");
+    for (size_t i = 0; i < n; i++) {
+        printf(" %d", out[i]);
+    }
+    printf("\n");
+    topk_destroy(tk);
+    
+    printf("\n=== Demo Complete ===\n");
+    return 0;
+}
@@ -0,0 +1,40 @@
+#include <stdio.h>
+#include "../include/unrolled_list.h"
+
+int main(void) {
+    printf("=== Unrolled Linked List Demo ===\n\n");
+    
+    printf("1. Appending 30 elements (13 per cache-line node):\n");
+    UnrolledList *list = ulist_create();
+    for (int i = 0; i < 30; i++) {
+        ulist_push_back(list, i);
+    }
+    ulist_print(list);
+    printf("\n");
+    
+    printf("2. Inserting into a full node splits it:\n");
+    ulist_insert_at(list, 5, 100);
+    ulist_print(list);
+    printf("\n");
+    
+    printf("3. Indexed access skips whole nodes:\n");
+    int val;
+    ulist_get(list, 20, &val);
+    printf("Element at index 20: %d\n\n", val);
+    
+    printf("4. Removing elements merges underfull nodes:\n");
+    for (int i = 0; i < 10; i++) {
+        ulist_remove_at(list, 0, NULL);
+    }
+    ulist_print(list);
+    printf("\n");
+    
+    printf("5. Reversing:\n");
+    ulist_reverse(list);
+    ulist_print(list);
+    
+    ulist_destroy(list);
+    
+    printf("\n=== Demo Complete ===\n");
+    return 0;
+}
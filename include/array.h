@@ -2,25 +2,130 @@
 #define ARRAY_H
 
 #include <stddef.h>
+#include "growth.h"
+#include "container_iter.h"
 
 /**
- * Dynamic array with automatic resizing (2x growth factor).
+ * Dynamic array with automatic resizing (2x growth factor by default,
+ * configurable with array_set_growth_policy).
  */
 typedef struct DynamicArray DynamicArray;
 
+/** Elements held inside the array struct before spilling to the heap. */
+#define ARRAY_INLINE_CAPACITY 16
+
+/** Bytes reserved by DynamicArrayStorage (checked at compile time). */
+#define ARRAY_STORAGE_SIZE (16 * sizeof(void*) + ARRAY_INLINE_CAPACITY * sizeof(int))
+
+/**
+ * Caller-provided memory for array_init: a local, a static or a field of
+ * another struct. Contents are private. Do not copy it while in use.
+ */
+typedef union DynamicArrayStorage {
+    max_align_t align;
+    unsigned char bytes[ARRAY_STORAGE_SIZE];
+} DynamicArrayStorage;
+
+/** Predicate for filter kernels: return non-zero to select the value. */
+typedef int (*ArrayPredicate)(int value, void *ctx);
+
+/** Flags for array_open_mapped (combine with |). */
+#define ARRAY_MAP_CREATE   0x1 /* Create the file if it does not exist */
+#define ARRAY_MAP_TRUNCATE 0x2 /* Discard existing contents */
+#define ARRAY_MAP_READONLY 0x4 /* Map read-only; mutations return -1 */
+
+/** Access-pattern hints for mapped storage (see array_advise). */
+typedef enum {
+    ARRAY_ADVICE_NORMAL,
+    ARRAY_ADVICE_SEQUENTIAL,
+    ARRAY_ADVICE_RANDOM,
+    ARRAY_ADVICE_WILLNEED,
+    ARRAY_ADVICE_DONTNEED
+} ArrayAdvice;
+
 /**
  * Creates a new dynamic array.
+ * Capacities up to ARRAY_INLINE_CAPACITY use the buffer embedded in the
+ * struct, so small arrays cost a single allocation.
  * @param capacity Initial capacity (0 = default 16)
  * @return Array pointer or NULL on error
  */
 DynamicArray *array_create(size_t capacity);
 
 /**
- * Frees all array memory. Pointer becomes invalid after call.
+ * Creates an array inside caller storage. Up to ARRAY_INLINE_CAPACITY
+ * elements need no heap allocation at all; beyond that it spills to the
+ * heap like any other array. Release with array_destroy (storage itself
+ * is not freed).
+ * @param capacity Initial capacity (0 = default 16)
+ * @return Array pointer (into storage) or NULL on error
+ */
+DynamicArray *array_init(DynamicArrayStorage *storage, size_t capacity);
+
+/**
+ * Opens (or creates) an array stored in a memory-mapped file (Linux only).
+ * The file is a 64-byte header followed by the raw ints, so reopening is
+ * instant and processes mapping the same file share the page cache.
+ * Growth extends the file with ftruncate and the mapping with mremap.
+ * The element count is written to the header by array_sync/array_destroy.
+ * @param flags ARRAY_MAP_* flags
+ * @return Array pointer or NULL on error (bad file, unsupported platform)
+ */
+DynamicArray *array_open_mapped(const char *path, int flags);
+
+/**
+ * Flushes a file-backed array (header and data) to disk.
+ * @return 0 on success, -1 on error (not file-backed)
+ */
+int array_sync(DynamicArray *arr);
+
+/**
+ * Passes an access-pattern hint to the kernel for mapped storage
+ * (file-backed, or anonymous above the mmap threshold).
+ * @return 0 on success, -1 on error (heap storage, unsupported advice)
+ */
+int array_advise(DynamicArray *arr, ArrayAdvice advice);
+
+/**
+ * Writes the array to fd in the serialize.h binary format.
+ * @return 0 on success, -1 on error
+ */
+int array_save_fd(const DynamicArray *arr, int fd);
+
+/**
+ * Reads an array written by array_save_fd (or a mapped array file).
+ * @return New array or NULL on error (bad header, short read)
+ */
+DynamicArray *array_load_fd(int fd);
+
+/**
+ * Wraps a serialized buffer without copying. Edits write into buf;
+ * growing copies the elements into owned storage first.
+ * buf must outlive the array and its payload must be int-aligned.
+ * @return Array pointer or NULL on error (bad header, big-endian host)
+ */
+DynamicArray *array_view_from_buffer(void *buf, size_t len);
+
+/**
+ * Frees all array memory (for array_init arrays, only the heap buffer).
+ * Pointer becomes invalid after call.
  * @param arr Array to destroy (can be NULL)
  */
 void array_destroy(DynamicArray *arr);
 
+/**
+ * Sets how the array grows when full (factor, fixed step, page-aligned)
+ * and the size above which it switches to mmap/mremap on Linux.
+ * @return 0 on success, -1 on error (invalid policy)
+ */
+int array_set_growth_policy(DynamicArray *arr, GrowthPolicy policy);
+
+/**
+ * Ensures capacity for at least `capacity` elements without further growth.
+ * @return 0 on success, -1 on error
+ */
+int array_reserve(DynamicArray *arr, size_t capacity);
+
 /**
  * Appends an element to the end.
  * @return 0 on success, -1 on error
@@ -76,6 +181,12 @@ size_t array_size(const DynamicArray *arr);
  */
 size_t array_capacity(const DynamicArray *arr);
 
+/**
+ * Returns the element buffer (valid until the next mutating call).
+ * Pass it with array_size() to the kernels in scan.h.
+ */
+const int *array_data(const DynamicArray *arr);
+
 /**
  * Checks if the array is empty.
  * @return 1 if empty, 0 otherwise
@@ -88,6 +199,52 @@ int array_is_empty(const DynamicArray *arr);
  */
 int array_find(const DynamicArray *arr, int value);
 
+/**
+ * Keeps only elements where pred returns non-zero (stable, single pass).
+ * @return Number of elements removed
+ */
+size_t array_retain_if(DynamicArray *arr, ArrayPredicate pred, void *ctx);
+
+/**
+ * Removes every occurrence of value (stable, single pass; AVX-512
+ * compress store when compiled with -mavx512f).
+ * @return Number of elements removed
+ */
+size_t array_remove_all(DynamicArray *arr, int value);
+
+/**
+ * Moves elements where pred returns non-zero to the front (not stable).
+ * @return Number of selected elements (index of the first unselected one)
+ */
+size_t array_partition(DynamicArray *arr, ArrayPredicate pred, void *ctx);
+
+/**
+ * Collapses runs of equal values in a sorted array.
+ * @return Number of elements removed
+ */
+size_t array_dedup_sorted(DynamicArray *arr);
+
+/**
+ * Removes several positions in one pass.
+ * @param sorted_idx Strictly increasing indices, all < size
+ * @return 0 on success, -1 on error (array unchanged)
+ */
+int array_remove_indices(DynamicArray *arr, const size_t *sorted_idx, size_t k);
+
+/**
+ * Quickselect: reorders so data[n] holds what a full sort would put
+ * there, with nothing larger before it and nothing smaller after it.
+ * Expected O(n), in place.
+ * @return 0 on success, -1 on error (n out of range or read-only)
+ */
+int array_nth_element(DynamicArray *arr, size_t n);
+
+/**
+ * Starts a read-only traversal (see container_iter.h): a single span.
+ * @return 0 on success, -1 on error
+ */
+int array_iter_init(const DynamicArray *arr, ContainerIter *it);
+
 /**
  * Prints the array (for debugging).
  */
@@ -18,6 +18,19 @@ Array2D* array2d_create(size_t rows, size_t cols);
 /** Frees all array memory. */
 void array2d_destroy(Array2D *arr);
 
+/** Writes matrix to fd (serialize.h format). @return 0 on success, -1 on error. */
+int array2d_save_fd(const Array2D *arr, int fd);
+
+/** Reads a matrix written by array2d_save_fd. @return Matrix or NULL. */
+Array2D* array2d_load_fd(int fd);
+
+/**
+ * Wraps a serialized buffer without copying (writes go to buf).
+ * buf must outlive the matrix.
+ * @return Matrix or NULL on error
+ */
+Array2D* array2d_view_from_buffer(void *buf, size_t len);
+
 /** Sets value at [row, col]. @return 0 on success, -1 on error. */
 int array2d_set(Array2D *arr, size_t row, size_t col, int value);
 
@@ -12,6 +12,15 @@ Bitset *bitset_create(size_t num_bits);
 /** Frees all bitset memory. */
 void bitset_destroy(Bitset *bs);
 
+/** Writes bitset to fd (serialize.h format). @return 0 on success, -1 on error. */
+int bitset_save_fd(const Bitset *bs, int fd);
+
+/** Reads a bitset written by bitset_save_fd. @return Bitset or NULL. */
+Bitset *bitset_load_fd(int fd);
+
+/** Wraps a serialized buffer without copying (buf must outlive it). @return Bitset or NULL. */
+Bitset *bitset_view_from_buffer(void *buf, size_t len);
+
 /** Sets bit at index. @return 0 on success, -1 on error. */
 int bitset_set(Bitset *bs, size_t bit_index);
 
@@ -24,6 +33,12 @@ int bitset_flip(Bitset *bs, size_t bit_index);
 /** Tests bit at index. @return 1 if set, 0 if clear, -1 on error. */
 int bitset_test(const Bitset *bs, size_t bit_index);
 
+/**
+ * Finds the first set bit at or after `from`, a word at a time.
+ * @return 0 on success, -1 if there is none (or on error)
+ */
+int bitset_find_next(const Bitset *bs, size_t from, size_t *out_index);
+
 /** Sets all bits to 1. */
 void bitset_set_all(Bitset *bs);
 
@@ -0,0 +1,42 @@
+#ifndef BUCKET_QUEUE_H
+#define BUCKET_QUEUE_H
+
+#include <stddef.h>
+
+/**
+ * Min-priority queue for ints in a fixed range [lo, lo + num_buckets):
+ * one counter per value plus a bitset of non-empty buckets. Push is
+ * O(1); pop and peek scan the bitset a 64-bucket word at a time from
+ * the last minimum, so monotone workloads (timestamps) stay near O(1).
+ * Same push/pop/peek interface as priority_queue.h.
+ */
+typedef struct BucketQueue BucketQueue;
+
+/** Creates an empty queue for values lo .. lo + num_buckets - 1. @return Queue or NULL. */
+BucketQueue *bqueue_create(int lo, size_t num_buckets);
+
+/** Frees all queue memory. */
+void bqueue_destroy(BucketQueue *bq);
+
+/** Pushes element. @return 0 on success, -1 on error (value out of range). */
+int bqueue_push(BucketQueue *bq, int value);
+
+/** Removes min element. @return 0 on success, -1 on error. */
+int bqueue_pop(BucketQueue *bq, int *out_value);
+
+/** Views min element. @return 0 on success, -1 on error. */
+int bqueue_peek(const BucketQueue *bq, int *out_value);
+
+/** Returns number of elements. */
+size_t bqueue_size(const BucketQueue *bq);
+
+/** Checks if empty. @return 1 if empty, 0 otherwise. */
+int bqueue_is_empty(const BucketQueue *bq);
+
+/** Removes all elements. */
+void bqueue_clear(BucketQueue *bq);
+
+/** Prints queue for debugging. */
+void bqueue_print(const BucketQueue *bq);
+
+#endif // BUCKET_QUEUE_H
@@ -0,0 +1,43 @@
+#ifndef CONTAINER_ITER_H
+#define CONTAINER_ITER_H
+
+#include <stddef.h>
+
+/**
+ * Read-only iterator shared by all containers, driven by the caller
+ * (no visitor callbacks). Each container provides X_iter_init.
+ * container_iter_next yields the elements in order as spans:
+ * contiguous storage comes back in as few spans as possible (one for
+ * DynamicArray/Stack, up to two for RingBuffer and GapArray), and
+ * linked nodes one element at a time. A full traversal is O(n) with no
+ * copies. Any mutation of the container invalidates the iterator.
+ *
+ *     ContainerIter it;
+ *     const int *span;
+ *     size_t n;
+ *     slist_iter_init(list, &it);
+ *     while ((n = container_iter_next(&it, &span)) > 0) {
+ *         for (size_t i = 0; i < n; i++) use(span[i]);
+ *     }
+ */
+typedef struct ContainerIter ContainerIter;
+
+/** Per-container step function (set by X_iter_init). */
+typedef size_t (*ContainerIterStep)(ContainerIter *it, const int **span);
+
+/** Iterator state. Fields are private to the container implementations. */
+struct ContainerIter {
+    ContainerIterStep step;
+    const void *source;  /* Container being walked */
+    const void *cursor;  /* Next node (linked containers) */
+    size_t index;        /* Elements already yielded (contiguous ones) */
+};
+
+/**
+ * Advances to the next span.
+ * @param span Receives a pointer to the first element of the span
+ * @return Number of elements in the span, 0 when exhausted (or on error)
+ */
+size_t container_iter_next(ContainerIter *it, const int **span);
+
+#endif // CONTAINER_ITER_H
@@ -2,6 +2,7 @@
 #define DEQUE_H
 
 #include <stddef.h>
+#include "container_iter.h"
 
 /** Double-ended queue (operations at both ends in O(1)). */
 typedef struct Deque Deque;
@@ -39,6 +40,9 @@ int deque_is_empty(const Deque *deque);
 /** Removes all elements. */
 void deque_clear(Deque *deque);
 
+/** Starts a read-only front-to-back traversal, one node per span. @return 0 on success, -1 on error. */
+int deque_iter_init(const Deque *deque, ContainerIter *it);
+
 /** Prints deque for debugging. */
 void deque_print(const Deque *deque);
 
@@ -2,10 +2,22 @@
 #define DOUBLY_LINKED_LIST_H
 
 #include <stddef.h>
+#include "container_iter.h"
 
 /** Bidirectional linked list with prev/next pointers. */
 typedef struct DoublyLinkedList DoublyLinkedList;
 
+/**
+ * Persistent position in a list for O(1) edits. node == NULL is the
+ * "end" position between tail and head: next from it goes to the head,
+ * prev to the tail. Removing the cursor's node by any other means
+ * invalidates the cursor.
+ */
+typedef struct DListCursor {
+    DoublyLinkedList *list;
+    struct DListNode *node;
+} DListCursor;
+
 /** Creates an empty list. @return List pointer or NULL. */
 DoublyLinkedList *dlist_create(void);
 
@@ -30,10 +42,17 @@ int dlist_insert_at(DoublyLinkedList *list, size_t index, int value);
 /** Removes element at index. @return 0 on success, -1 on error. */
 int dlist_remove_at(DoublyLinkedList *list, size_t index, int *out_value);
 
-/** Gets element at index. @return 0 on success, -1 on error. */
+/**
+ * Gets element at index, walking from the nearest of head, tail and the
+ * last position reached by index, so nearby accesses are O(1) amortized.
+ * This updates the cache even through a const list, so concurrent
+ * dlist_get calls on one list race; readers sharing a list across threads
+ * need a lock or the read-only dlist_iter_init traversal.
+ * @return 0 on success, -1 on error
+ */
 int dlist_get(const DoublyLinkedList *list, size_t index, int *out_value);
 
-/** Sets element at index. @return 0 on success, -1 on error. */
+/** Sets element at index (same cached position as dlist_get). @return 0 on success, -1 on error. */
 int dlist_set(DoublyLinkedList *list, size_t index, int value);
 
 /** Returns number of elements. */
@@ -51,6 +70,67 @@ void dlist_clear(DoublyLinkedList *list);
 /** Reverses list in-place. */
 void dlist_reverse(DoublyLinkedList *list);
 
+/** Places cursor on the head (end position if empty). @return 0 on success, -1 on error. */
+int dlist_cursor_front(DoublyLinkedList *list, DListCursor *cursor);
+
+/** Places cursor on the tail (end position if empty). @return 0 on success, -1 on error. */
+int dlist_cursor_back(DoublyLinkedList *list, DListCursor *cursor);
+
+/** Checks whether the cursor is on an element. @return 1 if so, 0 at the end position. */
+int dlist_cursor_valid(const DListCursor *cursor);
+
+/** Moves towards the tail (end -> head). @return 0 if now on an element, -1 at end or on error. */
+int dlist_cursor_next(DListCursor *cursor);
+
+/** Moves towards the head (end -> tail). @return 0 if now on an element, -1 at end or on error. */
+int dlist_cursor_prev(DListCursor *cursor);
+
+/** Reads the element under the cursor. @return 0 on success, -1 on error. */
+int dlist_cursor_get(const DListCursor *cursor, int *out_value);
+
+/** Overwrites the element under the cursor. @return 0 on success, -1 on error. */
+int dlist_cursor_set(DListCursor *cursor, int value);
+
+/** Inserts before the cursor (at end: appends); cursor stays put. @return 0 on success, -1 on error. */
+int dlist_cursor_insert_before(DListCursor *cursor, int value);
+
+/** Inserts after the cursor (at end: prepends); cursor stays put. @return 0 on success, -1 on error. */
+int dlist_cursor_insert_after(DListCursor *cursor, int value);
+
+/** Removes the element under the cursor and moves to the next one. @return 0 on success, -1 on error. */
+int dlist_cursor_remove(DListCursor *cursor, int *out_value);
+
+/** Relinks the cursor's node as the head without reallocating (LRU touch). @return 0 on success, -1 on error. */
+int dlist_cursor_move_to_front(DListCursor *cursor);
+
+/** Relinks the cursor's node as the tail. @return 0 on success, -1 on error. */
+int dlist_cursor_move_to_back(DListCursor *cursor);
+
+/** Moves every node of other before the cursor in O(1); other ends up empty. @return 0 on success, -1 on error. */
+int dlist_cursor_splice_before(DListCursor *cursor, DoublyLinkedList *other);
+
+/** Appends every node of src to dst in O(1); src ends up empty. @return 0 on success, -1 on error. */
+int dlist_splice(DoublyLinkedList *dst, DoublyLinkedList *src);
+
+/** Merges sorted src into sorted dst by relinking (stable); src ends up empty. @return 0 on success, -1 on error. */
+int dlist_merge(DoublyLinkedList *dst, DoublyLinkedList *src);
+
+/**
+ * Builds a list holding a copy of values, with all nodes carved from one
+ * allocation (nodes released later are reused by the list that owns them).
+ * @return List pointer or NULL
+ */
+DoublyLinkedList *dlist_from_array(const int *values, size_t count);
+
+/** Copies the elements in order into out (size elements). @return 0 on success, -1 on error. */
+int dlist_to_array(const DoublyLinkedList *list, int *out);
+
+/** Sorts ascending in place (stable bottom-up merge sort, O(n log n), O(1) extra space). */
+void dlist_sort(DoublyLinkedList *list);
+
+/** Starts a read-only head-to-tail traversal, one node per span. @return 0 on success, -1 on error. */
+int dlist_iter_init(const DoublyLinkedList *list, ContainerIter *it);
+
 /** Prints list for debugging. */
 void dlist_print(const DoublyLinkedList *list);
 
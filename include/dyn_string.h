@@ -2,6 +2,7 @@
 #define DYN_STRING_H
 
 #include <stddef.h>
+#include "growth.h"
 
 /** Self-growing string with automatic null termination. */
 typedef struct String String;
@@ -21,6 +22,18 @@ String *string_create_with_capacity(size_t capacity);
 /** Frees all string memory. */
 void string_destroy(String *str);
 
+/** Sets the growth policy used when the buffer is full. @return 0 on success, -1 on error. */
+int string_set_growth_policy(String *str, GrowthPolicy policy);
+
+/** Writes string (with terminator) to fd. @return 0 on success, -1 on error. */
+int string_save_fd(const String *str, int fd);
+
+/** Reads a string written by string_save_fd. @return String or NULL. */
+String *string_load_fd(int fd);
+
+/** Wraps a serialized buffer without copying; growth copies out. @return String or NULL. */
+String *string_view_from_buffer(void *buf, size_t len);
+
 /** Appends a character. @return 0 on success, -1 on error. */
 int string_push(String *str, char ch);
 
@@ -0,0 +1,159 @@
+#ifndef GAP_ARRAY_H
+#define GAP_ARRAY_H
+
+#include <stddef.h>
+#include "growth.h"
+#include "container_iter.h"
+
+/**
+ * Gap buffer: a dynamic array with a movable hole at the cursor.
+ * Same get/set/insert/remove interface as array.h, but inserts and
+ * removals near the previous edit only move the elements between the
+ * two positions, so cursor-local editing is O(1) amortized instead of
+ * O(n) per operation. Random-position edits cost O(distance moved).
+ */
+typedef struct GapArray GapArray;
+
+/**
+ * Creates a new gap array.
+ * @param capacity Initial capacity (0 = default 16)
+ * @return Array pointer or NULL on error
+ */
+GapArray *gap_array_create(size_t capacity);
+
+/**
+ * Frees all array memory. Pointer becomes invalid after call.
+ * @param arr Array to destroy (can be NULL)
+ */
+void gap_array_destroy(GapArray *arr);
+
+/**
+ * Sets how the buffer grows when the gap closes.
+ * @return 0 on success, -1 on error (invalid policy)
+ */
+int gap_array_set_growth_policy(GapArray *arr, GrowthPolicy policy);
+
+/**
+ * Ensures capacity for at least `capacity` elements without further growth.
+ * @return 0 on success, -1 on error
+ */
+int gap_array_reserve(GapArray *arr, size_t capacity);
+
+/**
+ * Appends an element to the end (moves the cursor to the end).
+ * @return 0 on success, -1 on error
+ */
+int gap_array_push(GapArray *arr, int value);
+
+/**
+ * Removes and returns the last element.
+ * @param out_value Pointer to store removed value
+ * @return 0 on success, -1 on error (empty array)
+ */
+int gap_array_pop(GapArray *arr, int *out_value);
+
+/**
+ * Inserts an element at a specific position; the cursor ends up after it.
+ * @param index Position to insert (0 <= index <= size)
+ * @return 0 on success, -1 on error
+ */
+int gap_array_insert(GapArray *arr, size_t index, int value);
+
+/**
+ * Removes an element at a specific position; the cursor ends up at index.
+ * @param out_value Pointer to store removed value (can be NULL)
+ * @return 0 on success, -1 on error
+ */
+int gap_array_remove(GapArray *arr, size_t index, int *out_value);
+
+/**
+ * Modifies the value at a position (does not move the cursor).
+ * @return 0 on success, -1 on error (index out of range)
+ */
+int gap_array_set(GapArray *arr, size_t index, int value);
+
+/**
+ * Gets the value at a position.
+ * @param out_value Pointer to store the value
+ * @return 0 on success, -1 on error (index out of range)
+ */
+int gap_array_get(const GapArray *arr, size_t index, int *out_value);
+
+/**
+ * Returns the cursor position (elements before the gap).
+ */
+size_t gap_array_cursor(const GapArray *arr);
+
+/**
+ * Moves the cursor, shifting only the elements between old and new position.
+ * @param index New position (0 <= index <= size)
+ * @return 0 on success, -1 on error
+ */
+int gap_array_move_cursor(GapArray *arr, size_t index);
+
+/**
+ * Inserts before the cursor and advances past the new element (typing).
+ * @return 0 on success, -1 on error
+ */
+int gap_array_cursor_insert(GapArray *arr, int value);
+
+/**
+ * Removes the element before the cursor (backspace).
+ * @param out_value Pointer to store removed value (can be NULL)
+ * @return 0 on success, -1 on error (cursor at start)
+ */
+int gap_array_cursor_backspace(GapArray *arr, int *out_value);
+
+/**
+ * Removes the element after the cursor (delete).
+ * @param out_value Pointer to store removed value (can be NULL)
+ * @return 0 on success, -1 on error (cursor at end)
+ */
+int gap_array_cursor_delete(GapArray *arr, int *out_value);
+
+/**
+ * Removes all elements (size = 0, keeps capacity).
+ */
+void gap_array_clear(GapArray *arr);
+
+/**
+ * Returns the number of elements.
+ */
+size_t gap_array_size(const GapArray *arr);
+
+/**
+ * Returns the total capacity.
+ */
+size_t gap_array_capacity(const GapArray *arr);
+
+/**
+ * Checks if the array is empty.
+ * @return 1 if empty, 0 otherwise
+ */
+int gap_array_is_empty(const GapArray *arr);
+
+/**
+ * Searches for a value in the array.
+ * @return Index of value, or -1 if not found
+ */
+int gap_array_find(const GapArray *arr, int value);
+
+/**
+ * Copies the elements in order into out (size elements).
+ * @return 0 on success, -1 on error
+ */
+int gap_array_copy_to(const GapArray *arr, int *out);
+
+/**
+ * Starts a read-only traversal: the elements before and after the gap
+ * come back as (at most) two spans.
+ * @return 0 on success, -1 on error
+ */
+int gap_array_iter_init(const GapArray *arr, ContainerIter *it);
+
+/**
+ * Prints the array (for debugging).
+ */
+void gap_array_print(const GapArray *arr);
+
+#endif // GAP_ARRAY_H
@@ -0,0 +1,70 @@
+#ifndef GROWTH_H
+#define GROWTH_H
+
+#include <stddef.h>
+
+/** Capacity growth strategies shared by the resizable containers. */
+typedef enum {
+    GROWTH_DOUBLE,       /* capacity * 2 (default) */
+    GROWTH_HALF,         /* capacity * 1.5 (lower peak memory, more copies) */
+    GROWTH_FIXED,        /* capacity + increment (linear, predictable) */
+    GROWTH_PAGE_ALIGNED  /* capacity * 2 rounded up to whole pages */
+} GrowthKind;
+
+/** Where a container buffer currently lives. */
+typedef enum {
+    GROWTH_STORAGE_HEAP,    /* malloc/realloc */
+    GROWTH_STORAGE_MAPPED,  /* anonymous mmap, grown in place with mremap */
+    GROWTH_STORAGE_BORROWED, /* caller-owned memory, copied out on growth */
+    GROWTH_STORAGE_INLINE    /* small buffer inside the container struct */
+} GrowthStorage;
+
+/** Default size (bytes) above which buffers move to mmap/mremap. */
+#define GROWTH_DEFAULT_MMAP_THRESHOLD ((size_t)64 << 20)
+
+/**
+ * Per-container growth policy.
+ * mmap_threshold only takes effect on Linux (needs mremap); 0 disables it.
+ */
+typedef struct GrowthPolicy {
+    GrowthKind kind;
+    size_t increment;      /* Elements added per step (GROWTH_FIXED only) */
+    size_t mmap_threshold; /* Buffer size in bytes that switches to mmap */
+} GrowthPolicy;
+
+/** Returns the default policy (2x, mmap above 64 MiB). */
+GrowthPolicy growth_policy_default(void);
+
+/** Checks a policy for consistency. @return 0 if valid, -1 otherwise. */
+int growth_policy_validate(const GrowthPolicy *policy);
+
+/**
+ * Computes the next capacity (in elements) that holds at least `required`.
+ * @return New capacity, or 0 on overflow
+ */
+size_t growth_next_capacity(const GrowthPolicy *policy, size_t current,
+                            size_t required, size_t elem_size);
+
+/**
+ * Resizes a container buffer (ptr may be NULL for a fresh allocation).
+ * Buffers at or above the policy's mmap threshold are anonymous mappings
+ * that grow with mremap, so the kernel moves page tables instead of bytes.
+ * Borrowed and inline buffers are never freed: growth copies them into
+ * owned storage.
+ * @param capacity In: requested elements. Out: actual elements (mapped
+ *                 buffers are rounded up to whole pages)
+ * @param storage  In/out: current backend of ptr
+ * @return New buffer, or NULL on error (ptr is left untouched)
+ */
+void *growth_realloc(void *ptr, size_t elem_size, size_t old_capacity,
+                     size_t *capacity, GrowthStorage *storage,
+                     const GrowthPolicy *policy);
+
+/** Frees a buffer obtained from growth_realloc (no-op for borrowed/inline). */
+void growth_free(void *ptr, size_t elem_size, size_t capacity,
+                 GrowthStorage storage);
+
+/** Returns the system page size in bytes. */
+size_t growth_page_size(void);
+
+#endif // GROWTH_H
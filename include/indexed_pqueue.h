@@ -0,0 +1,60 @@
+#ifndef INDEXED_PQUEUE_H
+#define INDEXED_PQUEUE_H
+
+#include <stddef.h>
+
+/**
+ * Min-priority queue of ids in [0, max_ids), each with an int priority.
+ * A position map tracks where every id sits in the heap, so an id can be
+ * found, re-prioritized or removed in O(log n) instead of being pushed
+ * again and skipped when stale (e.g. Dijkstra/A* decrease-key).
+ * Backed by a 4-ary heap; memory is fixed at creation.
+ */
+typedef struct IndexedPQ IndexedPQ;
+
+/** Creates an empty queue for ids 0 .. max_ids - 1. @return Queue or NULL. */
+IndexedPQ *ipqueue_create(size_t max_ids);
+
+/** Frees all queue memory. */
+void ipqueue_destroy(IndexedPQ *pq);
+
+/** Inserts id with priority. @return 0 on success, -1 on error (out of range or already queued). */
+int ipqueue_push(IndexedPQ *pq, size_t id, int priority);
+
+/** Removes the id with the smallest priority. @param out_priority Can be NULL. @return 0 on success, -1 if empty. */
+int ipqueue_pop(IndexedPQ *pq, size_t *out_id, int *out_priority);
+
+/** Views the id with the smallest priority. @param out_priority Can be NULL. @return 0 on success, -1 if empty. */
+int ipqueue_peek(const IndexedPQ *pq, size_t *out_id, int *out_priority);
+
+/** Lowers the priority of a queued id. @return 0 on success, -1 on error (absent or priority higher). */
+int ipqueue_decrease_key(IndexedPQ *pq, size_t id, int priority);
+
+/** Raises the priority of a queued id. @return 0 on success, -1 on error (absent or priority lower). */
+int ipqueue_increase_key(IndexedPQ *pq, size_t id, int priority);
+
+/** Removes a queued id. @param out_priority Can be NULL. @return 0 if removed, -1 if absent. */
+int ipqueue_remove(IndexedPQ *pq, size_t id, int *out_priority);
+
+/** Checks whether id is queued. @return 1 if queued, 0 otherwise. */
+int ipqueue_contains(const IndexedPQ *pq, size_t id);
+
+/** Looks up the priority of a queued id. @return 0 if found, -1 otherwise. */
+int ipqueue_priority(const IndexedPQ *pq, size_t id, int *out_priority);
+
+/** Returns number of queued ids. */
+size_t ipqueue_size(const IndexedPQ *pq);
+
+/** Returns the id bound given at creation. */
+size_t ipqueue_max_ids(const IndexedPQ *pq);
+
+/** Checks if empty. @return 1 if empty, 0 otherwise. */
+int ipqueue_is_empty(const IndexedPQ *pq);
+
+/** Removes all ids in O(size), not O(max_ids). */
+void ipqueue_clear(IndexedPQ *pq);
+
+/** Prints queue for debugging. */
+void ipqueue_print(const IndexedPQ *pq);
+
+#endif // INDEXED_PQUEUE_H
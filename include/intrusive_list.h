@@ -0,0 +1,89 @@
+#ifndef INTRUSIVE_LIST_H
+#define INTRUSIVE_LIST_H
+
+#include <stddef.h>
+
+/**
+ * Intrusive doubly linked list: callers embed an IListLink in their own
+ * struct (one per list the object can be on) and the list only relinks
+ * those fields, so membership never allocates. Recover the object from
+ * a link with ILIST_ENTRY:
+ *
+ *     typedef struct Task { int id; IListLink by_owner; IListLink by_prio; } Task;
+ *     IList owned = ILIST_INIT;
+ *     ilist_push_back(&owned, &task->by_owner);
+ *     for (IListLink *l = ilist_front(&owned); l; l = ilist_next(l)) {
+ *         Task *t = ILIST_ENTRY(l, Task, by_owner);
+ *     }
+ *
+ * A link may be on at most one list at a time. The list does not own
+ * the objects: clearing or dropping a list never frees anything.
+ */
+typedef struct IListLink {
+    struct IListLink *next;
+    struct IListLink *prev;
+} IListLink;
+
+/** List head. Fields are private; initialize with ILIST_INIT or ilist_init. */
+typedef struct IList {
+    IListLink *head;
+    IListLink *tail;
+    size_t size;
+} IList;
+
+/** Static initializer for an empty list. */
+#define ILIST_INIT { NULL, NULL, 0 }
+
+/** Recovers the enclosing object of type `type` whose field `member` is `link`. */
+#define ILIST_ENTRY(link, type, member) \
+    ((type*)((char*)(link) - offsetof(type, member)))
+
+/** Empties the list (linked objects are not touched). */
+void ilist_init(IList *list);
+
+/** Links at the front. @return 0 on success, -1 on error. */
+int ilist_push_front(IList *list, IListLink *link);
+
+/** Links at the back. @return 0 on success, -1 on error. */
+int ilist_push_back(IList *list, IListLink *link);
+
+/** Unlinks the front link. @return The link, or NULL if empty. */
+IListLink *ilist_pop_front(IList *list);
+
+/** Unlinks the back link. @return The link, or NULL if empty. */
+IListLink *ilist_pop_back(IList *list);
+
+/** Links before `at` (at == NULL appends). @return 0 on success, -1 on error. */
+int ilist_insert_before(IList *list, IListLink *at, IListLink *link);
+
+/** Links after `at` (at == NULL prepends). @return 0 on success, -1 on error. */
+int ilist_insert_after(IList *list, IListLink *at, IListLink *link);
+
+/** Unlinks a link that is on this list, in O(1). @return 0 on success, -1 on error. */
+int ilist_remove(IList *list, IListLink *link);
+
+/** Returns the front link, or NULL if empty. */
+IListLink *ilist_front(const IList *list);
+
+/** Returns the back link, or NULL if empty. */
+IListLink *ilist_back(const IList *list);
+
+/** Returns the link after `link`, or NULL at the back. */
+IListLink *ilist_next(const IListLink *link);
+
+/** Returns the link before `link`, or NULL at the front. */
+IListLink *ilist_prev(const IListLink *link);
+
+/** Returns number of links. */
+size_t ilist_size(const IList *list);
+
+/** Checks if list is empty. @return 1 if empty, 0 otherwise. */
+int ilist_is_empty(const IList *list);
+
+/** Reverses the list in place. */
+void ilist_reverse(IList *list);
+
+/** Moves all of src to the back of dst in O(1). @return 0 on success, -1 on error. */
+int ilist_splice(IList *dst, IList *src);
+
+#endif // INTRUSIVE_LIST_H
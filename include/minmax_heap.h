@@ -0,0 +1,46 @@
+#ifndef MINMAX_HEAP_H
+#define MINMAX_HEAP_H
+
+#include <stddef.h>
+
+/**
+ * Double-ended priority queue (min-max heap): even levels are min levels,
+ * odd levels are max levels. Both the smallest and the largest element
+ * are visible in O(1) and either can be popped in O(log n).
+ */
+typedef struct MinMaxHeap MinMaxHeap;
+
+/** Creates an empty heap (capacity 0 picks a default). @return Heap or NULL. */
+MinMaxHeap *mmheap_create(size_t capacity);
+
+/** Frees all heap memory. */
+void mmheap_destroy(MinMaxHeap *heap);
+
+/** Pushes element. @return 0 on success, -1 on error. */
+int mmheap_push(MinMaxHeap *heap, int value);
+
+/** Removes the smallest element. @return 0 on success, -1 if empty. */
+int mmheap_pop_min(MinMaxHeap *heap, int *out_value);
+
+/** Removes the largest element. @return 0 on success, -1 if empty. */
+int mmheap_pop_max(MinMaxHeap *heap, int *out_value);
+
+/** Views the smallest element. @return 0 on success, -1 if empty. */
+int mmheap_peek_min(const MinMaxHeap *heap, int *out_value);
+
+/** Views the largest element. @return 0 on success, -1 if empty. */
+int mmheap_peek_max(const MinMaxHeap *heap, int *out_value);
+
+/** Returns number of elements. */
+size_t mmheap_size(const MinMaxHeap *heap);
+
+/** Checks if empty. @return 1 if empty, 0 otherwise. */
+int mmheap_is_empty(const MinMaxHeap *heap);
+
+/** Removes all elements. */
+void mmheap_clear(MinMaxHeap *heap);
+
+/** Prints heap for debugging. */
+void mmheap_print(const MinMaxHeap *heap);
+
+#endif // MINMAX_HEAP_H
@@ -0,0 +1,60 @@
+#ifndef PAIRING_HEAP_H
+#define PAIRING_HEAP_H
+
+#include <stddef.h>
+
+/**
+ * Min pairing heap of ints. Push and meld are O(1); pop and decrease-key
+ * are amortized O(log n). Nodes come from slabs owned by the heap, so
+ * push and pop rarely touch malloc. Melding moves the slabs as well, so
+ * handles from either heap stay valid afterwards.
+ *
+ *     PHeapNode *h = pheap_push(heap, 40);
+ *     pheap_decrease_key(heap, h, 7);   // no search, amortized O(log n)
+ */
+typedef struct PairingHeap PairingHeap;
+
+/** Handle to a queued value. Invalid once that value has been popped. */
+typedef struct PHeapNode PHeapNode;
+
+/** Creates an empty heap. @return Heap or NULL. */
+PairingHeap *pheap_create(void);
+
+/** Frees the heap and its node slabs. */
+void pheap_destroy(PairingHeap *heap);
+
+/** Inserts value in O(1). @return Handle for decrease-key, or NULL on error. */
+PHeapNode *pheap_push(PairingHeap *heap, int value);
+
+/** Removes the smallest value. @return 0 on success, -1 if empty. */
+int pheap_pop(PairingHeap *heap, int *out_value);
+
+/** Views the smallest value. @return 0 on success, -1 if empty. */
+int pheap_peek(const PairingHeap *heap, int *out_value);
+
+/** Lowers a queued value. @return 0 on success, -1 on error (value higher). */
+int pheap_decrease_key(PairingHeap *heap, PHeapNode *node, int value);
+
+/** Returns the value behind a handle. */
+int pheap_node_value(const PHeapNode *node);
+
+/**
+ * Moves every value of src into dst in O(1) and frees src.
+ * Handles returned by either heap remain valid in dst.
+ * @return 0 on success, -1 on error (src untouched, or dst == src)
+ */
+int pheap_meld(PairingHeap *dst, PairingHeap *src);
+
+/** Returns number of values. */
+size_t pheap_size(const PairingHeap *heap);
+
+/** Checks if empty. @return 1 if empty, 0 otherwise. */
+int pheap_is_empty(const PairingHeap *heap);
+
+/** Removes all values (nodes return to the slabs). */
+void pheap_clear(PairingHeap *heap);
+
+/** Prints the heap in tree pre-order for debugging. */
+void pheap_print(const PairingHeap *heap);
+
+#endif // PAIRING_HEAP_H
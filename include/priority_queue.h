@@ -2,23 +2,110 @@
 #define PRIORITY_QUEUE_H
 
 #include <stddef.h>
+#include "growth.h"
 
-/** Binary min-heap (O(log n) push/pop, stack-safe iterative heapify). */
+/** Array-backed min- or max-heap (O(log n) push/pop, stack-safe iterative heapify). */
 typedef struct PriorityQueue PriorityQueue;
 
-/** Creates a priority queue. @return Queue or NULL. */
+/** Which end of the order the queue serves first. */
+typedef enum {
+    PQUEUE_MIN,  /* Smallest value on top (default) */
+    PQUEUE_MAX   /* Largest value on top */
+} PQueueOrder;
+
+/** Creates a binary-heap priority queue. @return Queue or NULL. */
 PriorityQueue *pqueue_create(size_t capacity);
 
+/**
+ * Creates a d-ary heap (arity 2, 4 or 8). A 4-ary heap is half as deep
+ * as a binary one and an 8-ary heap a third. The children of node i sit
+ * at data[arity * i + 1 .. arity * i + arity]; the buffer is padded so
+ * each such group starts on a multiple of its own size in memory (16
+ * bytes for 4, 32 bytes for 8) and never straddles a 64-byte cache line.
+ * Groups are scanned with SIMD.
+ * Zero-copy views keep the caller's layout until they first grow.
+ * Pops compare more children per level, so 4 is usually the sweet spot
+ * for large heaps.
+ * @return Queue or NULL (also for an unsupported arity)
+ */
+PriorityQueue *pqueue_create_with_arity(size_t capacity, unsigned arity);
+
+/** Creates a binary max-heap (no negating values, so INT_MIN works). @return Queue or NULL. */
+PriorityQueue *pqueue_create_max(size_t capacity);
+
+/**
+ * Creates a heap with the given arity (2, 4 or 8) and order. Each
+ * arity/order pair runs its own specialized sift loops with the
+ * comparison fixed at compile time; there is no comparator call.
+ * @return Queue or NULL (also for an unsupported arity or order)
+ */
+PriorityQueue *pqueue_create_with_order(size_t capacity, unsigned arity,
+                                        PQueueOrder order);
+
+/**
+ * Creates a binary heap holding a copy of values, built bottom-up in
+ * O(n) (Floyd) instead of n pushes at O(log n) each.
+ * @return Queue or NULL
+ */
+PriorityQueue *pqueue_create_from_array(const int *values, size_t n);
+
+/** Returns the heap arity (children per node), 0 for NULL. */
+unsigned pqueue_arity(const PriorityQueue *pq);
+
+/** Returns the heap order (PQUEUE_MIN for NULL). */
+PQueueOrder pqueue_order(const PriorityQueue *pq);
+
 /** Frees all queue memory. */
 void pqueue_destroy(PriorityQueue *pq);
 
+/** Sets the growth policy used when the heap is full. @return 0 on success, -1 on error. */
+int pqueue_set_growth_policy(PriorityQueue *pq, GrowthPolicy policy);
+
+/** Writes queue (heap order, arity and min/max preserved) to fd. @return 0 on success, -1 on error. */
+int pqueue_save_fd(const PriorityQueue *pq, int fd);
+
+/** Reads a queue written by pqueue_save_fd (validates heap order). @return Queue or NULL. */
+PriorityQueue *pqueue_load_fd(int fd);
+
+/** Wraps a serialized buffer without copying; pushes past its size copy out. @return Queue or NULL. */
+PriorityQueue *pqueue_view_from_buffer(void *buf, size_t len);
+
 /** Pushes element. @return 0 on success, -1 on error. */
 int pqueue_push(PriorityQueue *pq, int value);
 
-/** Removes min element. @return 0 on success, -1 on error. */
+/** Removes the top element (min, or max for a max-heap). @return 0 on success, -1 on error. */
 int pqueue_pop(PriorityQueue *pq, int *out_value);
 
-/** Views min element. @return 0 on success, -1 on error. */
+/**
+ * Pushes n values. Large batches (relative to the queue) append and
+ * rebuild the heap in O(size + n); small ones sift each value up.
+ * @return 0 on success, -1 on error (queue unchanged)
+ */
+int pqueue_push_n(PriorityQueue *pq, const int *values, size_t n);
+
+/**
+ * Adds every element of src to dst (src is left unchanged). Uses the same
+ * bulk path as pqueue_push_n, so merging queues of similar size costs
+ * O(n) instead of n pops and pushes. The result follows dst's order.
+ * @return 0 on success, -1 on error (dst unchanged, or dst == src)
+ */
+int pqueue_merge(PriorityQueue *dst, const PriorityQueue *src);
+
+/**
+ * Replaces the top element with value in a single sift (cheaper than pop
+ * then push). @param out_value Can be NULL; receives the old top.
+ * @return 0 on success, -1 on error (empty)
+ */
+int pqueue_replace_top(PriorityQueue *pq, int value, int *out_value);
+
+/**
+ * Pops the top k elements into out in priority order (ascending for a
+ * min-heap, descending for a max-heap).
+ * All or nothing. @return 0 on success, -1 on error (fewer than k elements).
+ */
+int pqueue_pop_n(PriorityQueue *pq, int *out, size_t k);
+
+/** Views the top element. @return 0 on success, -1 on error. */
 int pqueue_peek(const PriorityQueue *pq, int *out_value);
 
 /** Returns number of elements. */
@@ -27,6 +114,12 @@ size_t pqueue_size(const PriorityQueue *pq);
 /** Returns total capacity. */
 size_t pqueue_capacity(const PriorityQueue *pq);
 
+/**
+ * Returns the heap array in level order (valid until the next mutating
+ * call): the root at [0], the children of i at [arity * i + 1 ...].
+ */
+const int *pqueue_data(const PriorityQueue *pq);
+
 /** Checks if empty. @return 1 if empty, 0 otherwise. */
 int pqueue_is_empty(const PriorityQueue *pq);
 
@@ -2,6 +2,7 @@
 #define QUEUE_H
 
 #include <stddef.h>
+#include "container_iter.h"
 
 /** FIFO data structure (First In, First Out) - linked-list based. */
 typedef struct Queue Queue;
@@ -30,6 +31,9 @@ int queue_is_empty(const Queue *queue);
 /** Removes all elements. */
 void queue_clear(Queue *queue);
 
+/** Starts a read-only front-to-rear traversal, one node per span. @return 0 on success, -1 on error. */
+int queue_iter_init(const Queue *queue, ContainerIter *it);
+
 /** Prints queue for debugging. */
 void queue_print(const Queue *queue);
 
@@ -0,0 +1,51 @@
+#ifndef RADIX_HEAP_H
+#define RADIX_HEAP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Monotone min-priority queue: every pushed key must be >= the last
+ * popped key (event times, Dijkstra distances). Keys sit in 65 buckets
+ * by the highest bit in which they differ from the last popped key, so
+ * each key moves down at most 64 times over its life: amortized O(1)
+ * push and O(log C) pop with no comparisons against other keys.
+ * Same push/pop/peek interface as priority_queue.h, plus uint64_t keys.
+ * Use either the int or the uint64_t functions on one heap, not both.
+ */
+typedef struct RadixHeap RadixHeap;
+
+/** Creates an empty heap. @return Heap or NULL. */
+RadixHeap *radixheap_create(void);
+
+/** Frees all heap memory. */
+void radixheap_destroy(RadixHeap *heap);
+
+/** Pushes element. @return 0 on success, -1 on error (below the last popped value). */
+int radixheap_push(RadixHeap *heap, int value);
+
+/** Removes min element. @return 0 on success, -1 on error. */
+int radixheap_pop(RadixHeap *heap, int *out_value);
+
+/** Views min element. @return 0 on success, -1 on error. */
+int radixheap_peek(const RadixHeap *heap, int *out_value);
+
+/** Pushes a 64-bit key. @return 0 on success, -1 on error (below the last popped key). */
+int radixheap_push_u64(RadixHeap *heap, uint64_t key);
+
+/** Removes the min 64-bit key. @return 0 on success, -1 on error. */
+int radixheap_pop_u64(RadixHeap *heap, uint64_t *out_key);
+
+/** Views the min 64-bit key. @return 0 on success, -1 on error. */
+int radixheap_peek_u64(const RadixHeap *heap, uint64_t *out_key);
+
+/** Returns number of elements. */
+size_t radixheap_size(const RadixHeap *heap);
+
+/** Checks if empty. @return 1 if empty, 0 otherwise. */
+int radixheap_is_empty(const RadixHeap *heap);
+
+/** Removes all elements and resets the monotone floor. */
+void radixheap_clear(RadixHeap *heap);
+
+#endif // RADIX_HEAP_H
@@ -2,6 +2,7 @@
 #define RING_BUFFER_H
 
 #include <stddef.h>
+#include "container_iter.h"
 
 /** Fixed-size circular buffer with wraparound. */
 typedef struct RingBuffer RingBuffer;
@@ -36,6 +37,9 @@ int ring_buffer_is_full(const RingBuffer *rb);
 /** Clears buffer (resets read/write pointers). */
 void ring_buffer_clear(RingBuffer *rb);
 
+/** Starts a read-only oldest-to-newest traversal: at most two spans (before/after wraparound). @return 0 on success, -1 on error. */
+int ring_buffer_iter_init(const RingBuffer *rb, ContainerIter *it);
+
 /** Prints buffer for debugging. */
 void ring_buffer_print(const RingBuffer *rb);
 
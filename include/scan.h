@@ -0,0 +1,51 @@
+#ifndef SCAN_H
+#define SCAN_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Reduction, prefix-sum and histogram kernels over raw int spans.
+ * Works on any contiguous data, e.g. array_data()/array_size() or
+ * static_array_data()/static_array_capacity(). Uses SSE2 where available.
+ * All sums accumulate in 64 bits, so they cannot overflow for n < 2^32.
+ */
+
+/** Returns the sum of n values (0 for an empty or NULL span). */
+int64_t scan_sum(const int *data, size_t n);
+
+/** Finds the smallest value. @return 0 on success, -1 on error (empty). */
+int scan_min(const int *data, size_t n, int *out_value);
+
+/** Finds the largest value. @return 0 on success, -1 on error (empty). */
+int scan_max(const int *data, size_t n, int *out_value);
+
+/** Index of the first smallest value. @return 0 on success, -1 on error. */
+int scan_argmin(const int *data, size_t n, size_t *out_index);
+
+/** Index of the first largest value. @return 0 on success, -1 on error. */
+int scan_argmax(const int *data, size_t n, size_t *out_index);
+
+/**
+ * Inclusive prefix sum: out[i] = in[0] + ... + in[i].
+ * @return 0 on success, -1 on error
+ */
+int scan_prefix_sum_inclusive(const int *in, int64_t *out, size_t n);
+
+/**
+ * Exclusive prefix sum: out[0] = 0, out[i] = in[0] + ... + in[i - 1].
+ * @return 0 on success, -1 on error
+ */
+int scan_prefix_sum_exclusive(const int *in, int64_t *out, size_t n);
+
+/**
+ * Counts values into bins[v - min_value] for v in [min_value, min_value + num_bins).
+ * Counts are added to bins (zero it first for a fresh histogram).
+ * Interleaved sub-histograms keep runs of equal values from stalling on
+ * store-to-load forwarding of the same counter.
+ * @return Number of values outside the range
+ */
+size_t scan_histogram(const int *data, size_t n, int min_value,
+                      size_t num_bins, uint64_t *bins);
+
+#endif // SCAN_H
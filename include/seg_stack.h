@@ -0,0 +1,51 @@
+#ifndef SEG_STACK_H
+#define SEG_STACK_H
+
+#include <stddef.h>
+
+/**
+ * Segmented LIFO stack: a chain of fixed-size chunks.
+ * Growth links a new chunk instead of reallocating, so existing
+ * elements are never copied and push/pop stay O(1) worst case.
+ * One emptied chunk is kept as a spare so push/pop at a chunk boundary
+ * does not allocate and free on every call.
+ */
+typedef struct SegStack SegStack;
+
+/** Creates an empty stack (default 1024 elements per chunk). @return Stack or NULL. */
+SegStack *seg_stack_create(void);
+
+/** Creates a stack with a specific chunk size in elements (0 = default). @return Stack or NULL. */
+SegStack *seg_stack_create_with_chunk_size(size_t chunk_size);
+
+/** Frees all chunks. */
+void seg_stack_destroy(SegStack *stack);
+
+/** Pushes element onto stack. @return 0 on success, -1 on error. */
+int seg_stack_push(SegStack *stack, int value);
+
+/** Pops element from stack. @return 0 on success, -1 on error. */
+int seg_stack_pop(SegStack *stack, int *out_value);
+
+/** Views top element without removing. @return 0 on success, -1 on error. */
+int seg_stack_peek(const SegStack *stack, int *out_value);
+
+/** Returns number of elements. */
+size_t seg_stack_size(const SegStack *stack);
+
+/** Returns elements per chunk. */
+size_t seg_stack_chunk_size(const SegStack *stack);
+
+/** Returns number of chunks currently allocated (including the spare). */
+size_t seg_stack_chunk_count(const SegStack *stack);
+
+/** Checks if stack is empty. @return 1 if empty, 0 otherwise. */
+int seg_stack_is_empty(const SegStack *stack);
+
+/** Removes all elements, keeping one chunk and the spare. */
+void seg_stack_clear(SegStack *stack);
+
+/** Prints stack for debugging. */
+void seg_stack_print(const SegStack *stack);
+
+#endif // SEG_STACK_H
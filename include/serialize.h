@@ -0,0 +1,77 @@
+#ifndef SERIALIZE_H
+#define SERIALIZE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Versioned binary format shared by all containers:
+ * a 64-byte little-endian header followed by the raw little-endian
+ * payload. The payload starts at offset 64, so a buffer (or mmap) that
+ * is 64-byte aligned yields a cache-line aligned payload that containers
+ * can use in place (see the *_view_from_buffer constructors).
+ */
+
+#define SERIAL_MAGIC "BOAX"
+#define SERIAL_VERSION 1
+#define SERIAL_HEADER_SIZE 64
+
+/** Container tag stored in the header. */
+typedef enum {
+    SERIAL_KIND_ARRAY = 1,
+    SERIAL_KIND_STATIC_ARRAY = 2,
+    SERIAL_KIND_ARRAY2D = 3,
+    SERIAL_KIND_BITSET = 4,
+    SERIAL_KIND_PQUEUE = 5,
+    SERIAL_KIND_STRING = 6
+} SerialKind;
+
+/** On-disk header (host order in memory, little-endian on disk). */
+typedef struct SerialHeader {
+    char magic[4];
+    uint16_t version;
+    uint16_t kind;
+    uint32_t elem_size; /* Bytes per payload element */
+    uint32_t flags;     /* Container-specific */
+    uint64_t count;     /* Payload elements */
+    uint64_t dim;       /* Second dimension (Array2D cols, Bitset bits) */
+    uint64_t capacity;  /* Elements reserved after the header (>= count) */
+    uint8_t reserved[24];
+} SerialHeader;
+
+/** Fills a header for `count` elements of `elem_size` bytes. */
+void serial_header_init(SerialHeader *header, SerialKind kind,
+                        size_t elem_size, size_t count);
+
+/**
+ * Checks magic, version, kind and element size.
+ * @return 0 if valid, -1 otherwise
+ */
+int serial_header_check(const SerialHeader *header, SerialKind kind,
+                        size_t elem_size);
+
+/**
+ * Writes header and payload to fd (handles short writes).
+ * @return 0 on success, -1 on error
+ */
+int serial_write(int fd, const SerialHeader *header, const void *payload);
+
+/** Reads and validates a header from fd. @return 0 on success, -1 on error. */
+int serial_read_header(int fd, SerialHeader *header, SerialKind kind,
+                       size_t elem_size);
+
+/**
+ * Reads `count` elements following a header into dst.
+ * @return 0 on success, -1 on error (short read)
+ */
+int serial_read_payload(int fd, void *dst, size_t elem_size, size_t count);
+
+/**
+ * Validates a serialized buffer for zero-copy use.
+ * Fails on big-endian hosts, truncated buffers and misaligned payloads.
+ * @return Pointer to the payload inside buf, or NULL on error
+ */
+void *serial_view(void *buf, size_t len, SerialHeader *out_header,
+                  SerialKind kind, size_t elem_size);
+
+#endif // SERIALIZE_H
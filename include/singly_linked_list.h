@@ -2,8 +2,9 @@
 #define SINGLY_LINKED_LIST_H
 
 #include <stddef.h>
+#include "container_iter.h"
 
-/** Single-direction linked list with O(1) front operations. */
+/** Single-direction linked list with O(1) front operations and appends. */
 typedef struct SinglyLinkedList SinglyLinkedList;
 
 /** Creates an empty list. @return List pointer or NULL. */
@@ -15,13 +16,13 @@ void slist_destroy(SinglyLinkedList *list);
 /** Adds element to front. @return 0 on success, -1 on error. */
 int slist_push_front(SinglyLinkedList *list, int value);
 
-/** Adds element to back. @return 0 on success, -1 on error. */
+/** Adds element to back in O(1) (tail pointer). @return 0 on success, -1 on error. */
 int slist_push_back(SinglyLinkedList *list, int value);
 
 /** Removes and returns front element. @return 0 on success, -1 on error. */
 int slist_pop_front(SinglyLinkedList *list, int *out_value);
 
-/** Removes and returns back element. @return 0 on success, -1 on error. */
+/** Removes and returns back element (O(n): walks to the predecessor). @return 0 on success, -1 on error. */
 int slist_pop_back(SinglyLinkedList *list, int *out_value);
 
 /** Inserts element after index. @return 0 on success, -1 on error. */
@@ -30,10 +31,17 @@ int slist_insert_after(SinglyLinkedList *list, size_t index, int value);
 /** Removes element at index. @return 0 on success, -1 on error. */
 int slist_remove_at(SinglyLinkedList *list, size_t index, int *out_value);
 
-/** Gets element at index. @return 0 on success, -1 on error. */
+/**
+ * Gets element at index. Walks on from the last position reached by
+ * index when that is not past it, so ascending loops are O(1) per step.
+ * This updates the cache even through a const list, so concurrent
+ * slist_get calls on one list race; readers sharing a list across threads
+ * need a lock or the read-only slist_iter_init traversal.
+ * @return 0 on success, -1 on error
+ */
 int slist_get(const SinglyLinkedList *list, size_t index, int *out_value);
 
-/** Sets element at index. @return 0 on success, -1 on error. */
+/** Sets element at index (same cached position as slist_get). @return 0 on success, -1 on error. */
 int slist_set(SinglyLinkedList *list, size_t index, int value);
 
 /** Returns number of elements. */
@@ -51,6 +59,22 @@ void slist_clear(SinglyLinkedList *list);
 /** Reverses list in-place. */
 void slist_reverse(SinglyLinkedList *list);
 
+/**
+ * Builds a list holding a copy of values, with all nodes carved from one
+ * allocation (nodes released later are reused by the same list).
+ * @return List pointer or NULL
+ */
+SinglyLinkedList *slist_from_array(const int *values, size_t count);
+
+/** Copies the elements in order into out (size elements). @return 0 on success, -1 on error. */
+int slist_to_array(const SinglyLinkedList *list, int *out);
+
+/** Sorts ascending in place (stable bottom-up merge sort, O(n log n), O(1) extra space). */
+void slist_sort(SinglyLinkedList *list);
+
+/** Starts a read-only head-to-tail traversal, replacing O(n^2) slist_get loops. @return 0 on success, -1 on error. */
+int slist_iter_init(const SinglyLinkedList *list, ContainerIter *it);
+
 /** Prints list for debugging. */
 void slist_print(const SinglyLinkedList *list);
 
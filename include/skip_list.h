@@ -0,0 +1,74 @@
+#ifndef SKIP_LIST_H
+#define SKIP_LIST_H
+
+#include <stddef.h>
+#include "container_iter.h"
+
+/**
+ * Ordered map from int keys to int values (use any value for a set).
+ * Randomized towers give expected O(log n) insert/erase/find and O(1)
+ * steps between neighbors for range scans. Towers come from per-height
+ * pools carved out of slabs, so churn reuses nodes instead of calling
+ * malloc/free.
+ */
+typedef struct SkipList SkipList;
+
+/** Position in an ascending key range (see skiplist_range_init). */
+typedef struct SkipListRange {
+    const struct SkipNode *node;
+    int hi;
+} SkipListRange;
+
+/** Creates an empty skip list. @return List pointer or NULL. */
+SkipList *skiplist_create(void);
+
+/** Creates a skip list with a fixed random seed (reproducible towers). @return List pointer or NULL. */
+SkipList *skiplist_create_seeded(unsigned long seed);
+
+/** Frees the list and its node pools. */
+void skiplist_destroy(SkipList *list);
+
+/** Inserts key, or overwrites its value if present. @return 0 on success, -1 on error. */
+int skiplist_insert(SkipList *list, int key, int value);
+
+/** Looks up key. @param out_value Can be NULL. @return 0 if found, -1 otherwise. */
+int skiplist_find(const SkipList *list, int key, int *out_value);
+
+/** Checks whether key is present. @return 1 if present, 0 otherwise. */
+int skiplist_contains(const SkipList *list, int key);
+
+/** Removes key. @param out_value Can be NULL. @return 0 if removed, -1 if absent. */
+int skiplist_erase(SkipList *list, int key, int *out_value);
+
+/** Smallest entry. @param out_value Can be NULL. @return 0 on success, -1 if empty. */
+int skiplist_min(const SkipList *list, int *out_key, int *out_value);
+
+/** Largest entry. @param out_value Can be NULL. @return 0 on success, -1 if empty. */
+int skiplist_max(const SkipList *list, int *out_key, int *out_value);
+
+/** Returns number of entries. */
+size_t skiplist_size(const SkipList *list);
+
+/** Checks if list is empty. @return 1 if empty, 0 otherwise. */
+int skiplist_is_empty(const SkipList *list);
+
+/** Removes all entries (nodes return to the pools). */
+void skiplist_clear(SkipList *list);
+
+/**
+ * Starts an ascending scan over keys in [lo, hi]. Seeking to lo is
+ * O(log n); each step after that is O(1).
+ * @return 0 on success, -1 on error
+ */
+int skiplist_range_init(const SkipList *list, int lo, int hi, SkipListRange *range);
+
+/** Yields the next entry in range. @param out_value Can be NULL. @return 0 on success, -1 when done. */
+int skiplist_range_next(SkipListRange *range, int *out_key, int *out_value);
+
+/** Starts a read-only traversal of the keys in ascending order, one per span. @return 0 on success, -1 on error. */
+int skiplist_iter_init(const SkipList *list, ContainerIter *it);
+
+/** Prints list for debugging. */
+void skiplist_print(const SkipList *list);
+
+#endif // SKIP_LIST_H
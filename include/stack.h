@@ -2,19 +2,39 @@
 #define STACK_H
 
 #include <stddef.h>
+#include "growth.h"
+#include "container_iter.h"
 
 /** LIFO data structure (Last In, First Out). */
 typedef struct Stack Stack;
 
+/** Elements held inside the stack struct before spilling to the heap. */
+#define STACK_INLINE_CAPACITY 16
+
+/** Bytes reserved by StackStorage (checked at compile time). */
+#define STACK_STORAGE_SIZE (10 * sizeof(void*) + STACK_INLINE_CAPACITY * sizeof(int))
+
+/** Caller-provided memory for stack_init. Contents are private; do not copy while in use. */
+typedef union StackStorage {
+    max_align_t align;
+    unsigned char bytes[STACK_STORAGE_SIZE];
+} StackStorage;
+
 /** Creates an empty stack (default capacity 16). @return Stack or NULL. */
 Stack *stack_create(void);
 
-/** Creates a stack with specific capacity. @return Stack or NULL. */
+/** Creates a stack with specific capacity (up to 16 stored inline). @return Stack or NULL. */
 Stack *stack_create_with_capacity(size_t capacity);
 
-/** Frees all stack memory. */
+/** Creates a stack inside caller storage, heap-free until it exceeds 16 elements. @return Stack or NULL. */
+Stack *stack_init(StackStorage *storage, size_t capacity);
+
+/** Frees all stack memory (for stack_init stacks, only the heap buffer). */
 void stack_destroy(Stack *stack);
 
+/** Sets the growth policy used when the stack is full. @return 0 on success, -1 on error. */
+int stack_set_growth_policy(Stack *stack, GrowthPolicy policy);
+
 /** Pushes element onto stack. @return 0 on success, -1 on error. */
 int stack_push(Stack *stack, int value);
 
@@ -24,6 +44,21 @@ int stack_pop(Stack *stack, int *out_value);
 /** Views top element without removing. @return 0 on success, -1 on error. */
 int stack_peek(const Stack *stack, int *out_value);
 
+/** Ensures room for `capacity` elements without further growth. @return 0 on success, -1 on error. */
+int stack_reserve(Stack *stack, size_t capacity);
+
+/** Pushes n values in order (values[n - 1] ends on top), one copy. @return 0 on success, -1 on error. */
+int stack_push_n(Stack *stack, const int *values, size_t n);
+
+/**
+ * Pops the top n elements into out in push order (out[n - 1] was the top).
+ * All or nothing. @return 0 on success, -1 on error (fewer than n elements).
+ */
+int stack_pop_n(Stack *stack, int *out, size_t n);
+
+/** Copies the top n elements into out in push order without removing. @return 0 on success, -1 on error. */
+int stack_peek_n(const Stack *stack, int *out, size_t n);
+
 /** Returns number of elements. */
 size_t stack_size(const Stack *stack);
 
@@ -36,6 +71,9 @@ int stack_is_empty(const Stack *stack);
 /** Removes all elements (keeps capacity). */
 void stack_clear(Stack *stack);
 
+/** Starts a read-only bottom-to-top traversal, one span. @return 0 on success, -1 on error. */
+int stack_iter_init(const Stack *stack, ContainerIter *it);
+
 /** Prints stack for debugging. */
 void stack_print(const Stack *stack);
 
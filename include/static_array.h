@@ -2,6 +2,7 @@
 #define STATIC_ARRAY_H
 
 #include <stddef.h>
+#include "container_iter.h"
 
 /**
  * Fixed-size array (no dynamic resizing).
@@ -20,6 +21,25 @@ StaticArray* static_array_create(size_t capacity);
  */
 void static_array_destroy(StaticArray *arr);
 
+/**
+ * Writes the array to fd in the serialize.h binary format.
+ * @return 0 on success, -1 on error
+ */
+int static_array_save_fd(const StaticArray *arr, int fd);
+
+/**
+ * Reads an array written by static_array_save_fd.
+ * @return New array or NULL on error
+ */
+StaticArray* static_array_load_fd(int fd);
+
+/**
+ * Wraps a serialized buffer without copying (writes go to buf).
+ * buf must outlive the array.
+ * @return Array pointer or NULL on error
+ */
+StaticArray* static_array_view_from_buffer(void *buf, size_t len);
+
 /**
  * Sets element at index (overwrites existing).
  * @return 0 on success, -1 on error
@@ -49,6 +69,11 @@ int static_array_get(const StaticArray *arr, size_t index, int *out_value);
  */
 size_t static_array_capacity(const StaticArray *arr);
 
+/**
+ * Returns the element buffer (capacity elements).
+ */
+const int *static_array_data(const StaticArray *arr);
+
 /**
  * Finds first occurrence of a value.
  * @return Index of value, or -1 if not found
@@ -67,6 +92,12 @@ int static_array_copy(StaticArray *dest, const StaticArray *src);
  */
 int static_array_reverse(StaticArray *arr);
 
+/**
+ * Starts a read-only traversal over all capacity slots (one span).
+ * @return 0 on success, -1 on error
+ */
+int static_array_iter_init(const StaticArray *arr, ContainerIter *it);
+
 /**
  * Prints the array (for debugging).
  */
@@ -0,0 +1,70 @@
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "intrusive_list.h"
+
+/**
+ * Hierarchical timing wheel: six levels of 64 slots, each slot 64x
+ * coarser than the one below. A timer lives in the slot covering its
+ * expiry; when the lower level wraps, the next slot up is cascaded down.
+ * Scheduling and cancelling are O(1) and never allocate: callers embed
+ * a Timer in their own struct (intrusive, like IListLink) and recover
+ * it in the callback with ILIST_ENTRY-style offsetof arithmetic.
+ *
+ *     typedef struct Conn { int fd; Timer idle; } Conn;
+ *     twheel_timer_init(&conn->idle, on_idle, conn);
+ *     twheel_schedule(wheel, &conn->idle, 30000);
+ *     twheel_cancel(wheel, &conn->idle);   // on activity, O(1)
+ */
+typedef struct TimerWheel TimerWheel;
+typedef struct Timer Timer;
+
+/** Called once when a timer expires; it may schedule or cancel any timer. */
+typedef void (*TimerCallback)(Timer *timer, void *ctx);
+
+/** Timer handle. Fields are private; initialize with twheel_timer_init. */
+struct Timer {
+    IListLink link;
+    IList *slot;        // List holding the timer, NULL when not pending
+    uint64_t expires;
+    TimerCallback callback;
+    void *ctx;
+};
+
+/** Prepares a timer that is not pending. */
+void twheel_timer_init(Timer *timer, TimerCallback callback, void *ctx);
+
+/** Creates a wheel whose clock starts at start_tick. @return Wheel or NULL. */
+TimerWheel *twheel_create(uint64_t start_tick);
+
+/** Frees the wheel. Pending timers are dropped without running. */
+void twheel_destroy(TimerWheel *wheel);
+
+/**
+ * Arms a timer to fire `delay` ticks from now (0 counts as 1). A pending
+ * timer is moved to the new deadline.
+ * @return 0 on success, -1 on error
+ */
+int twheel_schedule(TimerWheel *wheel, Timer *timer, uint64_t delay);
+
+/** Disarms a timer in O(1). @return 0 if it was pending, -1 otherwise. */
+int twheel_cancel(TimerWheel *wheel, Timer *timer);
+
+/** Checks whether a timer is armed. @return 1 if pending, 0 otherwise. */
+int twheel_is_pending(const Timer *timer);
+
+/**
+ * Moves the clock forward, firing timers in deadline order tick by tick.
+ * @return Number of timers fired
+ */
+size_t twheel_advance(TimerWheel *wheel, uint64_t ticks);
+
+/** Returns the current tick. */
+uint64_t twheel_now(const TimerWheel *wheel);
+
+/** Returns the number of pending timers. */
+size_t twheel_size(const TimerWheel *wheel);
+
+#endif // TIMER_WHEEL_H
@@ -0,0 +1,51 @@
+#ifndef TOPK_H
+#define TOPK_H
+
+#include <stddef.h>
+#include "priority_queue.h"
+
+/**
+ * Bounded top-K selector over a stream: keeps the K best values seen so
+ * far in a size-K PriorityQueue, so memory is O(K) however long the
+ * stream. Once K values are held, the worst of them is a threshold and
+ * anything not better costs one comparison; batches are pre-filtered
+ * against it with SIMD.
+ */
+typedef struct TopK TopK;
+
+/**
+ * Creates a selector for the k largest (PQUEUE_MAX) or k smallest
+ * (PQUEUE_MIN) values. Ties at the threshold keep the earlier value.
+ * @return Selector or NULL
+ */
+TopK *topk_create(size_t k, PQueueOrder order);
+
+/** Frees all selector memory. */
+void topk_destroy(TopK *tk);
+
+/** Offers one value. @return 1 if kept, 0 if rejected, -1 on error. */
+int topk_offer(TopK *tk, int value);
+
+/** Offers n values. @return Number kept (including ones later displaced), or 0 on error. */
+size_t topk_offer_n(TopK *tk, const int *values, size_t n);
+
+/** The worst value currently kept, once k are held. @return 0 on success, -1 if fewer than k. */
+int topk_threshold(const TopK *tk, int *out_value);
+
+/**
+ * Writes the kept values to out, best first (O(K log K)). The selector
+ * stays usable. @param out Room for topk_size() values.
+ * @return Number of values written
+ */
+size_t topk_result(TopK *tk, int *out);
+
+/** Returns the number of values kept (at most k). */
+size_t topk_size(const TopK *tk);
+
+/** Returns k. */
+size_t topk_k(const TopK *tk);
+
+/** Forgets all values. */
+void topk_clear(TopK *tk);
+
+#endif // TOPK_H
@@ -0,0 +1,72 @@
+#ifndef UNROLLED_LIST_H
+#define UNROLLED_LIST_H
+
+#include <stddef.h>
+#include "container_iter.h"
+
+/**
+ * Unrolled linked list: a singly linked chain of 64-byte (cache-line)
+ * nodes, each holding up to 13 ints. Offers the singly_linked_list.h
+ * operations. Indexed access skips whole nodes, so it costs O(n/B)
+ * pointer hops instead of O(n), and traversal reads contiguous runs.
+ */
+typedef struct UnrolledList UnrolledList;
+
+/** Creates an empty list. @return List pointer or NULL. */
+UnrolledList *ulist_create(void);
+
+/** Frees all list memory. */
+void ulist_destroy(UnrolledList *list);
+
+/** Adds element to front. @return 0 on success, -1 on error. */
+int ulist_push_front(UnrolledList *list, int value);
+
+/** Adds element to back (O(1), fills the tail node first). @return 0 on success, -1 on error. */
+int ulist_push_back(UnrolledList *list, int value);
+
+/** Removes and returns front element. @return 0 on success, -1 on error. */
+int ulist_pop_front(UnrolledList *list, int *out_value);
+
+/** Removes and returns back element. @return 0 on success, -1 on error. */
+int ulist_pop_back(UnrolledList *list, int *out_value);
+
+/** Inserts element at index (0 <= index <= size), splitting a full node. @return 0 on success, -1 on error. */
+int ulist_insert_at(UnrolledList *list, size_t index, int value);
+
+/** Inserts element after index. @return 0 on success, -1 on error. */
+int ulist_insert_after(UnrolledList *list, size_t index, int value);
+
+/** Removes element at index, merging underfull nodes. @return 0 on success, -1 on error. */
+int ulist_remove_at(UnrolledList *list, size_t index, int *out_value);
+
+/** Gets element at index. @return 0 on success, -1 on error. */
+int ulist_get(const UnrolledList *list, size_t index, int *out_value);
+
+/** Sets element at index. @return 0 on success, -1 on error. */
+int ulist_set(UnrolledList *list, size_t index, int value);
+
+/** Returns number of elements. */
+size_t ulist_size(const UnrolledList *list);
+
+/** Returns number of nodes. */
+size_t ulist_node_count(const UnrolledList *list);
+
+/** Checks if list is empty. @return 1 if empty, 0 otherwise. */
+int ulist_is_empty(const UnrolledList *list);
+
+/** Finds first occurrence of value. @return Index or -1. */
+int ulist_find(const UnrolledList *list, int value);
+
+/** Removes all elements (keeps list structure). */
+void ulist_clear(UnrolledList *list);
+
+/** Reverses list in-place. */
+void ulist_reverse(UnrolledList *list);
+
+/** Starts a read-only traversal yielding one span per node. @return 0 on success, -1 on error. */
+int ulist_iter_init(const UnrolledList *list, ContainerIter *it);
+
+/** Prints list for debugging. */
+void ulist_print(const UnrolledList *list);
+
+#endif // UNROLLED_LIST_H
@@ -1,23 +1,96 @@
+#define _GNU_SOURCE
 #include "../include/array.h"
+#include "../include/growth.h"
+#include "../include/serialize.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <stdint.h>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define ARRAY_HAVE_MAPPED_FILES 1
+#endif
+
+#if defined(__AVX512F__)
+#include <immintrin.h>
+#endif
 
 #define DEFAULT_CAPACITY 16
-#define GROWTH_FACTOR 2
+#define SELECT_SMALL 16
 
 struct DynamicArray {
     int *data;
     size_t size;
     size_t capacity;
+    GrowthPolicy growth;
+    GrowthStorage storage;
+    int readonly;
+    int fd;              // Backing file descriptor, -1 if not file-backed
+    SerialHeader *header; // Start of the file mapping (serialize.h format)
+    int in_place;        // Struct lives in caller storage (array_init)
+    int inline_data[ARRAY_INLINE_CAPACITY];
 };
 
+_Static_assert(sizeof(struct DynamicArray) <= sizeof(DynamicArrayStorage),
+               "DynamicArrayStorage too small for struct DynamicArray");
+
+#ifdef ARRAY_HAVE_MAPPED_FILES
+static size_t _mapped_bytes(size_t capacity) {
+    return SERIAL_HEADER_SIZE + capacity * sizeof(int);
+}
+
+static int _array_resize_mapped(struct DynamicArray *arr, size_t new_capacity) {
+    if (new_capacity > (SIZE_MAX - SERIAL_HEADER_SIZE) / sizeof(int)) {
+        return -1;
+    }
+    
+    size_t old_bytes = _mapped_bytes(arr->capacity);
+    size_t new_bytes = _mapped_bytes(new_capacity);
+    
+    if (ftruncate(arr->fd, (off_t)new_bytes) != 0) {
+        return -1;
+    }
+    
+    void *base = mremap(arr->header, old_bytes, new_bytes, MREMAP_MAYMOVE);
+    if (base == MAP_FAILED) {
+        if (ftruncate(arr->fd, (off_t)old_bytes) != 0) {
+            // File keeps the larger size; the old mapping is still valid
+        }
+        return -1;
+    }
+    
+    arr->header = base;
+    arr->header->capacity = new_capacity;
+    arr->data = (int*)((unsigned char*)base + SERIAL_HEADER_SIZE);
+    arr->capacity = new_capacity;
+    return 0;
+}
+#endif
+
 static int _array_resize(struct DynamicArray *arr, size_t new_capacity) {
     if (!arr || new_capacity < arr->size) {
         return -1;
     }
     
-    int *new_data = realloc(arr->data, new_capacity * sizeof(int));
+#ifdef ARRAY_HAVE_MAPPED_FILES
+    if (arr->fd >= 0) {
+        return _array_resize_mapped(arr, new_capacity);
+    }
+#endif
+    
+    // Growing within the embedded buffer only changes the bookkeeping
+    if (arr->storage == GROWTH_STORAGE_INLINE &&
+        new_capacity <= ARRAY_INLINE_CAPACITY) {
+        arr->capacity = new_capacity;
+        return 0;
+    }
+    
+    int *new_data = growth_realloc(arr->data, sizeof(int), arr->capacity,
+                                   &new_capacity, &arr->storage, &arr->growth);
     if (!new_data) {
         return -1;
     }
@@ -27,24 +100,73 @@ static int _array_resize(struct DynamicArray *arr, size_t new_capacity) {
     return 0;
 }
 
-DynamicArray* array_create(size_t capacity) {
+static int _array_grow(struct DynamicArray *arr, size_t required) {
+    size_t new_capacity = growth_next_capacity(&arr->growth, arr->capacity,
+                                               required, sizeof(int));
+    if (new_capacity == 0) {
+        return -1;
+    }
+    
+    return _array_resize(arr, new_capacity);
+}
+
+static void _array_init_fields(struct DynamicArray *arr, int in_place) {
+    arr->growth = growth_policy_default();
+    arr->storage = GROWTH_STORAGE_HEAP;
+    arr->readonly = 0;
+    arr->fd = -1;
+    arr->header = NULL;
+    arr->in_place = in_place;
+    arr->data = NULL;
+    arr->size = 0;
+    arr->capacity = 0;
+}
+
+static int _array_alloc_data(struct DynamicArray *arr, size_t capacity) {
     if (capacity == 0) {
         capacity = DEFAULT_CAPACITY;
     }
     
+    if (capacity <= ARRAY_INLINE_CAPACITY) {
+        arr->storage = GROWTH_STORAGE_INLINE;
+        arr->data = arr->inline_data;
+    } else {
+        arr->data = growth_realloc(NULL, sizeof(int), 0, &capacity,
+                                   &arr->storage, &arr->growth);
+        if (!arr->data) {
+            return -1;
+        }
+    }
+    
+    arr->capacity = capacity;
+    return 0;
+}
+
+DynamicArray* array_create(size_t capacity) {
     struct DynamicArray *arr = malloc(sizeof(struct DynamicArray));
     if (!arr) {
         return NULL;
     }
     
-    arr->data = malloc(capacity * sizeof(int));
-    if (!arr->data) {
+    _array_init_fields(arr, 0);
+    if (_array_alloc_data(arr, capacity) != 0) {
         free(arr);
         return NULL;
     }
     
-    arr->size = 0;
-    arr->capacity = capacity;
+    return arr;
+}
+
+DynamicArray* array_init(DynamicArrayStorage *storage, size_t capacity) {
+    if (!storage) {
+        return NULL;
+    }
+    
+    struct DynamicArray *arr = (struct DynamicArray*)storage;
+    _array_init_fields(arr, 1);
+    if (_array_alloc_data(arr, capacity) != 0) {
+        return NULL;
+    }
     
     return arr;
 }
@@ -54,18 +176,257 @@ void array_destroy(DynamicArray *arr) {
         return;
     }
     
-    free(arr->data);
-    free(arr);
+#ifdef ARRAY_HAVE_MAPPED_FILES
+    if (arr->fd >= 0) {
+        if (!arr->readonly) {
+            arr->header->count = arr->size;
+        }
+        munmap(arr->header, _mapped_bytes(arr->capacity));
+        close(arr->fd);
+        free(arr);
+        return;
+    }
+#endif
+    
+    growth_free(arr->data, sizeof(int), arr->capacity, arr->storage);
+    if (!arr->in_place) {
+        free(arr);
+    }
 }
 
-int array_push(DynamicArray *arr, int value) {
+int array_set_growth_policy(DynamicArray *arr, GrowthPolicy policy) {
+    if (!arr || growth_policy_validate(&policy) != 0) {
+        return -1;
+    }
+    
+    arr->growth = policy;
+    return 0;
+}
+
+int array_reserve(DynamicArray *arr, size_t capacity) {
+    if (!arr || arr->readonly) {
+        return -1;
+    }
+    
+    if (capacity <= arr->capacity) {
+        return 0;
+    }
+    
+    return _array_resize(arr, capacity);
+}
+
+#ifdef ARRAY_HAVE_MAPPED_FILES
+static int _mapped_header_valid(const SerialHeader *header, size_t file_bytes) {
+    if (serial_header_check(header, SERIAL_KIND_ARRAY, sizeof(int)) != 0) {
+        return 0;
+    }
+    
+    size_t capacity = (file_bytes - SERIAL_HEADER_SIZE) / sizeof(int);
+    return header->capacity <= capacity;
+}
+
+DynamicArray* array_open_mapped(const char *path, int flags) {
+    if (!path) {
+        return NULL;
+    }
+    
+    int readonly = (flags & ARRAY_MAP_READONLY) != 0;
+    if (readonly && (flags & (ARRAY_MAP_CREATE | ARRAY_MAP_TRUNCATE))) {
+        return NULL;
+    }
+    
+    int open_flags = readonly ? O_RDONLY : O_RDWR;
+    if (flags & ARRAY_MAP_CREATE) {
+        open_flags |= O_CREAT;
+    }
+    if (flags & ARRAY_MAP_TRUNCATE) {
+        open_flags |= O_TRUNC;
+    }
+    
+    int fd = open(path, open_flags | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        return NULL;
+    }
+    
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return NULL;
+    }
+    
+    size_t file_bytes = (size_t)st.st_size;
+    int fresh = file_bytes == 0;
+    if (fresh) {
+        if (readonly) {
+            close(fd);
+            return NULL;
+        }
+        file_bytes = _mapped_bytes(DEFAULT_CAPACITY);
+        if (ftruncate(fd, (off_t)file_bytes) != 0) {
+            close(fd);
+            return NULL;
+        }
+    } else if (file_bytes < SERIAL_HEADER_SIZE) {
+        close(fd);
+        return NULL;
+    }
+    
+    int prot = readonly ? PROT_READ : PROT_READ | PROT_WRITE;
+    void *base = mmap(NULL, file_bytes, prot, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED) {
+        close(fd);
+        return NULL;
+    }
+    
+    SerialHeader *header = base;
+    if (fresh) {
+        serial_header_init(header, SERIAL_KIND_ARRAY, sizeof(int), 0);
+        header->capacity = DEFAULT_CAPACITY;
+    } else if (!_mapped_header_valid(header, file_bytes)) {
+        munmap(base, file_bytes);
+        close(fd);
+        return NULL;
+    }
+    
+    struct DynamicArray *arr = malloc(sizeof(struct DynamicArray));
+    if (!arr) {
+        munmap(base, file_bytes);
+        close(fd);
+        return NULL;
+    }
+    
+    _array_init_fields(arr, 0);
+    arr->storage = GROWTH_STORAGE_MAPPED;
+    arr->readonly = readonly;
+    arr->fd = fd;
+    arr->header = header;
+    arr->data = (int*)((unsigned char*)base + SERIAL_HEADER_SIZE);
+    arr->size = (size_t)header->count;
+    arr->capacity = (file_bytes - SERIAL_HEADER_SIZE) / sizeof(int);
+    
+    return arr;
+}
+
+int array_sync(DynamicArray *arr) {
+    if (!arr || arr->fd < 0) {
+        return -1;
+    }
+    
+    if (arr->readonly) {
+        return 0;
+    }
+    
+    arr->header->count = arr->size;
+    return msync(arr->header, _mapped_bytes(arr->capacity), MS_SYNC);
+}
+
+int array_advise(DynamicArray *arr, ArrayAdvice advice) {
+    if (!arr || arr->storage != GROWTH_STORAGE_MAPPED) {
+        return -1;
+    }
+    
+    int native;
+    switch (advice) {
+        case ARRAY_ADVICE_NORMAL:     native = MADV_NORMAL; break;
+        case ARRAY_ADVICE_SEQUENTIAL: native = MADV_SEQUENTIAL; break;
+        case ARRAY_ADVICE_RANDOM:     native = MADV_RANDOM; break;
+        case ARRAY_ADVICE_WILLNEED:   native = MADV_WILLNEED; break;
+        case ARRAY_ADVICE_DONTNEED:   native = MADV_DONTNEED; break;
+        default: return -1;
+    }
+    
+    // Anonymous mappings start at data; file mappings start at the header
+    void *base = arr->fd >= 0 ? (void*)arr->header : (void*)arr->data;
+    size_t bytes = arr->fd >= 0 ? _mapped_bytes(arr->capacity)
+                                : arr->capacity * sizeof(int);
+    
+    // DONTNEED on a private anonymous mapping would zero live elements
+    if (advice == ARRAY_ADVICE_DONTNEED && arr->fd < 0) {
+        return -1;
+    }
+    
+    return madvise(base, bytes, native);
+}
+#else
+DynamicArray* array_open_mapped(const char *path, int flags) {
+    (void)path;
+    (void)flags;
+    return NULL;
+}
+
+int array_sync(DynamicArray *arr) {
+    (void)arr;
+    return -1;
+}
+
+int array_advise(DynamicArray *arr, ArrayAdvice advice) {
+    (void)arr;
+    (void)advice;
+    return -1;
+}
+#endif
+
+int array_save_fd(const DynamicArray *arr, int fd) {
+    if (!arr) {
+        return -1;
+    }
+    
+    SerialHeader header;
+    serial_header_init(&header, SERIAL_KIND_ARRAY, sizeof(int), arr->size);
+    return serial_write(fd, &header, arr->data);
+}
+
+DynamicArray* array_load_fd(int fd) {
+    SerialHeader header;
+    if (serial_read_header(fd, &header, SERIAL_KIND_ARRAY, sizeof(int)) != 0) {
+        return NULL;
+    }
+    
+    // Mapped files reserve capacity past count; only count is stored
+    struct DynamicArray *arr = array_create((size_t)header.count);
+    if (!arr) {
+        return NULL;
+    }
+    
+    if (serial_read_payload(fd, arr->data, sizeof(int),
+                            (size_t)header.count) != 0) {
+        array_destroy(arr);
+        return NULL;
+    }
+    
+    arr->size = (size_t)header.count;
+    return arr;
+}
+
+DynamicArray* array_view_from_buffer(void *buf, size_t len) {
+    SerialHeader header;
+    int *payload = serial_view(buf, len, &header, SERIAL_KIND_ARRAY,
+                               sizeof(int));
+    if (!payload) {
+        return NULL;
+    }
+    
+    struct DynamicArray *arr = malloc(sizeof(struct DynamicArray));
     if (!arr) {
+        return NULL;
+    }
+    
+    _array_init_fields(arr, 0);
+    arr->storage = GROWTH_STORAGE_BORROWED;
+    arr->data = payload;
+    arr->size = (size_t)header.count;
+    arr->capacity = (size_t)header.count;
+    
+    return arr;
+}
+
+int array_push(DynamicArray *arr, int value) {
+    if (!arr || arr->readonly) {
         return -1;
     }
     
     if (arr->size >= arr->capacity) {
-        size_t new_capacity = arr->capacity * GROWTH_FACTOR;
-        if (_array_resize(arr, new_capacity) != 0) {
+        if (_array_grow(arr, arr->size + 1) != 0) {
             return -1;
         }
     }
@@ -77,7 +438,7 @@ int array_push(DynamicArray *arr, int value) {
 }
 
 int array_pop(DynamicArray *arr, int *out_value) {
-    if (!arr || !out_value || arr->size == 0) {
+    if (!arr || !out_value || arr->size == 0 || arr->readonly) {
         return -1;
     }
     
@@ -88,13 +449,12 @@ int array_pop(DynamicArray *arr, int *out_value) {
 }
 
 int array_insert(DynamicArray *arr, size_t index, int value) {
-    if (!arr || index > arr->size) {
+    if (!arr || index > arr->size || arr->readonly) {
         return -1;
     }
     
     if (arr->size >= arr->capacity) {
-        size_t new_capacity = arr->capacity * GROWTH_FACTOR;
-        if (_array_resize(arr, new_capacity) != 0) {
+        if (_array_grow(arr, arr->size + 1) != 0) {
             return -1;
         }
     }
@@ -109,7 +469,7 @@ int array_insert(DynamicArray *arr, size_t index, int value) {
 }
 
 int array_remove(DynamicArray *arr, size_t index, int *out_value) {
-    if (!arr || index >= arr->size) {
+    if (!arr || index >= arr->size || arr->readonly) {
         return -1;
     }
     
@@ -126,7 +486,7 @@ int array_remove(DynamicArray *arr, size_t index, int *out_value) {
 }
 
 int array_set(DynamicArray *arr, size_t index, int value) {
-    if (!arr || index >= arr->size) {
+    if (!arr || index >= arr->size || arr->readonly) {
         return -1;
     }
     
@@ -136,7 +496,7 @@ int array_set(DynamicArray *arr, size_t index, int value) {
 }
 
 void array_clear(DynamicArray *arr) {
-    if (!arr) {
+    if (!arr || arr->readonly) {
         return;
     }
     
@@ -169,6 +529,14 @@ size_t array_capacity(const DynamicArray *arr) {
     return arr->capacity;
 }
 
+const int* array_data(const DynamicArray *arr) {
+    if (!arr) {
+        return NULL;
+    }
+    
+    return arr->data;
+}
+
 int array_is_empty(const DynamicArray *arr) {
     if (!arr) {
         return 1;
@@ -191,6 +559,205 @@ int array_find(const DynamicArray *arr, int value) {
     return -1;
 }
 
+// Single pass: every element is written once, the write cursor only
+// advances past kept ones, so there are no data-dependent branches
+static size_t _compact_not_equal(int *data, size_t n, int value) {
+    size_t write = 0;
+    size_t i = 0;
+    
+#if defined(__AVX512F__)
+    // Left-pack 16 lanes per step with a compress store
+    __m512i needle = _mm512_set1_epi32(value);
+    for (; i + 16 <= n; i += 16) {
+        __m512i chunk = _mm512_loadu_si512((const void*)(data + i));
+        __mmask16 keep = _mm512_cmpneq_epi32_mask(chunk, needle);
+        _mm512_mask_compressstoreu_epi32(data + write, keep, chunk);
+        write += (size_t)__builtin_popcount((unsigned)keep);
+    }
+#endif
+    
+    for (; i < n; i++) {
+        int v = data[i];
+        data[write] = v;
+        write += (v != value);
+    }
+    
+    return write;
+}
+
+size_t array_retain_if(DynamicArray *arr, ArrayPredicate pred, void *ctx) {
+    if (!arr || !pred || arr->readonly) {
+        return 0;
+    }
+    
+    size_t write = 0;
+    for (size_t i = 0; i < arr->size; i++) {
+        int v = arr->data[i];
+        arr->data[write] = v;
+        write += pred(v, ctx) != 0;
+    }
+    
+    size_t removed = arr->size - write;
+    arr->size = write;
+    return removed;
+}
+
+size_t array_remove_all(DynamicArray *arr, int value) {
+    if (!arr || arr->readonly) {
+        return 0;
+    }
+    
+    size_t write = _compact_not_equal(arr->data, arr->size, value);
+    size_t removed = arr->size - write;
+    arr->size = write;
+    return removed;
+}
+
+size_t array_partition(DynamicArray *arr, ArrayPredicate pred, void *ctx) {
+    if (!arr || !pred || arr->readonly) {
+        return 0;
+    }
+    
+    size_t split = 0;
+    for (size_t i = 0; i < arr->size; i++) {
+        int v = arr->data[i];
+        if (pred(v, ctx)) {
+            arr->data[i] = arr->data[split];
+            arr->data[split] = v;
+            split++;
+        }
+    }
+    
+    return split;
+}
+
+size_t array_dedup_sorted(DynamicArray *arr) {
+    if (!arr || arr->readonly || arr->size < 2) {
+        return 0;
+    }
+    
+    size_t write = 1;
+    for (size_t i = 1; i < arr->size; i++) {
+        int v = arr->data[i];
+        arr->data[write] = v;
+        write += (v != arr->data[write - 1]);
+    }
+    
+    size_t removed = arr->size - write;
+    arr->size = write;
+    return removed;
+}
+
+int array_remove_indices(DynamicArray *arr, const size_t *sorted_idx,
+                         size_t k) {
+    if (!arr || arr->readonly || (k > 0 && !sorted_idx)) {
+        return -1;
+    }
+    
+    for (size_t j = 0; j < k; j++) {
+        if (sorted_idx[j] >= arr->size ||
+            (j > 0 && sorted_idx[j] <= sorted_idx[j - 1])) {
+            return -1;
+        }
+    }
+    
+    // Slide each run of survivors left once: O(n) total instead of O(n*k)
+    size_t write = k > 0 ? sorted_idx[0] : arr->size;
+    for (size_t j = 0; j < k; j++) {
+        size_t run_start = sorted_idx[j] + 1;
+        size_t run_end = j + 1 < k ? sorted_idx[j + 1] : arr->size;
+        size_t run_len = run_end - run_start;
+        memmove(&arr->data[write], &arr->data[run_start],
+                run_len * sizeof(int));
+        write += run_len;
+    }
+    
+    arr->size = write;
+    return 0;
+}
+
+static void _insertion_sort(int *data, size_t lo, size_t hi) {
+    for (size_t i = lo + 1; i < hi; i++) {
+        int v = data[i];
+        size_t j = i;
+        while (j > lo && data[j - 1] > v) {
+            data[j] = data[j - 1];
+            j--;
+        }
+        data[j] = v;
+    }
+}
+
+static int _median3(int a, int b, int c) {
+    if (a > b) {
+        int t = a;
+        a = b;
+        b = t;
+    }
+    if (b > c) {
+        b = c;
+    }
+    return a > b ? a : b;
+}
+
+// Quickselect with a three-way partition, so runs of equal values end the
+// search instead of degrading it. A round that keeps more than 3/4 of the
+// range switches to pseudo-random pivots, which defeats crafted inputs
+// that make median-of-three pick badly every time.
+static void _select(int *data, size_t lo, size_t hi, size_t n) {
+    uint64_t state = 0x9E3779B97F4A7C15ull;
+    int randomize = 0;
+    
+    while (hi - lo > SELECT_SMALL) {
+        size_t len = hi - lo;
+        size_t a = lo, b = lo + len / 2, c = hi - 1;
+        if (randomize) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            a = lo + (size_t)(state % len);
+            b = lo + (size_t)((state >> 21) % len);
+            c = lo + (size_t)((state >> 42) % len);
+        }
+        int pivot = _median3(data[a], data[b], data[c]);
+        
+        // [lo, lt) < pivot, [lt, i) == pivot, [gt, hi) > pivot
+        size_t lt = lo, i = lo, gt = hi;
+        while (i < gt) {
+            int v = data[i];
+            if (v < pivot) {
+                data[i++] = data[lt];
+                data[lt++] = v;
+            } else if (v > pivot) {
+                data[i] = data[--gt];
+                data[gt] = v;
+            } else {
+                i++;
+            }
+        }
+        
+        if (n < lt) {
+            hi = lt;
+        } else if (n >= gt) {
+            lo = gt;
+        } else {
+            return;
+        }
+        randomize = hi - lo > len - len / 4;
+    }
+    
+    _insertion_sort(data, lo, hi);
+}
+
+int array_nth_element(DynamicArray *arr, size_t n) {
+    if (!arr || arr->readonly || n >= arr->size) {
+        return -1;
+    }
+    
+    _select(arr->data, 0, arr->size, n);
+    return 0;
+}
+
 void array_print(const DynamicArray *arr) {
     if (!arr) {
         printf("NULL\n");
@@ -206,3 +773,29 @@ void array_print(const DynamicArray *arr) {
     }
     printf("] (size: %zu, capacity: %zu)\n", arr->size, arr->capacity);
 }
+
+static size_t _array_iter_step(ContainerIter *it, const int **span) {
+    const struct DynamicArray *arr = it->source;
+    if (it->index >= arr->size) {
+        return 0;
+    }
+    
+    size_t n = arr->size - it->index;
+    *span = arr->data + it->index;
+    it->index += n;
+    
+    return n;
+}
+
+int array_iter_init(const DynamicArray *arr, ContainerIter *it) {
+    if (!arr || !it) {
+        return -1;
+    }
+    
+    it->step = _array_iter_step;
+    it->source = arr;
+    it->cursor = NULL;
+    it->index = 0;
+    
+    return 0;
+}
@@ -1,4 +1,5 @@
 #include "../include/array2d.h"
+#include "../include/serialize.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -7,6 +8,7 @@ struct Array2D {
     int *data;
     size_t rows;
     size_t cols;
+    int owns_data; // 0 for views over caller buffers
 };
 
 Array2D* array2d_create(size_t rows, size_t cols) {
@@ -27,6 +29,7 @@ Array2D* array2d_create(size_t rows, size_t cols) {
     
     arr->rows = rows;
     arr->cols = cols;
+    arr->owns_data = 1;
     
     memset(arr->data, 0, rows * cols * sizeof(int));
     
@@ -38,10 +41,80 @@ void array2d_destroy(Array2D *arr) {
         return;
     }
     
-    free(arr->data);
+    if (arr->owns_data) {
+        free(arr->data);
+    }
     free(arr);
 }
 
+int array2d_save_fd(const Array2D *arr, int fd) {
+    if (!arr) {
+        return -1;
+    }
+    
+    SerialHeader header;
+    serial_header_init(&header, SERIAL_KIND_ARRAY2D, sizeof(int),
+                       arr->rows * arr->cols);
+    header.dim = arr->cols;
+    return serial_write(fd, &header, arr->data);
+}
+
+static int _array2d_shape(const SerialHeader *header, size_t *rows,
+                          size_t *cols) {
+    if (header->dim == 0 || header->count == 0 ||
+        header->count % header->dim != 0) {
+        return -1;
+    }
+    
+    *cols = (size_t)header->dim;
+    *rows = (size_t)(header->count / header->dim);
+    return 0;
+}
+
+Array2D* array2d_load_fd(int fd) {
+    SerialHeader header;
+    size_t rows, cols;
+    if (serial_read_header(fd, &header, SERIAL_KIND_ARRAY2D,
+                           sizeof(int)) != 0 ||
+        _array2d_shape(&header, &rows, &cols) != 0) {
+        return NULL;
+    }
+    
+    struct Array2D *arr = array2d_create(rows, cols);
+    if (!arr) {
+        return NULL;
+    }
+    
+    if (serial_read_payload(fd, arr->data, sizeof(int), rows * cols) != 0) {
+        array2d_destroy(arr);
+        return NULL;
+    }
+    
+    return arr;
+}
+
+Array2D* array2d_view_from_buffer(void *buf, size_t len) {
+    SerialHeader header;
+    size_t rows, cols;
+    int *payload = serial_view(buf, len, &header, SERIAL_KIND_ARRAY2D,
+                               sizeof(int));
+    if (!payload || _array2d_shape(&header, &rows, &cols) != 0) {
+        return NULL;
+    }
+    
+    struct Array2D *arr = malloc(sizeof(struct Array2D));
+    if (!arr) {
+        return NULL;
+    }
+    
+    arr->data = payload;
+    arr->rows = rows;
+    arr->cols = cols;
+    arr->owns_data = 0;
+    
+    return arr;
+}
+
 int array2d_set(Array2D *arr, size_t row, size_t col, int value) {
     if (!arr || row >= arr->rows || col >= arr->cols) {
         return -1;
@@ -1,4 +1,5 @@
 #include "../include/bitset.h"
+#include "../include/serialize.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -12,6 +13,7 @@ struct Bitset {
     uint64_t *data;
     size_t num_bits;
     size_t num_words;
+    int owns_data; // 0 for views over caller buffers
 };
 
 Bitset* bitset_create(size_t num_bits) {
@@ -33,6 +35,7 @@ Bitset* bitset_create(size_t num_bits) {
     
     bs->num_bits = num_bits;
     bs->num_words = num_words;
+    bs->owns_data = 1;
     
     return bs;
 }
@@ -42,10 +45,90 @@ void bitset_destroy(Bitset *bs) {
         return;
     }
     
-    free(bs->data);
+    if (bs->owns_data) {
+        free(bs->data);
+    }
     free(bs);
 }
 
+int bitset_save_fd(const Bitset *bs, int fd) {
+    if (!bs) {
+        return -1;
+    }
+    
+    SerialHeader header;
+    serial_header_init(&header, SERIAL_KIND_BITSET, sizeof(uint64_t),
+                       bs->num_words);
+    header.dim = bs->num_bits;
+    return serial_write(fd, &header, bs->data);
+}
+
+// Word count must match the bit count and padding bits must be clear.
+// dim is checked first so rounding up cannot wrap to zero words.
+static int _bitset_words_valid(const SerialHeader *header,
+                               const uint64_t *words) {
+    if (header->dim == 0 || header->count == 0 ||
+        header->dim > SIZE_MAX - (BITS_PER_WORD - 1)) {
+        return 0;
+    }
+    
+    if (header->count != (header->dim + BITS_PER_WORD - 1) / BITS_PER_WORD) {
+        return 0;
+    }
+    
+    size_t used = (size_t)(header->dim % BITS_PER_WORD);
+    if (words && used != 0 && header->count > 0) {
+        uint64_t mask = (1ULL << used) - 1;
+        return (words[header->count - 1] & ~mask) == 0;
+    }
+    
+    return 1;
+}
+
+Bitset* bitset_load_fd(int fd) {
+    SerialHeader header;
+    if (serial_read_header(fd, &header, SERIAL_KIND_BITSET,
+                           sizeof(uint64_t)) != 0 ||
+        !_bitset_words_valid(&header, NULL)) {
+        return NULL;
+    }
+    
+    struct Bitset *bs = bitset_create((size_t)header.dim);
+    if (!bs) {
+        return NULL;
+    }
+    
+    if (serial_read_payload(fd, bs->data, sizeof(uint64_t),
+                            bs->num_words) != 0 ||
+        !_bitset_words_valid(&header, bs->data)) {
+        bitset_destroy(bs);
+        return NULL;
+    }
+    
+    return bs;
+}
+
+Bitset* bitset_view_from_buffer(void *buf, size_t len) {
+    SerialHeader header;
+    uint64_t *payload = serial_view(buf, len, &header, SERIAL_KIND_BITSET,
+                                    sizeof(uint64_t));
+    if (!payload || !_bitset_words_valid(&header, payload)) {
+        return NULL;
+    }
+    
+    struct Bitset *bs = malloc(sizeof(struct Bitset));
+    if (!bs) {
+        return NULL;
+    }
+    
+    bs->data = payload;
+    bs->num_bits = (size_t)header.dim;
+    bs->num_words = (size_t)header.count;
+    bs->owns_data = 0;
+    
+    return bs;
+}
+
 int bitset_set(Bitset *bs, size_t bit_index) {
     if (!bs || bit_index >= bs->num_bits) {
         return -1;
@@ -96,6 +179,30 @@ int bitset_test(const Bitset *bs, size_t bit_index) {
     return (bs->data[word_idx] & (1ULL << bit_off)) != 0;
 }
 
+int bitset_find_next(const Bitset *bs, size_t from, size_t *out_index) {
+    if (!bs || !out_index || from >= bs->num_bits) {
+        return -1;
+    }
+    
+    // Mask off bits below `from` in the first word, then skip zero words
+    size_t word_idx = WORD_INDEX(from);
+    uint64_t word = bs->data[word_idx] & (~0ULL << BIT_OFFSET(from));
+    while (word == 0) {
+        if (++word_idx >= bs->num_words) {
+            return -1;
+        }
+        word = bs->data[word_idx];
+    }
+    
+    size_t index = word_idx * BITS_PER_WORD + (size_t)__builtin_ctzll(word);
+    if (index >= bs->num_bits) {
+        return -1;
+    }
+    
+    *out_index = index;
+    return 0;
+}
+
 void bitset_set_all(Bitset *bs) {
     if (!bs) {
         return;
@@ -0,0 +1,161 @@
+#include "../include/bucket_queue.h"
+#include "../include/bitset.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <limits.h>
+
+struct BucketQueue {
+    size_t *counts;
+    Bitset *occupied;   // Bit b set iff counts[b] > 0
+    size_t num_buckets;
+    size_t cursor;      // No bucket below this is occupied
+    size_t size;
+    int lo;
+};
+
+BucketQueue* bqueue_create(int lo, size_t num_buckets) {
+    // Every bucket must map back to an int
+    if (num_buckets == 0 ||
+        num_buckets - 1 > (size_t)((int64_t)INT_MAX - lo)) {
+        return NULL;
+    }
+    
+    BucketQueue *bq = malloc(sizeof(BucketQueue));
+    if (!bq) {
+        return NULL;
+    }
+    
+    bq->counts = calloc(num_buckets, sizeof(size_t));
+    bq->occupied = bitset_create(num_buckets);
+    if (!bq->counts || !bq->occupied) {
+        free(bq->counts);
+        bitset_destroy(bq->occupied);
+        free(bq);
+        return NULL;
+    }
+    
+    bq->num_buckets = num_buckets;
+    bq->cursor = num_buckets;
+    bq->size = 0;
+    bq->lo = lo;
+    
+    return bq;
+}
+
+void bqueue_destroy(BucketQueue *bq) {
+    if (!bq) {
+        return;
+    }
+    
+    free(bq->counts);
+    bitset_destroy(bq->occupied);
+    free(bq);
+}
+
+int bqueue_push(BucketQueue *bq, int value) {
+    if (!bq || value < bq->lo) {
+        return -1;
+    }
+    
+    size_t bucket = (size_t)((int64_t)value - bq->lo);
+    if (bucket >= bq->num_buckets) {
+        return -1;
+    }
+    
+    if (bq->counts[bucket]++ == 0) {
+        bitset_set(bq->occupied, bucket);
+    }
+    if (bucket < bq->cursor) {
+        bq->cursor = bucket;
+    }
+    bq->size++;
+    
+    return 0;
+}
+
+int bqueue_pop(BucketQueue *bq, int *out_value) {
+    if (!bq || !out_value || bq->size == 0) {
+        return -1;
+    }
+    
+    size_t bucket;
+    bitset_find_next(bq->occupied, bq->cursor, &bucket);
+    bq->cursor = bucket;
+    
+    if (--bq->counts[bucket] == 0) {
+        bitset_clear(bq->occupied, bucket);
+    }
+    bq->size--;
+    
+    *out_value = (int)((int64_t)bq->lo + (int64_t)bucket);
+    return 0;
+}
+
+int bqueue_peek(const BucketQueue *bq, int *out_value) {
+    if (!bq || !out_value || bq->size == 0) {
+        return -1;
+    }
+    
+    size_t bucket;
+    bitset_find_next(bq->occupied, bq->cursor, &bucket);
+    
+    *out_value = (int)((int64_t)bq->lo + (int64_t)bucket);
+    return 0;
+}
+
+size_t bqueue_size(const BucketQueue *bq) {
+    if (!bq) {
+        return 0;
+    }
+    
+    return bq->size;
+}
+
+int bqueue_is_empty(const BucketQueue *bq) {
+    if (!bq) {
+        return 1;
+    }
+    
+    return bq->size == 0;
+}
+
+void bqueue_clear(BucketQueue *bq) {
+    if (!bq) {
+        return;
+    }
+    
+    // Only occupied buckets have non-zero counts
+    size_t bucket = bq->cursor;
+    while (bq->size > 0 &&
+           bitset_find_next(bq->occupied, bucket, &bucket) == 0) {
+        bq->counts[bucket] = 0;
+        bucket++;
+    }
+    bitset_clear_all(bq->occupied);
+    bq->cursor = bq->num_buckets;
+    bq->size = 0;
+}
+
+void bqueue_print(const BucketQueue *bq) {
+    if (!bq) {
+        printf("NULL\n");
+        return;
+    }
+    
+    printf("[");
+    size_t bucket = bq->cursor;
+    size_t printed = 0;
+    while (printed < bq->size &&
+           bitset_find_next(bq->occupied, bucket, &bucket) == 0) {
+        for (size_t c = 0; c < bq->counts[bucket]; c++) {
+            printf("%d", (int)((int64_t)bq->lo + (int64_t)bucket));
+            if (++printed < bq->size) {
+                printf(", ");
+            }
+        }
+        bucket++;
+    }
+    printf("] (size: %zu, range: [%d, %lld])\n", bq->size, bq->lo,
+           (long long)bq->lo + (long long)bq->num_buckets - 1);
+}
@@ -0,0 +1,9 @@
+#include "../include/container_iter.h"
+
+size_t container_iter_next(ContainerIter *it, const int **span) {
+    if (!it || !span || !it->step) {
+        return 0;
+    }
+    
+    return it->step(it, span);
+}
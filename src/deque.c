@@ -213,3 +213,29 @@ void deque_print(const Deque *deque) {
     }
     printf("] (size: %zu)\n", deque->size);
 }
+
+static size_t _deque_iter_step(ContainerIter *it, const int **span) {
+    const Node *node = it->cursor;
+    if (!node) {
+        return 0;
+    }
+    
+    *span = &node->data;
+    it->cursor = node->next;
+    it->index++;
+    
+    return 1;
+}
+
+int deque_iter_init(const Deque *deque, ContainerIter *it) {
+    if (!deque || !it) {
+        return -1;
+    }
+    
+    it->step = _deque_iter_step;
+    it->source = deque;
+    it->cursor = deque->front;
+    it->index = 0;
+    
+    return 0;
+}
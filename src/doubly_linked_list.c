@@ -1,23 +1,45 @@
 #include "../include/doubly_linked_list.h"
 #include <stdlib.h>
 #include <stdio.h>
+#include <stdint.h>
 
-typedef struct Node {
+#define SORT_BINS 64
+
+typedef struct DListNode {
     int data;
-    struct Node *next;
-    struct Node *prev;
+    unsigned char in_slab; // Slab nodes cannot be freed one by one
+    struct DListNode *next;
+    struct DListNode *prev;
 } Node;
 
+// Nodes for dlist_from_array, allocated in one block
+typedef struct NodeSlab {
+    struct NodeSlab *next;
+    size_t count;
+    Node nodes[];
+} NodeSlab;
+
 struct DoublyLinkedList {
     Node *head;
     Node *tail;
     size_t size;
+    Node *finger;        // Last node reached by index (NULL = unknown)
+    size_t finger_index;
+    NodeSlab *slabs;
+    NodeSlab *slabs_tail; // Lets splice and merge adopt slabs in O(1)
+    Node *spare;         // Released slab nodes (linked by next), reused before malloc
 };
 
-static Node* _node_create(int value) {
-    Node *node = malloc(sizeof(Node));
-    if (!node) {
-        return NULL;
+static Node* _node_create(DoublyLinkedList *list, int value) {
+    Node *node = list->spare;
+    if (node) {
+        list->spare = node->next;
+    } else {
+        node = malloc(sizeof(Node));
+        if (!node) {
+            return NULL;
+        }
+        node->in_slab = 0;
     }
     
     node->data = value;
@@ -27,6 +49,65 @@ static Node* _node_create(int value) {
     return node;
 }
 
+// Slab nodes go back to the spare list; checked per node, not per slab
+static void _node_free(DoublyLinkedList *list, Node *node) {
+    if (node->in_slab) {
+        node->next = list->spare;
+        list->spare = node;
+    } else {
+        free(node);
+    }
+}
+
+// Hands src's slabs to dst after src's nodes moved there. src's spare
+// nodes are dropped rather than walked; their memory goes with the slab.
+static void _adopt_slabs(DoublyLinkedList *dst, DoublyLinkedList *src) {
+    if (src->slabs) {
+        src->slabs_tail->next = dst->slabs;
+        if (!dst->slabs) {
+            dst->slabs_tail = src->slabs_tail;
+        }
+        dst->slabs = src->slabs;
+        src->slabs = NULL;
+        src->slabs_tail = NULL;
+    }
+    src->spare = NULL;
+}
+
+static size_t _distance(size_t a, size_t b) {
+    return a < b ? b - a : a - b;
+}
+
+// Walks to index from whichever of head, tail or finger is closest
+static Node* _locate(const DoublyLinkedList *list, size_t index) {
+    // The finger is a cache, so lookups through a const list may move it.
+    // Lists only come from the heap (never defined const), so the write is
+    // well defined; the header warns that it makes get unsafe to share.
+    DoublyLinkedList *self = (DoublyLinkedList*)list;
+    
+    Node *current = list->head;
+    size_t i = 0;
+    if (list->size - 1 - index < index) {
+        current = list->tail;
+        i = list->size - 1;
+    }
+    if (list->finger && _distance(list->finger_index, index) < _distance(i, index)) {
+        current = list->finger;
+        i = list->finger_index;
+    }
+    
+    for (; i < index; i++) {
+        current = current->next;
+    }
+    for (; i > index; i--) {
+        current = current->prev;
+    }
+    
+    self->finger = current;
+    self->finger_index = index;
+    return current;
+}
+
 DoublyLinkedList* dlist_create(void) {
     struct DoublyLinkedList *list = malloc(sizeof(struct DoublyLinkedList));
     if (!list) {
@@ -36,6 +117,11 @@ DoublyLinkedList* dlist_create(void) {
     list->head = NULL;
     list->tail = NULL;
     list->size = 0;
+    list->finger = NULL;
+    list->finger_index = 0;
+    list->slabs = NULL;
+    list->slabs_tail = NULL;
+    list->spare = NULL;
     
     return list;
 }
@@ -45,11 +131,13 @@ void dlist_destroy(DoublyLinkedList *list) {
         return;
     }
     
-    Node *current = list->head;
-    while (current) {
-        Node *next = current->next;
-        free(current);
-        current = next;
+    dlist_clear(list);
+    
+    NodeSlab *slab = list->slabs;
+    while (slab) {
+        NodeSlab *next = slab->next;
+        free(slab);
+        slab = next;
     }
     
     free(list);
@@ -60,7 +148,7 @@ int dlist_push_front(DoublyLinkedList *list, int value) {
         return -1;
     }
     
-    Node *node = _node_create(value);
+    Node *node = _node_create(list, value);
     if (!node) {
         return -1;
     }
@@ -75,6 +163,9 @@ int dlist_push_front(DoublyLinkedList *list, int value) {
     }
     
     list->size++;
+    if (list->finger) {
+        list->finger_index++;
+    }
     return 0;
 }
 
@@ -83,7 +174,7 @@ int dlist_push_back(DoublyLinkedList *list, int value) {
         return -1;
     }
     
-    Node *node = _node_create(value);
+    Node *node = _node_create(list, value);
     if (!node) {
         return -1;
     }
@@ -110,6 +201,11 @@ int dlist_pop_front(DoublyLinkedList *list, int *out_value) {
     *out_value = old_head->data;
     
     list->head = old_head->next;
+    if (list->finger == old_head) {
+        list->finger = NULL;
+    } else if (list->finger) {
+        list->finger_index--;
+    }
     
     if (list->head) {
         list->head->prev = NULL;
@@ -117,7 +213,7 @@ int dlist_pop_front(DoublyLinkedList *list, int *out_value) {
         list->tail = NULL;
     }
     
-    free(old_head);
+    _node_free(list, old_head);
     list->size--;
     
     return 0;
@@ -132,6 +228,9 @@ int dlist_pop_back(DoublyLinkedList *list, int *out_value) {
     *out_value = old_tail->data;
     
     list->tail = old_tail->prev;
+    if (list->finger == old_tail) {
+        list->finger = NULL;
+    }
     
     if (list->tail) {
         list->tail->next = NULL;
@@ -139,7 +238,7 @@ int dlist_pop_back(DoublyLinkedList *list, int *out_value) {
         list->head = NULL;
     }
     
-    free(old_tail);
+    _node_free(list, old_tail);
     list->size--;
     
     return 0;
@@ -158,12 +257,9 @@ int dlist_insert_at(DoublyLinkedList *list, size_t index, int value) {
         return dlist_push_back(list, value);
     }
     
-    Node *current = list->head;
-    for (size_t i = 0; i < index; i++) {
-        current = current->next;
-    }
+    Node *current = _locate(list, index);
     
-    Node *node = _node_create(value);
+    Node *node = _node_create(list, value);
     if (!node) {
         return -1;
     }
@@ -174,6 +270,7 @@ int dlist_insert_at(DoublyLinkedList *list, size_t index, int value) {
     current->prev = node;
     
     list->size++;
+    list->finger = node;
     return 0;
 }
 
@@ -190,10 +287,7 @@ int dlist_remove_at(DoublyLinkedList *list, size_t index, int *out_value) {
         return dlist_pop_back(list, out_value);
     }
     
-    Node *current = list->head;
-    for (size_t i = 0; i < index; i++) {
-        current = current->next;
-    }
+    Node *current = _locate(list, index);
     
     if (out_value) {
         *out_value = current->data;
@@ -201,8 +295,9 @@ int dlist_remove_at(DoublyLinkedList *list, size_t index, int *out_value) {
     
     current->prev->next = current->next;
     current->next->prev = current->prev;
+    list->finger = current->next;
     
-    free(current);
+    _node_free(list, current);
     list->size--;
     
     return 0;
@@ -213,20 +308,7 @@ int dlist_get(const DoublyLinkedList *list, size_t index, int *out_value) {
         return -1;
     }
     
-    Node *current;
-    if (index < list->size / 2) {
-        current = list->head;
-        for (size_t i = 0; i < index; i++) {
-            current = current->next;
-        }
-    } else {
-        current = list->tail;
-        for (size_t i = list->size - 1; i > index; i--) {
-            current = current->prev;
-        }
-    }
-    
-    *out_value = current->data;
+    *out_value = _locate(list, index)->data;
     return 0;
 }
 
@@ -235,20 +317,7 @@ int dlist_set(DoublyLinkedList *list, size_t index, int value) {
         return -1;
     }
     
-    Node *current;
-    if (index < list->size / 2) {
-        current = list->head;
-        for (size_t i = 0; i < index; i++) {
-            current = current->next;
-        }
-    } else {
-        current = list->tail;
-        for (size_t i = list->size - 1; i > index; i--) {
-            current = current->prev;
-        }
-    }
-    
-    current->data = value;
+    _locate(list, index)->data = value;
     return 0;
 }
 
@@ -295,13 +364,14 @@ void dlist_clear(DoublyLinkedList *list) {
     Node *current = list->head;
     while (current) {
         Node *next = current->next;
-        free(current);
+        _node_free(list, current);
         current = next;
     }
     
     list->head = NULL;
     list->tail = NULL;
     list->size = 0;
+    list->finger = NULL;
 }
 
 void dlist_reverse(DoublyLinkedList *list) {
@@ -322,6 +392,409 @@ void dlist_reverse(DoublyLinkedList *list) {
     temp = list->head;
     list->head = list->tail;
     list->tail = temp;
+    list->finger_index = list->size - 1 - list->finger_index;
+}
+
+// Links node before `at`, or at the tail when at is NULL
+static void _link_before(DoublyLinkedList *list, Node *at, Node *node) {
+    // Appending keeps the finger; other positions may shift it
+    if (at && at == list->head) {
+        list->finger_index++;
+    } else if (at) {
+        list->finger = NULL;
+    }
+    
+    node->next = at;
+    node->prev = at ? at->prev : list->tail;
+    
+    if (node->prev) {
+        node->prev->next = node;
+    } else {
+        list->head = node;
+    }
+    
+    if (at) {
+        at->prev = node;
+    } else {
+        list->tail = node;
+    }
+    
+    list->size++;
+}
+
+static void _unlink(DoublyLinkedList *list, Node *node) {
+    if (node == list->finger || (node->prev && node->next)) {
+        list->finger = NULL;
+    } else if (!node->prev && list->finger) {
+        list->finger_index--;
+    }
+    
+    if (node->prev) {
+        node->prev->next = node->next;
+    } else {
+        list->head = node->next;
+    }
+    
+    if (node->next) {
+        node->next->prev = node->prev;
+    } else {
+        list->tail = node->prev;
+    }
+    
+    node->next = NULL;
+    node->prev = NULL;
+    list->size--;
+}
+
+int dlist_cursor_front(DoublyLinkedList *list, DListCursor *cursor) {
+    if (!list || !cursor) {
+        return -1;
+    }
+    
+    cursor->list = list;
+    cursor->node = list->head;
+    return 0;
+}
+
+int dlist_cursor_back(DoublyLinkedList *list, DListCursor *cursor) {
+    if (!list || !cursor) {
+        return -1;
+    }
+    
+    cursor->list = list;
+    cursor->node = list->tail;
+    return 0;
+}
+
+int dlist_cursor_valid(const DListCursor *cursor) {
+    return cursor && cursor->list && cursor->node;
+}
+
+int dlist_cursor_next(DListCursor *cursor) {
+    if (!cursor || !cursor->list) {
+        return -1;
+    }
+    
+    cursor->node = cursor->node ? cursor->node->next : cursor->list->head;
+    return cursor->node ? 0 : -1;
+}
+
+int dlist_cursor_prev(DListCursor *cursor) {
+    if (!cursor || !cursor->list) {
+        return -1;
+    }
+    
+    cursor->node = cursor->node ? cursor->node->prev : cursor->list->tail;
+    return cursor->node ? 0 : -1;
+}
+
+int dlist_cursor_get(const DListCursor *cursor, int *out_value) {
+    if (!dlist_cursor_valid(cursor) || !out_value) {
+        return -1;
+    }
+    
+    *out_value = cursor->node->data;
+    return 0;
+}
+
+int dlist_cursor_set(DListCursor *cursor, int value) {
+    if (!dlist_cursor_valid(cursor)) {
+        return -1;
+    }
+    
+    cursor->node->data = value;
+    return 0;
+}
+
+int dlist_cursor_insert_before(DListCursor *cursor, int value) {
+    if (!cursor || !cursor->list) {
+        return -1;
+    }
+    
+    Node *node = _node_create(cursor->list, value);
+    if (!node) {
+        return -1;
+    }
+    
+    _link_before(cursor->list, cursor->node, node);
+    return 0;
+}
+
+int dlist_cursor_insert_after(DListCursor *cursor, int value) {
+    if (!cursor || !cursor->list) {
+        return -1;
+    }
+    
+    Node *node = _node_create(cursor->list, value);
+    if (!node) {
+        return -1;
+    }
+    
+    Node *at = cursor->node ? cursor->node->next : cursor->list->head;
+    _link_before(cursor->list, at, node);
+    return 0;
+}
+
+int dlist_cursor_remove(DListCursor *cursor, int *out_value) {
+    if (!dlist_cursor_valid(cursor)) {
+        return -1;
+    }
+    
+    Node *node = cursor->node;
+    cursor->node = node->next;
+    
+    if (out_value) {
+        *out_value = node->data;
+    }
+    
+    _unlink(cursor->list, node);
+    _node_free(cursor->list, node);
+    return 0;
+}
+
+int dlist_cursor_move_to_front(DListCursor *cursor) {
+    if (!dlist_cursor_valid(cursor)) {
+        return -1;
+    }
+    
+    DoublyLinkedList *list = cursor->list;
+    if (cursor->node != list->head) {
+        _unlink(list, cursor->node);
+        _link_before(list, list->head, cursor->node);
+    }
+    
+    return 0;
+}
+
+int dlist_cursor_move_to_back(DListCursor *cursor) {
+    if (!dlist_cursor_valid(cursor)) {
+        return -1;
+    }
+    
+    DoublyLinkedList *list = cursor->list;
+    if (cursor->node != list->tail) {
+        _unlink(list, cursor->node);
+        _link_before(list, NULL, cursor->node);
+    }
+    
+    return 0;
+}
+
+int dlist_cursor_splice_before(DListCursor *cursor, DoublyLinkedList *other) {
+    if (!cursor || !cursor->list || !other || other == cursor->list) {
+        return -1;
+    }
+    
+    if (!other->head) {
+        return 0;
+    }
+    
+    DoublyLinkedList *list = cursor->list;
+    Node *at = cursor->node;
+    Node *before = at ? at->prev : list->tail;
+    
+    if (at && at == list->head) {
+        list->finger_index += other->size;
+    } else if (at) {
+        list->finger = NULL;
+    }
+    
+    other->head->prev = before;
+    if (before) {
+        before->next = other->head;
+    } else {
+        list->head = other->head;
+    }
+    
+    other->tail->next = at;
+    if (at) {
+        at->prev = other->tail;
+    } else {
+        list->tail = other->tail;
+    }
+    
+    list->size += other->size;
+    other->head = NULL;
+    other->tail = NULL;
+    other->size = 0;
+    other->finger = NULL;
+    _adopt_slabs(list, other);
+    
+    return 0;
+}
+
+int dlist_splice(DoublyLinkedList *dst, DoublyLinkedList *src) {
+    DListCursor end = { dst, NULL };
+    return dlist_cursor_splice_before(&end, src);
+}
+
+int dlist_merge(DoublyLinkedList *dst, DoublyLinkedList *src) {
+    if (!dst || !src || dst == src) {
+        return -1;
+    }
+    
+    Node *a = dst->head;
+    Node *b = src->head;
+    
+    // Walk dst, pulling in each src node before the first larger element
+    while (a && b) {
+        if (b->data < a->data) {
+            Node *next = b->next;
+            b->prev = a->prev;
+            b->next = a;
+            if (a->prev) {
+                a->prev->next = b;
+            } else {
+                dst->head = b;
+            }
+            a->prev = b;
+            b = next;
+        } else {
+            a = a->next;
+        }
+    }
+    
+    // Remaining src nodes are all >= dst's tail
+    if (b) {
+        b->prev = dst->tail;
+        if (dst->tail) {
+            dst->tail->next = b;
+        } else {
+            dst->head = b;
+        }
+        dst->tail = src->tail;
+    }
+    
+    dst->size += src->size;
+    dst->finger = NULL;
+    src->head = NULL;
+    src->tail = NULL;
+    src->size = 0;
+    src->finger = NULL;
+    _adopt_slabs(dst, src);
+    
+    return 0;
+}
+
+DoublyLinkedList* dlist_from_array(const int *values, size_t count) {
+    if (!values && count > 0) {
+        return NULL;
+    }
+    
+    DoublyLinkedList *list = dlist_create();
+    if (!list || count == 0) {
+        return list;
+    }
+    
+    if (count > (SIZE_MAX - sizeof(NodeSlab)) / sizeof(Node)) {
+        free(list);
+        return NULL;
+    }
+    
+    NodeSlab *slab = malloc(sizeof(NodeSlab) + count * sizeof(Node));
+    if (!slab) {
+        free(list);
+        return NULL;
+    }
+    
+    slab->next = NULL;
+    slab->count = count;
+    for (size_t i = 0; i < count; i++) {
+        slab->nodes[i].data = values[i];
+        slab->nodes[i].in_slab = 1;
+        slab->nodes[i].next = i + 1 < count ? &slab->nodes[i + 1] : NULL;
+        slab->nodes[i].prev = i > 0 ? &slab->nodes[i - 1] : NULL;
+    }
+    
+    list->slabs = slab;
+    list->slabs_tail = slab;
+    list->head = &slab->nodes[0];
+    list->tail = &slab->nodes[count - 1];
+    list->size = count;
+    
+    return list;
+}
+
+int dlist_to_array(const DoublyLinkedList *list, int *out) {
+    if (!list || (!out && list->size > 0)) {
+        return -1;
+    }
+    
+    size_t i = 0;
+    for (const Node *current = list->head; current; current = current->next) {
+        out[i++] = current->data;
+    }
+    
+    return 0;
+}
+
+// Merges two sorted next-chains; taking from a on ties keeps it stable
+static Node* _merge(Node *a, Node *b) {
+    Node head;
+    Node *tail = &head;
+    while (a && b) {
+        if (b->data < a->data) {
+            tail->next = b;
+            b = b->next;
+        } else {
+            tail->next = a;
+            a = a->next;
+        }
+        tail = tail->next;
+    }
+    tail->next = a ? a : b;
+    return head.next;
+}
+
+// Bottom-up merge sort with a binary counter of runs: bins[i] holds a
+// sorted run of 2^i nodes, so merges happen while the nodes are still
+// cache-hot instead of in log n full passes. Extra space is the fixed
+// array of bins (64 covers any size_t length).
+static Node* _merge_sort(Node *head) {
+    Node *bins[SORT_BINS] = {NULL};
+    size_t used = 0;
+    
+    while (head) {
+        Node *carry = head;
+        head = head->next;
+        carry->next = NULL;
+        
+        size_t i = 0;
+        for (; i < used && bins[i]; i++) {
+            carry = _merge(bins[i], carry);
+            bins[i] = NULL;
+        }
+        if (i == used && used < SORT_BINS) {
+            used++;
+        }
+        bins[i] = carry;
+    }
+    
+    // Older (earlier) runs live in higher bins, so they go first
+    Node *result = NULL;
+    for (size_t i = 0; i < used; i++) {
+        if (bins[i]) {
+            result = result ? _merge(bins[i], result) : bins[i];
+        }
+    }
+    return result;
+}
+
+void dlist_sort(DoublyLinkedList *list) {
+    if (!list || !list->head) {
+        return;
+    }
+    
+    list->head = _merge_sort(list->head);
+    
+    // Rebuild the prev links in one pass
+    Node *prev = NULL;
+    for (Node *current = list->head; current; current = current->next) {
+        current->prev = prev;
+        prev = current;
+    }
+    list->tail = prev;
+    list->finger = NULL;
 }
 
 void dlist_print(const DoublyLinkedList *list) {
@@ -359,3 +832,29 @@ void dlist_print_reverse(const DoublyLinkedList *list) {
     }
     printf("] (size: %zu)\n", list->size);
 }
+
+static size_t _dlist_iter_step(ContainerIter *it, const int **span) {
+    const Node *node = it->cursor;
+    if (!node) {
+        return 0;
+    }
+    
+    *span = &node->data;
+    it->cursor = node->next;
+    it->index++;
+    
+    return 1;
+}
+
+int dlist_iter_init(const DoublyLinkedList *list, ContainerIter *it) {
+    if (!list || !it) {
+        return -1;
+    }
+    
+    it->step = _dlist_iter_step;
+    it->source = list;
+    it->cursor = list->head;
+    it->index = 0;
+    
+    return 0;
+}
@@ -1,15 +1,18 @@
 #include "../include/dyn_string.h"
+#include "../include/growth.h"
+#include "../include/serialize.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
 
 #define DEFAULT_CAPACITY 32
-#define GROWTH_FACTOR 2
 
 struct String {
     char *data;
     size_t length;   // Number of characters (excluding null terminator)
     size_t capacity; // Total space including null terminator
+    GrowthPolicy growth;
+    GrowthStorage storage;
 };
 
 static int _string_resize(struct String *str, size_t new_capacity) {
@@ -17,7 +20,9 @@ static int _string_resize(struct String *str, size_t new_capacity) {
         return -1;
     }
     
-    char *new_data = realloc(str->data, new_capacity);
+    char *new_data = growth_realloc(str->data, 1, str->capacity,
+                                    &new_capacity, &str->storage,
+                                    &str->growth);
     if (!new_data) {
         return -1;
     }
@@ -32,9 +37,11 @@ static int _string_ensure_capacity(struct String *str, size_t required) {
         return 0;
     }
     
-    size_t new_capacity = str->capacity * GROWTH_FACTOR;
-    while (new_capacity <= required) {
-        new_capacity *= GROWTH_FACTOR;
+    // Capacity includes the null terminator, so reserve required + 1
+    size_t new_capacity = growth_next_capacity(&str->growth, str->capacity,
+                                               required + 1, 1);
+    if (new_capacity == 0) {
+        return -1;
     }
     
     return _string_resize(str, new_capacity);
@@ -108,7 +115,10 @@ String* string_create_with_capacity(size_t capacity) {
         return NULL;
     }
     
-    str->data = malloc(capacity);
+    str->growth = growth_policy_default();
+    str->storage = GROWTH_STORAGE_HEAP;
+    str->data = growth_realloc(NULL, 1, 0, &capacity, &str->storage,
+                               &str->growth);
     if (!str->data) {
         free(str);
         return NULL;
@@ -126,10 +136,73 @@ void string_destroy(String *str) {
         return;
     }
     
-    free(str->data);
+    growth_free(str->data, 1, str->capacity, str->storage);
     free(str);
 }
 
+int string_set_growth_policy(String *str, GrowthPolicy policy) {
+    if (!str || growth_policy_validate(&policy) != 0) {
+        return -1;
+    }
+    
+    str->growth = policy;
+    return 0;
+}
+
+int string_save_fd(const String *str, int fd) {
+    if (!str) {
+        return -1;
+    }
+    
+    // Payload keeps the terminator so views can hand out string_cstr
+    SerialHeader header;
+    serial_header_init(&header, SERIAL_KIND_STRING, 1, str->length + 1);
+    return serial_write(fd, &header, str->data);
+}
+
+String* string_load_fd(int fd) {
+    SerialHeader header;
+    if (serial_read_header(fd, &header, SERIAL_KIND_STRING, 1) != 0 ||
+        header.count == 0) {
+        return NULL;
+    }
+    
+    struct String *str = string_create_with_capacity((size_t)header.count);
+    if (!str) {
+        return NULL;
+    }
+    
+    if (serial_read_payload(fd, str->data, 1, (size_t)header.count) != 0 ||
+        str->data[header.count - 1] != '\0') {
+        string_destroy(str);
+        return NULL;
+    }
+    
+    str->length = (size_t)header.count - 1;
+    return str;
+}
+
+String* string_view_from_buffer(void *buf, size_t len) {
+    SerialHeader header;
+    char *payload = serial_view(buf, len, &header, SERIAL_KIND_STRING, 1);
+    if (!payload || header.count == 0 || payload[header.count - 1] != '\0') {
+        return NULL;
+    }
+    
+    struct String *str = malloc(sizeof(struct String));
+    if (!str) {
+        return NULL;
+    }
+    
+    str->growth = growth_policy_default();
+    str->storage = GROWTH_STORAGE_BORROWED;
+    str->data = payload;
+    str->length = (size_t)header.count - 1;
+    str->capacity = (size_t)header.count;
+    
+    return str;
+}
+
 int string_push(String *str, char ch) {
     if (!str) {
         return -1;
@@ -0,0 +1,361 @@
+#include "../include/gap_array.h"
+#include "../include/growth.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#define DEFAULT_CAPACITY 16
+
+/*
+ * Layout: [0, gap_start) holds elements before the cursor,
+ * [gap_end, capacity) holds the rest. The gap is unused space.
+ */
+struct GapArray {
+    int *data;
+    size_t capacity;
+    size_t gap_start;
+    size_t gap_end;
+    GrowthPolicy growth;
+    GrowthStorage storage;
+};
+
+static size_t _tail_len(const GapArray *arr) {
+    return arr->capacity - arr->gap_end;
+}
+
+static size_t _size(const GapArray *arr) {
+    return arr->gap_start + _tail_len(arr);
+}
+
+static size_t _physical(const GapArray *arr, size_t index) {
+    return index < arr->gap_start ? index
+                                  : index + (arr->gap_end - arr->gap_start);
+}
+
+static int _resize(GapArray *arr, size_t new_capacity) {
+    size_t old_capacity = arr->capacity;
+    size_t tail = _tail_len(arr);
+    
+    int *new_data = growth_realloc(arr->data, sizeof(int), old_capacity,
+                                   &new_capacity, &arr->storage, &arr->growth);
+    if (!new_data) {
+        return -1;
+    }
+    
+    // The tail lives at the end of the buffer, so it moves with the end
+    memmove(&new_data[new_capacity - tail], &new_data[old_capacity - tail],
+            tail * sizeof(int));
+    
+    arr->data = new_data;
+    arr->capacity = new_capacity;
+    arr->gap_end = new_capacity - tail;
+    
+    return 0;
+}
+
+static int _ensure_gap(GapArray *arr) {
+    if (arr->gap_start < arr->gap_end) {
+        return 0;
+    }
+    
+    size_t new_capacity = growth_next_capacity(&arr->growth, arr->capacity,
+                                               arr->capacity + 1, sizeof(int));
+    if (new_capacity == 0) {
+        return -1;
+    }
+    
+    return _resize(arr, new_capacity);
+}
+
+GapArray* gap_array_create(size_t capacity) {
+    if (capacity == 0) {
+        capacity = DEFAULT_CAPACITY;
+    }
+    
+    GapArray *arr = malloc(sizeof(GapArray));
+    if (!arr) {
+        return NULL;
+    }
+    
+    arr->growth = growth_policy_default();
+    arr->storage = GROWTH_STORAGE_HEAP;
+    arr->data = growth_realloc(NULL, sizeof(int), 0, &capacity,
+                               &arr->storage, &arr->growth);
+    if (!arr->data) {
+        free(arr);
+        return NULL;
+    }
+    
+    arr->capacity = capacity;
+    arr->gap_start = 0;
+    arr->gap_end = capacity;
+    
+    return arr;
+}
+
+void gap_array_destroy(GapArray *arr) {
+    if (!arr) {
+        return;
+    }
+    
+    growth_free(arr->data, sizeof(int), arr->capacity, arr->storage);
+    free(arr);
+}
+
+int gap_array_set_growth_policy(GapArray *arr, GrowthPolicy policy) {
+    if (!arr || growth_policy_validate(&policy) != 0) {
+        return -1;
+    }
+    
+    arr->growth = policy;
+    return 0;
+}
+
+int gap_array_reserve(GapArray *arr, size_t capacity) {
+    if (!arr) {
+        return -1;
+    }
+    
+    if (capacity <= arr->capacity) {
+        return 0;
+    }
+    
+    return _resize(arr, capacity);
+}
+
+int gap_array_move_cursor(GapArray *arr, size_t index) {
+    if (!arr || index > _size(arr)) {
+        return -1;
+    }
+    
+    size_t gap = arr->gap_end - arr->gap_start;
+    if (index < arr->gap_start) {
+        size_t count = arr->gap_start - index;
+        memmove(&arr->data[index + gap], &arr->data[index],
+                count * sizeof(int));
+    } else if (index > arr->gap_start) {
+        size_t count = index - arr->gap_start;
+        memmove(&arr->data[arr->gap_start], &arr->data[arr->gap_end],
+                count * sizeof(int));
+    }
+    
+    arr->gap_start = index;
+    arr->gap_end = index + gap;
+    
+    return 0;
+}
+
+size_t gap_array_cursor(const GapArray *arr) {
+    if (!arr) {
+        return 0;
+    }
+    
+    return arr->gap_start;
+}
+
+int gap_array_cursor_insert(GapArray *arr, int value) {
+    if (!arr || _ensure_gap(arr) != 0) {
+        return -1;
+    }
+    
+    arr->data[arr->gap_start++] = value;
+    return 0;
+}
+
+int gap_array_cursor_backspace(GapArray *arr, int *out_value) {
+    if (!arr || arr->gap_start == 0) {
+        return -1;
+    }
+    
+    arr->gap_start--;
+    if (out_value) {
+        *out_value = arr->data[arr->gap_start];
+    }
+    
+    return 0;
+}
+
+int gap_array_cursor_delete(GapArray *arr, int *out_value) {
+    if (!arr || arr->gap_end == arr->capacity) {
+        return -1;
+    }
+    
+    if (out_value) {
+        *out_value = arr->data[arr->gap_end];
+    }
+    arr->gap_end++;
+    
+    return 0;
+}
+
+int gap_array_push(GapArray *arr, int value) {
+    if (!arr) {
+        return -1;
+    }
+    
+    return gap_array_insert(arr, _size(arr), value);
+}
+
+int gap_array_pop(GapArray *arr, int *out_value) {
+    if (!arr || _size(arr) == 0) {
+        return -1;
+    }
+    
+    return gap_array_remove(arr, _size(arr) - 1, out_value);
+}
+
+int gap_array_insert(GapArray *arr, size_t index, int value) {
+    if (gap_array_move_cursor(arr, index) != 0) {
+        return -1;
+    }
+    
+    return gap_array_cursor_insert(arr, value);
+}
+
+int gap_array_remove(GapArray *arr, size_t index, int *out_value) {
+    if (!arr || index >= _size(arr)) {
+        return -1;
+    }
+    
+    // Deleting just before the cursor is a backspace, no shifting needed
+    if (index + 1 == arr->gap_start) {
+        return gap_array_cursor_backspace(arr, out_value);
+    }
+    
+    gap_array_move_cursor(arr, index);
+    return gap_array_cursor_delete(arr, out_value);
+}
+
+int gap_array_set(GapArray *arr, size_t index, int value) {
+    if (!arr || index >= _size(arr)) {
+        return -1;
+    }
+    
+    arr->data[_physical(arr, index)] = value;
+    return 0;
+}
+
+int gap_array_get(const GapArray *arr, size_t index, int *out_value) {
+    if (!arr || !out_value || index >= _size(arr)) {
+        return -1;
+    }
+    
+    *out_value = arr->data[_physical(arr, index)];
+    return 0;
+}
+
+void gap_array_clear(GapArray *arr) {
+    if (!arr) {
+        return;
+    }
+    
+    arr->gap_start = 0;
+    arr->gap_end = arr->capacity;
+}
+
+size_t gap_array_size(const GapArray *arr) {
+    if (!arr) {
+        return 0;
+    }
+    
+    return _size(arr);
+}
+
+size_t gap_array_capacity(const GapArray *arr) {
+    if (!arr) {
+        return 0;
+    }
+    
+    return arr->capacity;
+}
+
+int gap_array_is_empty(const GapArray *arr) {
+    if (!arr) {
+        return 1;
+    }
+    
+    return _size(arr) == 0;
+}
+
+int gap_array_find(const GapArray *arr, int value) {
+    if (!arr) {
+        return -1;
+    }
+    
+    for (size_t i = 0; i < arr->gap_start; i++) {
+        if (arr->data[i] == value) {
+            return (int)i;
+        }
+    }
+    
+    for (size_t i = arr->gap_end; i < arr->capacity; i++) {
+        if (arr->data[i] == value) {
+            return (int)(i - (arr->gap_end - arr->gap_start));
+        }
+    }
+    
+    return -1;
+}
+
+int gap_array_copy_to(const GapArray *arr, int *out) {
+    if (!arr || !out) {
+        return -1;
+    }
+    
+    memcpy(out, arr->data, arr->gap_start * sizeof(int));
+    memcpy(out + arr->gap_start, &arr->data[arr->gap_end],
+           _tail_len(arr) * sizeof(int));
+    
+    return 0;
+}
+
+void gap_array_print(const GapArray *arr) {
+    if (!arr) {
+        printf("NULL\n");
+        return;
+    }
+    
+    size_t size = _size(arr);
+    printf("[");
+    for (size_t i = 0; i < size; i++) {
+        printf("%d", arr->data[_physical(arr, i)]);
+        if (i < size - 1) {
+            printf(", ");
+        }
+    }
+    printf("] (size: %zu, capacity: %zu, cursor: %zu)\n",
+           size, arr->capacity, arr->gap_start);
+}
+
+static size_t _gap_array_iter_step(ContainerIter *it, const int **span) {
+    const GapArray *arr = it->source;
+    size_t size = _size(arr);
+    if (it->index >= size) {
+        return 0;
+    }
+    
+    size_t n;
+    if (it->index < arr->gap_start) {
+        *span = arr->data + it->index;
+        n = arr->gap_start - it->index;
+    } else {
+        *span = arr->data + _physical(arr, it->index);
+        n = size - it->index;
+    }
+    it->index += n;
+    
+    return n;
+}
+
+int gap_array_iter_init(const GapArray *arr, ContainerIter *it) {
+    if (!arr || !it) {
+        return -1;
+    }
+    
+    it->step = _gap_array_iter_step;
+    it->source = arr;
+    it->cursor = NULL;
+    it->index = 0;
+    
+    return 0;
+}
@@ -0,0 +1,219 @@
+#define _GNU_SOURCE
+#include "../include/growth.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#define GROWTH_HAVE_MREMAP 1
+#elif defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+#define FALLBACK_PAGE_SIZE 4096
+
+GrowthPolicy growth_policy_default(void) {
+    GrowthPolicy policy;
+    policy.kind = GROWTH_DOUBLE;
+    policy.increment = 0;
+    policy.mmap_threshold = GROWTH_DEFAULT_MMAP_THRESHOLD;
+    return policy;
+}
+
+int growth_policy_validate(const GrowthPolicy *policy) {
+    if (!policy) {
+        return -1;
+    }
+    
+    switch (policy->kind) {
+        case GROWTH_DOUBLE:
+        case GROWTH_HALF:
+        case GROWTH_PAGE_ALIGNED:
+            return 0;
+        case GROWTH_FIXED:
+            return policy->increment > 0 ? 0 : -1;
+    }
+    
+    return -1;
+}
+
+size_t growth_page_size(void) {
+#if defined(__unix__) || defined(__APPLE__)
+    long page = sysconf(_SC_PAGESIZE);
+    if (page > 0) {
+        return (size_t)page;
+    }
+#endif
+    return FALLBACK_PAGE_SIZE;
+}
+
+static size_t _round_up(size_t value, size_t multiple) {
+    size_t rem = value % multiple;
+    if (rem == 0) {
+        return value;
+    }
+    if (value > SIZE_MAX - (multiple - rem)) {
+        return 0;
+    }
+    return value + (multiple - rem);
+}
+
+size_t growth_next_capacity(const GrowthPolicy *policy, size_t current,
+                            size_t required, size_t elem_size) {
+    if (elem_size == 0 || required > SIZE_MAX / elem_size) {
+        return 0;
+    }
+    
+    GrowthKind kind = policy ? policy->kind : GROWTH_DOUBLE;
+    size_t max_elems = SIZE_MAX / elem_size;
+    size_t cap = current > 0 ? current : 1;
+    
+    if (kind == GROWTH_FIXED) {
+        size_t inc = policy->increment > 0 ? policy->increment : 1;
+        if (cap >= required) {
+            return cap;
+        }
+        size_t steps = (required - cap + inc - 1) / inc;
+        if (steps > (max_elems - cap) / inc) {
+            return required;
+        }
+        return cap + steps * inc;
+    }
+    
+    while (cap < required) {
+        size_t next;
+        if (kind == GROWTH_HALF) {
+            next = cap + cap / 2;
+            if (next == cap) {
+                next = cap + 1;
+            }
+        } else {
+            next = cap * 2;
+        }
+        
+        if (next < cap || next > max_elems) {
+            return required;
+        }
+        cap = next;
+    }
+    
+    if (kind == GROWTH_PAGE_ALIGNED) {
+        size_t bytes = _round_up(cap * elem_size, growth_page_size());
+        if (bytes != 0) {
+            cap = bytes / elem_size;
+        }
+    }
+    
+    return cap;
+}
+
+#ifdef GROWTH_HAVE_MREMAP
+static void* _growth_map(void *ptr, size_t elem_size, size_t old_capacity,
+                         size_t *capacity, GrowthStorage *storage) {
+    size_t page = growth_page_size();
+    size_t bytes = _round_up(*capacity * elem_size, page);
+    if (bytes == 0) {
+        return NULL;
+    }
+    
+    void *mem;
+    if (*storage == GROWTH_STORAGE_MAPPED) {
+        size_t old_bytes = _round_up(old_capacity * elem_size, page);
+        mem = mremap(ptr, old_bytes, bytes, MREMAP_MAYMOVE);
+        if (mem == MAP_FAILED) {
+            return NULL;
+        }
+    } else {
+        mem = mmap(NULL, bytes, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mem == MAP_FAILED) {
+            return NULL;
+        }
+        if (ptr) {
+            size_t keep = old_capacity < *capacity ? old_capacity : *capacity;
+            memcpy(mem, ptr, keep * elem_size);
+            free(ptr);
+        }
+    }
+    
+    *storage = GROWTH_STORAGE_MAPPED;
+    *capacity = bytes / elem_size;
+    return mem;
+}
+#endif
+
+static void* _growth_copy_out(const void *ptr, size_t elem_size,
+                              size_t old_capacity, size_t *capacity,
+                              GrowthStorage *storage,
+                              const GrowthPolicy *policy) {
+    GrowthStorage fresh = GROWTH_STORAGE_HEAP;
+    void *mem = growth_realloc(NULL, elem_size, 0, capacity, &fresh, policy);
+    if (!mem) {
+        return NULL;
+    }
+    
+    size_t keep = old_capacity < *capacity ? old_capacity : *capacity;
+    if (ptr && keep > 0) {
+        memcpy(mem, ptr, keep * elem_size);
+    }
+    
+    *storage = fresh;
+    return mem;
+}
+
+void* growth_realloc(void *ptr, size_t elem_size, size_t old_capacity,
+                     size_t *capacity, GrowthStorage *storage,
+                     const GrowthPolicy *policy) {
+    if (!capacity || !storage || elem_size == 0 || *capacity == 0 ||
+        *capacity > SIZE_MAX / elem_size) {
+        return NULL;
+    }
+    
+    if (*storage == GROWTH_STORAGE_BORROWED ||
+        *storage == GROWTH_STORAGE_INLINE) {
+        return _growth_copy_out(ptr, elem_size, old_capacity, capacity,
+                                storage, policy);
+    }
+    
+#ifdef GROWTH_HAVE_MREMAP
+    size_t threshold = policy ? policy->mmap_threshold : 0;
+    if (*storage == GROWTH_STORAGE_MAPPED ||
+        (threshold > 0 && *capacity * elem_size >= threshold)) {
+        return _growth_map(ptr, elem_size, old_capacity, capacity, storage);
+    }
+#else
+    (void)old_capacity;
+    (void)policy;
+#endif
+    
+    void *mem = realloc(ptr, *capacity * elem_size);
+    if (!mem) {
+        return NULL;
+    }
+    
+    *storage = GROWTH_STORAGE_HEAP;
+    return mem;
+}
+
+void growth_free(void *ptr, size_t elem_size, size_t capacity,
+                 GrowthStorage storage) {
+    if (!ptr || storage == GROWTH_STORAGE_BORROWED ||
+        storage == GROWTH_STORAGE_INLINE) {
+        return;
+    }
+    
+#ifdef GROWTH_HAVE_MREMAP
+    if (storage == GROWTH_STORAGE_MAPPED) {
+        munmap(ptr, _round_up(capacity * elem_size, growth_page_size()));
+        return;
+    }
+#else
+    (void)elem_size;
+    (void)capacity;
+    (void)storage;
+#endif
+    
+    free(ptr);
+}
@@ -0,0 +1,270 @@
+#include "../include/indexed_pqueue.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+
+#define ARITY 4
+#define ABSENT SIZE_MAX
+
+// Keys and ids are parallel arrays in heap order: comparisons only touch
+// the dense key array, and the id array is written once per level
+struct IndexedPQ {
+    int *keys;
+    size_t *ids;
+    size_t *pos;    // Heap index of each id, or ABSENT
+    size_t size;
+    size_t max_ids;
+};
+
+static void _place(IndexedPQ *pq, size_t index, size_t id, int key) {
+    pq->keys[index] = key;
+    pq->ids[index] = id;
+    pq->pos[id] = index;
+}
+
+// Moves a hole up from index and drops (id, key) into it
+static void _sift_up(IndexedPQ *pq, size_t index, size_t id, int key) {
+    while (index > 0) {
+        size_t parent = (index - 1) / ARITY;
+        if (key >= pq->keys[parent]) {
+            break;
+        }
+        
+        _place(pq, index, pq->ids[parent], pq->keys[parent]);
+        index = parent;
+    }
+    _place(pq, index, id, key);
+}
+
+static void _sift_down(IndexedPQ *pq, size_t index, size_t id, int key) {
+    while (1) {
+        size_t first = ARITY * index + 1;
+        if (first >= pq->size) {
+            break;
+        }
+        
+        size_t last = first + ARITY < pq->size ? first + ARITY : pq->size;
+        size_t child = first;
+        for (size_t i = first + 1; i < last; i++) {
+            if (pq->keys[i] < pq->keys[child]) {
+                child = i;
+            }
+        }
+        if (pq->keys[child] >= key) {
+            break;
+        }
+        
+        _place(pq, index, pq->ids[child], pq->keys[child]);
+        index = child;
+    }
+    _place(pq, index, id, key);
+}
+
+// Fills the slot at index with the last element, restoring heap order
+static void _fill_hole(IndexedPQ *pq, size_t index) {
+    pq->size--;
+    if (index == pq->size) {
+        return;
+    }
+    
+    size_t id = pq->ids[pq->size];
+    int key = pq->keys[pq->size];
+    if (index > 0 && key < pq->keys[(index - 1) / ARITY]) {
+        _sift_up(pq, index, id, key);
+    } else {
+        _sift_down(pq, index, id, key);
+    }
+}
+
+static int _queued(const IndexedPQ *pq, size_t id) {
+    return id < pq->max_ids && pq->pos[id] != ABSENT;
+}
+
+IndexedPQ* ipqueue_create(size_t max_ids) {
+    if (max_ids == 0 || max_ids > SIZE_MAX / sizeof(size_t)) {
+        return NULL;
+    }
+    
+    IndexedPQ *pq = malloc(sizeof(IndexedPQ));
+    if (!pq) {
+        return NULL;
+    }
+    
+    pq->keys = malloc(max_ids * sizeof(int));
+    pq->ids = malloc(max_ids * sizeof(size_t));
+    pq->pos = malloc(max_ids * sizeof(size_t));
+    if (!pq->keys || !pq->ids || !pq->pos) {
+        free(pq->keys);
+        free(pq->ids);
+        free(pq->pos);
+        free(pq);
+        return NULL;
+    }
+    
+    for (size_t i = 0; i < max_ids; i++) {
+        pq->pos[i] = ABSENT;
+    }
+    pq->size = 0;
+    pq->max_ids = max_ids;
+    
+    return pq;
+}
+
+void ipqueue_destroy(IndexedPQ *pq) {
+    if (!pq) {
+        return;
+    }
+    
+    free(pq->keys);
+    free(pq->ids);
+    free(pq->pos);
+    free(pq);
+}
+
+int ipqueue_push(IndexedPQ *pq, size_t id, int priority) {
+    if (!pq || id >= pq->max_ids || pq->pos[id] != ABSENT) {
+        return -1;
+    }
+    
+    pq->size++;
+    _sift_up(pq, pq->size - 1, id, priority);
+    return 0;
+}
+
+int ipqueue_pop(IndexedPQ *pq, size_t *out_id, int *out_priority) {
+    if (!pq || !out_id || pq->size == 0) {
+        return -1;
+    }
+    
+    *out_id = pq->ids[0];
+    if (out_priority) {
+        *out_priority = pq->keys[0];
+    }
+    
+    pq->pos[*out_id] = ABSENT;
+    _fill_hole(pq, 0);
+    return 0;
+}
+
+int ipqueue_peek(const IndexedPQ *pq, size_t *out_id, int *out_priority) {
+    if (!pq || !out_id || pq->size == 0) {
+        return -1;
+    }
+    
+    *out_id = pq->ids[0];
+    if (out_priority) {
+        *out_priority = pq->keys[0];
+    }
+    return 0;
+}
+
+int ipqueue_decrease_key(IndexedPQ *pq, size_t id, int priority) {
+    if (!pq || !_queued(pq, id)) {
+        return -1;
+    }
+    
+    size_t index = pq->pos[id];
+    if (priority > pq->keys[index]) {
+        return -1;
+    }
+    
+    _sift_up(pq, index, id, priority);
+    return 0;
+}
+
+int ipqueue_increase_key(IndexedPQ *pq, size_t id, int priority) {
+    if (!pq || !_queued(pq, id)) {
+        return -1;
+    }
+    
+    size_t index = pq->pos[id];
+    if (priority < pq->keys[index]) {
+        return -1;
+    }
+    
+    _sift_down(pq, index, id, priority);
+    return 0;
+}
+
+int ipqueue_remove(IndexedPQ *pq, size_t id, int *out_priority) {
+    if (!pq || !_queued(pq, id)) {
+        return -1;
+    }
+    
+    size_t index = pq->pos[id];
+    if (out_priority) {
+        *out_priority = pq->keys[index];
+    }
+    
+    pq->pos[id] = ABSENT;
+    _fill_hole(pq, index);
+    return 0;
+}
+
+int ipqueue_contains(const IndexedPQ *pq, size_t id) {
+    if (!pq) {
+        return 0;
+    }
+    
+    return _queued(pq, id);
+}
+
+int ipqueue_priority(const IndexedPQ *pq, size_t id, int *out_priority) {
+    if (!pq || !out_priority || !_queued(pq, id)) {
+        return -1;
+    }
+    
+    *out_priority = pq->keys[pq->pos[id]];
+    return 0;
+}
+
+size_t ipqueue_size(const IndexedPQ *pq) {
+    if (!pq) {
+        return 0;
+    }
+    
+    return pq->size;
+}
+
+size_t ipqueue_max_ids(const IndexedPQ *pq) {
+    if (!pq) {
+        return 0;
+    }
+    
+    return pq->max_ids;
+}
+
+int ipqueue_is_empty(const IndexedPQ *pq) {
+    if (!pq) {
+        return 1;
+    }
+    
+    return pq->size == 0;
+}
+
+void ipqueue_clear(IndexedPQ *pq) {
+    if (!pq) {
+        return;
+    }
+    
+    for (size_t i = 0; i < pq->size; i++) {
+        pq->pos[pq->ids[i]] = ABSENT;
+    }
+    pq->size = 0;
+}
+
+void ipqueue_print(const IndexedPQ *pq) {
+    if (!pq) {
+        printf("NULL\n");
+        return;
+    }
+    
+    printf("[");
+    for (size_t i = 0; i < pq->size; i++) {
+        printf("%zu:%d", pq->ids[i], pq->keys[i]);
+        if (i < pq->size - 1) {
+            printf(", ");
+        }
+    }
+    printf("] (size: %zu, max_ids: %zu)\n", pq->size, pq->max_ids);
+}
@@ -0,0 +1,172 @@
+#include "../include/intrusive_list.h"
+
+void ilist_init(IList *list) {
+    if (!list) {
+        return;
+    }
+    
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+}
+
+int ilist_insert_before(IList *list, IListLink *at, IListLink *link) {
+    if (!list || !link) {
+        return -1;
+    }
+    
+    link->next = at;
+    link->prev = at ? at->prev : list->tail;
+    
+    if (link->prev) {
+        link->prev->next = link;
+    } else {
+        list->head = link;
+    }
+    
+    if (at) {
+        at->prev = link;
+    } else {
+        list->tail = link;
+    }
+    
+    list->size++;
+    return 0;
+}
+
+int ilist_insert_after(IList *list, IListLink *at, IListLink *link) {
+    if (!list) {
+        return -1;
+    }
+    
+    return ilist_insert_before(list, at ? at->next : list->head, link);
+}
+
+int ilist_push_front(IList *list, IListLink *link) {
+    if (!list) {
+        return -1;
+    }
+    
+    return ilist_insert_before(list, list->head, link);
+}
+
+int ilist_push_back(IList *list, IListLink *link) {
+    return ilist_insert_before(list, NULL, link);
+}
+
+int ilist_remove(IList *list, IListLink *link) {
+    if (!list || !link || list->size == 0) {
+        return -1;
+    }
+    
+    if (link->prev) {
+        link->prev->next = link->next;
+    } else {
+        list->head = link->next;
+    }
+    
+    if (link->next) {
+        link->next->prev = link->prev;
+    } else {
+        list->tail = link->prev;
+    }
+    
+    link->next = NULL;
+    link->prev = NULL;
+    list->size--;
+    return 0;
+}
+
+IListLink* ilist_pop_front(IList *list) {
+    if (!list || !list->head) {
+        return NULL;
+    }
+    
+    IListLink *link = list->head;
+    ilist_remove(list, link);
+    return link;
+}
+
+IListLink* ilist_pop_back(IList *list) {
+    if (!list || !list->tail) {
+        return NULL;
+    }
+    
+    IListLink *link = list->tail;
+    ilist_remove(list, link);
+    return link;
+}
+
+IListLink* ilist_front(const IList *list) {
+    return list ? list->head : NULL;
+}
+
+IListLink* ilist_back(const IList *list) {
+    return list ? list->tail : NULL;
+}
+
+IListLink* ilist_next(const IListLink *link) {
+    return link ? link->next : NULL;
+}
+
+IListLink* ilist_prev(const IListLink *link) {
+    return link ? link->prev : NULL;
+}
+
+size_t ilist_size(const IList *list) {
+    if (!list) {
+        return 0;
+    }
+    
+    return list->size;
+}
+
+int ilist_is_empty(const IList *list) {
+    if (!list) {
+        return 1;
+    }
+    
+    return list->size == 0;
+}
+
+void ilist_reverse(IList *list) {
+    if (!list || !list->head) {
+        return;
+    }
+    
+    IListLink *current = list->head;
+    IListLink *temp = NULL;
+    
+    while (current) {
+        temp = current->prev;
+        current->prev = current->next;
+        current->next = temp;
+        current = current->prev;
+    }
+    
+    temp = list->head;
+    list->head = list->tail;
+    list->tail = temp;
+}
+
+int ilist_splice(IList *dst, IList *src) {
+    if (!dst || !src || dst == src) {
+        return -1;
+    }
+    
+    if (!src->head) {
+        return 0;
+    }
+    
+    src->head->prev = dst->tail;
+    if (dst->tail) {
+        dst->tail->next = src->head;
+    } else {
+        dst->head = src->head;
+    }
+    dst->tail = src->tail;
+    dst->size += src->size;
+    
+    ilist_init(src);
+    return 0;
+}
@@ -0,0 +1,275 @@
+#include "../include/minmax_heap.h"
+#include "../include/growth.h"
+#include <stdlib.h>
+#include <stdio.h>
+
+#define DEFAULT_CAPACITY 16
+
+struct MinMaxHeap {
+    int *data;
+    size_t size;
+    size_t capacity;
+    GrowthPolicy growth;
+    GrowthStorage storage;
+};
+
+// Depth of index i is floor(log2(i + 1)); the root level (0) is a min level
+static int _on_max_level(size_t index) {
+    unsigned long long n = (unsigned long long)index + 1;
+    return (63 - __builtin_clzll(n)) & 1;
+}
+
+// True if a belongs above b on a level of the given kind. max is a
+// literal at every call site, so each caller gets a fixed comparison.
+static inline int _above(int a, int b, int max) {
+    return max ? a > b : a < b;
+}
+
+// Moves a value up through grandparents (same level kind) using a hole
+static inline void _bubble_up(int *data, size_t index, int value, int max) {
+    while (index > 2) {
+        size_t grandparent = ((index - 1) / 2 - 1) / 2;
+        if (!_above(value, data[grandparent], max)) {
+            break;
+        }
+        
+        data[index] = data[grandparent];
+        index = grandparent;
+    }
+    data[index] = value;
+}
+
+// Index of the best among the children and grandchildren of index
+static inline size_t _best_descendant(const int *data, size_t size,
+                                      size_t index, int max) {
+    size_t first = 2 * index + 1;
+    size_t best = first;
+    if (first + 1 < size && _above(data[first + 1], data[best], max)) {
+        best = first + 1;
+    }
+    
+    // Grandchildren 4i + 3 .. 4i + 6 are contiguous
+    size_t grand = 4 * index + 3;
+    size_t end = grand + 4 < size ? grand + 4 : size;
+    for (size_t i = grand; i < end; i++) {
+        if (_above(data[i], data[best], max)) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+static inline void _trickle_down(int *data, size_t size, size_t index,
+                                 int max) {
+    while (2 * index + 1 < size) {
+        size_t best = _best_descendant(data, size, index, max);
+        if (!_above(data[best], data[index], max)) {
+            return;
+        }
+        
+        int tmp = data[best];
+        data[best] = data[index];
+        data[index] = tmp;
+        
+        // Swapping with a child settles it; a grandchild may now be on
+        // the wrong side of its parent (a level of the opposite kind)
+        if (best <= 2 * index + 2) {
+            return;
+        }
+        
+        size_t parent = (best - 1) / 2;
+        if (_above(data[parent], data[best], max)) {
+            tmp = data[parent];
+            data[parent] = data[best];
+            data[best] = tmp;
+        }
+        index = best;
+    }
+}
+
+static int _reserve(MinMaxHeap *heap, size_t required) {
+    if (required <= heap->capacity) {
+        return 0;
+    }
+    
+    size_t capacity = growth_next_capacity(&heap->growth, heap->capacity,
+                                           required, sizeof(int));
+    if (capacity == 0) {
+        return -1;
+    }
+    
+    int *data = growth_realloc(heap->data, sizeof(int), heap->capacity,
+                               &capacity, &heap->storage, &heap->growth);
+    if (!data) {
+        return -1;
+    }
+    
+    heap->data = data;
+    heap->capacity = capacity;
+    return 0;
+}
+
+MinMaxHeap* mmheap_create(size_t capacity) {
+    if (capacity == 0) {
+        capacity = DEFAULT_CAPACITY;
+    }
+    
+    MinMaxHeap *heap = malloc(sizeof(MinMaxHeap));
+    if (!heap) {
+        return NULL;
+    }
+    
+    heap->data = NULL;
+    heap->size = 0;
+    heap->capacity = 0;
+    heap->growth = growth_policy_default();
+    heap->storage = GROWTH_STORAGE_HEAP;
+    
+    if (_reserve(heap, capacity) != 0) {
+        free(heap);
+        return NULL;
+    }
+    
+    return heap;
+}
+
+void mmheap_destroy(MinMaxHeap *heap) {
+    if (!heap) {
+        return;
+    }
+    
+    growth_free(heap->data, sizeof(int), heap->capacity, heap->storage);
+    free(heap);
+}
+
+int mmheap_push(MinMaxHeap *heap, int value) {
+    if (!heap || _reserve(heap, heap->size + 1) != 0) {
+        return -1;
+    }
+    
+    size_t index = heap->size++;
+    if (index == 0) {
+        heap->data[0] = value;
+        return 0;
+    }
+    
+    // Compare with the parent to decide which chain of levels it climbs
+    size_t parent = (index - 1) / 2;
+    int parent_value = heap->data[parent];
+    if (_on_max_level(index)) {
+        if (value < parent_value) {
+            heap->data[index] = parent_value;
+            _bubble_up(heap->data, parent, value, 0);
+        } else {
+            _bubble_up(heap->data, index, value, 1);
+        }
+    } else {
+        if (value > parent_value) {
+            heap->data[index] = parent_value;
+            _bubble_up(heap->data, parent, value, 1);
+        } else {
+            _bubble_up(heap->data, index, value, 0);
+        }
+    }
+    
+    return 0;
+}
+
+static size_t _max_index(const MinMaxHeap *heap) {
+    if (heap->size == 1) {
+        return 0;
+    }
+    if (heap->size == 2 || heap->data[1] >= heap->data[2]) {
+        return 1;
+    }
+    return 2;
+}
+
+int mmheap_pop_min(MinMaxHeap *heap, int *out_value) {
+    if (!heap || !out_value || heap->size == 0) {
+        return -1;
+    }
+    
+    *out_value = heap->data[0];
+    heap->size--;
+    if (heap->size > 0) {
+        heap->data[0] = heap->data[heap->size];
+        _trickle_down(heap->data, heap->size, 0, 0);
+    }
+    
+    return 0;
+}
+
+int mmheap_pop_max(MinMaxHeap *heap, int *out_value) {
+    if (!heap || !out_value || heap->size == 0) {
+        return -1;
+    }
+    
+    size_t index = _max_index(heap);
+    *out_value = heap->data[index];
+    heap->size--;
+    if (index < heap->size) {
+        heap->data[index] = heap->data[heap->size];
+        _trickle_down(heap->data, heap->size, index, 1);
+    }
+    
+    return 0;
+}
+
+int mmheap_peek_min(const MinMaxHeap *heap, int *out_value) {
+    if (!heap || !out_value || heap->size == 0) {
+        return -1;
+    }
+    
+    *out_value = heap->data[0];
+    return 0;
+}
+
+int mmheap_peek_max(const MinMaxHeap *heap, int *out_value) {
+    if (!heap || !out_value || heap->size == 0) {
+        return -1;
+    }
+    
+    *out_value = heap->data[_max_index(heap)];
+    return 0;
+}
+
+size_t mmheap_size(const MinMaxHeap *heap) {
+    if (!heap) {
+        return 0;
+    }
+    
+    return heap->size;
+}
+
+int mmheap_is_empty(const MinMaxHeap *heap) {
+    if (!heap) {
+        return 1;
+    }
+    
+    return heap->size == 0;
+}
+
+void mmheap_clear(MinMaxHeap *heap) {
+    if (!heap) {
+        return;
+    }
+    
+    heap->size = 0;
+}
+
+void mmheap_print(const MinMaxHeap *heap) {
+    if (!heap) {
+        printf("NULL\n");
+        return;
+    }
+    
+    printf("[");
+    for (size_t i = 0; i < heap->size; i++) {
+        printf("%d", heap->data[i]);
+        if (i < heap->size - 1) {
+            printf(", ");
+        }
+    }
+    printf("] (size: %zu, capacity: %zu)\n", heap->size, heap->capacity);
+}
@@ -0,0 +1,316 @@
+#include "../include/pairing_heap.h"
+#include <stdlib.h>
+#include <stdio.h>
+
+#define SLAB_NODES 256
+
+struct PHeapNode {
+    int value;
+    PHeapNode *child;   // Leftmost child
+    PHeapNode *sibling; // Right sibling; next free node while pooled
+    PHeapNode *prev;    // Left sibling, or parent for a leftmost child
+};
+
+typedef struct Slab {
+    struct Slab *next;
+    PHeapNode nodes[SLAB_NODES];
+} Slab;
+
+struct PairingHeap {
+    PHeapNode *root;
+    size_t size;
+    PHeapNode *free_nodes;
+    PHeapNode *free_tail;   // Tails make meld's pool splice O(1)
+    Slab *slabs;
+    Slab *slabs_tail;
+};
+
+static void _node_release(PairingHeap *heap, PHeapNode *node) {
+    node->sibling = heap->free_nodes;
+    if (!heap->free_nodes) {
+        heap->free_tail = node;
+    }
+    heap->free_nodes = node;
+}
+
+static int _refill_pool(PairingHeap *heap) {
+    Slab *slab = malloc(sizeof(Slab));
+    if (!slab) {
+        return -1;
+    }
+    
+    slab->next = heap->slabs;
+    if (!heap->slabs) {
+        heap->slabs_tail = slab;
+    }
+    heap->slabs = slab;
+    
+    // Pushed in reverse so nodes come out in address order
+    for (size_t i = SLAB_NODES; i > 0; i--) {
+        _node_release(heap, &slab->nodes[i - 1]);
+    }
+    
+    return 0;
+}
+
+static PHeapNode* _node_alloc(PairingHeap *heap) {
+    if (!heap->free_nodes && _refill_pool(heap) != 0) {
+        return NULL;
+    }
+    
+    PHeapNode *node = heap->free_nodes;
+    heap->free_nodes = node->sibling;
+    if (!heap->free_nodes) {
+        heap->free_tail = NULL;
+    }
+    return node;
+}
+
+// Makes the larger root the leftmost child of the smaller; returns the
+// winner, whose own sibling/prev links are left for the caller
+static PHeapNode* _link(PHeapNode *a, PHeapNode *b) {
+    if (b->value < a->value) {
+        PHeapNode *tmp = a;
+        a = b;
+        b = tmp;
+    }
+    
+    b->prev = a;
+    b->sibling = a->child;
+    if (a->child) {
+        a->child->prev = b;
+    }
+    a->child = b;
+    return a;
+}
+
+// Two-pass pairing: link neighbours left to right, then fold the winners
+// right to left. Iterative, since a root can have O(n) children.
+static PHeapNode* _combine_siblings(PHeapNode *first) {
+    if (!first) {
+        return NULL;
+    }
+    
+    PHeapNode *pairs = NULL; // Winners of pass one, chained back via prev
+    while (first) {
+        PHeapNode *a = first;
+        PHeapNode *b = a->sibling;
+        PHeapNode *winner = a;
+        if (b) {
+            first = b->sibling;
+            winner = _link(a, b);
+        } else {
+            first = NULL;
+        }
+        winner->sibling = NULL;
+        winner->prev = pairs;
+        pairs = winner;
+    }
+    
+    PHeapNode *root = pairs;
+    pairs = pairs->prev;
+    while (pairs) {
+        PHeapNode *next = pairs->prev;
+        root = _link(pairs, root);
+        root->sibling = NULL;
+        pairs = next;
+    }
+    
+    root->prev = NULL;
+    return root;
+}
+
+static void _cut(PHeapNode *node) {
+    if (node->prev->child == node) {
+        node->prev->child = node->sibling;
+    } else {
+        node->prev->sibling = node->sibling;
+    }
+    if (node->sibling) {
+        node->sibling->prev = node->prev;
+    }
+    node->prev = NULL;
+    node->sibling = NULL;
+}
+
+PairingHeap* pheap_create(void) {
+    PairingHeap *heap = malloc(sizeof(PairingHeap));
+    if (!heap) {
+        return NULL;
+    }
+    
+    heap->root = NULL;
+    heap->size = 0;
+    heap->free_nodes = NULL;
+    heap->free_tail = NULL;
+    heap->slabs = NULL;
+    heap->slabs_tail = NULL;
+    
+    return heap;
+}
+
+void pheap_destroy(PairingHeap *heap) {
+    if (!heap) {
+        return;
+    }
+    
+    Slab *slab = heap->slabs;
+    while (slab) {
+        Slab *next = slab->next;
+        free(slab);
+        slab = next;
+    }
+    free(heap);
+}
+
+PHeapNode* pheap_push(PairingHeap *heap, int value) {
+    if (!heap) {
+        return NULL;
+    }
+    
+    PHeapNode *node = _node_alloc(heap);
+    if (!node) {
+        return NULL;
+    }
+    
+    node->value = value;
+    node->child = NULL;
+    node->sibling = NULL;
+    node->prev = NULL;
+    
+    heap->root = heap->root ? _link(heap->root, node) : node;
+    heap->size++;
+    return node;
+}
+
+int pheap_pop(PairingHeap *heap, int *out_value) {
+    if (!heap || !out_value || !heap->root) {
+        return -1;
+    }
+    
+    PHeapNode *root = heap->root;
+    *out_value = root->value;
+    heap->root = _combine_siblings(root->child);
+    _node_release(heap, root);
+    heap->size--;
+    
+    return 0;
+}
+
+int pheap_peek(const PairingHeap *heap, int *out_value) {
+    if (!heap || !out_value || !heap->root) {
+        return -1;
+    }
+    
+    *out_value = heap->root->value;
+    return 0;
+}
+
+int pheap_decrease_key(PairingHeap *heap, PHeapNode *node, int value) {
+    if (!heap || !node || !heap->root || value > node->value) {
+        return -1;
+    }
+    
+    node->value = value;
+    if (node == heap->root) {
+        return 0;
+    }
+    
+    // The subtree stays heap-ordered; only its link to the parent may not
+    _cut(node);
+    heap->root = _link(heap->root, node);
+    return 0;
+}
+
+int pheap_node_value(const PHeapNode *node) {
+    return node ? node->value : 0;
+}
+
+int pheap_meld(PairingHeap *dst, PairingHeap *src) {
+    if (!dst || !src || dst == src) {
+        return -1;
+    }
+    
+    if (src->root) {
+        dst->root = dst->root ? _link(dst->root, src->root) : src->root;
+    }
+    dst->size += src->size;
+    
+    if (src->slabs) {
+        src->slabs_tail->next = dst->slabs;
+        if (!dst->slabs) {
+            dst->slabs_tail = src->slabs_tail;
+        }
+        dst->slabs = src->slabs;
+    }
+    
+    if (src->free_nodes) {
+        src->free_tail->sibling = dst->free_nodes;
+        if (!dst->free_nodes) {
+            dst->free_tail = src->free_tail;
+        }
+        dst->free_nodes = src->free_nodes;
+    }
+    
+    free(src);
+    return 0;
+}
+
+size_t pheap_size(const PairingHeap *heap) {
+    return heap ? heap->size : 0;
+}
+
+int pheap_is_empty(const PairingHeap *heap) {
+    return !heap || heap->size == 0;
+}
+
+void pheap_clear(PairingHeap *heap) {
+    if (!heap) {
+        return;
+    }
+    
+    heap->root = NULL;
+    heap->size = 0;
+    heap->free_nodes = NULL;
+    heap->free_tail = NULL;
+    for (Slab *slab = heap->slabs; slab; slab = slab->next) {
+        for (size_t i = SLAB_NODES; i > 0; i--) {
+            _node_release(heap, &slab->nodes[i - 1]);
+        }
+    }
+}
+
+// A node's parent is the prev of the leftmost sibling in its run
+static PHeapNode* _parent(PHeapNode *node) {
+    while (node->prev && node->prev->child != node) {
+        node = node->prev;
+    }
+    return node->prev;
+}
+
+void pheap_print(const PairingHeap *heap) {
+    if (!heap) {
+        printf("NULL\n");
+        return;
+    }
+    
+    printf("[");
+    PHeapNode *node = heap->root;
+    while (node) {
+        printf("%d", node->value);
+        if (node->child) {
+            node = node->child;
+        } else {
+            while (node && !node->sibling) {
+                node = _parent(node);
+            }
+            if (node) {
+                node = node->sibling;
+            }
+        }
+        if (node) {
+            printf(", ");
+        }
+    }
+    printf("] (size: %zu)\n", heap->size);
+}
@@ -1,56 +1,279 @@
 #include "../include/priority_queue.h"
+#include "../include/growth.h"
+#include "../include/serialize.h"
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__SSE4_1__)
+#include <smmintrin.h>
+#endif
+
+#define DEFAULT_ARITY 2
+#define FLAG_ARITY_MASK 0xFFu
+#define FLAG_MAX_ORDER 0x100u
 
 struct PriorityQueue {
-    int *data;
+    int *data;        // Root of the heap (buffer + pad)
+    int *buffer;      // Allocation backing data
+    size_t pad;       // Leading slots that align each group of children
+    size_t allocated; // Elements in buffer, pad and slack included
     size_t size;
     size_t capacity;
+    unsigned arity;
+    PQueueOrder order;
+    GrowthPolicy growth;
+    GrowthStorage storage;
 };
 
-static void _swap(int *a, int *b) {
-    int temp = *a;
-    *a = *b;
-    *b = temp;
+static int _arity_valid(unsigned arity) {
+    return arity == 2 || arity == 4 || arity == 8;
 }
 
-static void _heapify_up(PriorityQueue *pq, size_t index) {
+// The children of i are data[arity * i + 1 .. arity * i + arity], so the
+// pad is picked from the actual buffer address to put data + 1 on an
+// arity-int boundary in memory; then no group straddles a cache line.
+// realloc only guarantees 16 bytes, which alone would split half of the
+// 32-byte 8-ary groups.
+static size_t _pad_for(const int *buffer, unsigned arity) {
+    size_t group = arity * sizeof(int);
+    size_t misalign = (uintptr_t)buffer % group;
+    size_t aligned = ((group - misalign) % group) / sizeof(int);
+    return (aligned + arity - 1) % arity;
+}
+
+#if defined(__SSE2__)
+static __m128i _min_epi32(__m128i a, __m128i b) {
+#if defined(__SSE4_1__)
+    return _mm_min_epi32(a, b);
+#else
+    __m128i gt = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, a));
+#endif
+}
+
+static __m128i _max_epi32(__m128i a, __m128i b) {
+#if defined(__SSE4_1__)
+    return _mm_max_epi32(a, b);
+#else
+    __m128i gt = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b));
+#endif
+}
+
+static inline __m128i _best_epi32(__m128i a, __m128i b, int max) {
+    return max ? _max_epi32(a, b) : _min_epi32(a, b);
+}
+
+// Broadcasts the best (smallest, or largest for max) lane to all lanes
+static inline __m128i _broadcast_best(__m128i v, int max) {
+    v = _best_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)), max);
+    return _best_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)), max);
+}
+
+static int _lanes_equal(__m128i v, __m128i m) {
+    return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(v, m)));
+}
+#endif
+
+// True if a belongs above b. max is always a literal at the call sites,
+// so each specialization compiles to a single fixed comparison.
+static inline int _above(int a, int b, int max) {
+    return max ? a > b : a < b;
+}
+
+// Index of the best of data[first .. first + count)
+static inline size_t _best_child(const int *data, size_t first, size_t count,
+                                 unsigned arity, int max) {
+#if defined(__SSE2__)
+    // A full group is compared in registers, without data-dependent branches
+    if (count == arity && arity == 4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(data + first));
+        int mask = _lanes_equal(v, _broadcast_best(v, max));
+        return first + (size_t)__builtin_ctz((unsigned)mask);
+    }
+    if (count == arity && arity == 8) {
+        __m128i lo = _mm_loadu_si128((const __m128i*)(data + first));
+        __m128i hi = _mm_loadu_si128((const __m128i*)(data + first + 4));
+        __m128i m = _broadcast_best(_best_epi32(lo, hi, max), max);
+        int mask = _lanes_equal(lo, m) | (_lanes_equal(hi, m) << 4);
+        return first + (size_t)__builtin_ctz((unsigned)mask);
+    }
+#endif
+    
+    size_t best = first;
+    for (size_t i = first + 1; i < first + count; i++) {
+        if (_above(data[i], data[best], max)) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+// Moves a hole up instead of swapping: one store per level
+static inline void _sift_up_d(int *data, size_t index, unsigned arity,
+                              int max) {
+    int value = data[index];
     while (index > 0) {
-        size_t parent = (index - 1) / 2;
+        size_t parent = (index - 1) / arity;
         
-        if (pq->data[index] >= pq->data[parent]) {
+        if (!_above(value, data[parent], max)) {
             break;
         }
         
-        _swap(&pq->data[index], &pq->data[parent]);
+        data[index] = data[parent];
         index = parent;
     }
+    data[index] = value;
 }
 
-static void _heapify_down(PriorityQueue *pq, size_t index) {
+static inline void _sift_down_d(int *data, size_t size, size_t index,
+                                unsigned arity, int max) {
+    int value = data[index];
     while (1) {
-        size_t smallest = index;
-        size_t left = 2 * index + 1;
-        size_t right = 2 * index + 2;
-        
-        if (left < pq->size && pq->data[left] < pq->data[smallest]) {
-            smallest = left;
+        size_t first = arity * index + 1;
+        if (first >= size) {
+            break;
         }
         
-        if (right < pq->size && pq->data[right] < pq->data[smallest]) {
-            smallest = right;
+        // All grandchildren are contiguous: fetch them while comparing
+        if (arity * first + 1 < size) {
+            __builtin_prefetch(data + arity * first + 1);
         }
-        
-        if (smallest == index) {
+        size_t count = size - first < arity ? size - first : arity;
+        size_t child = _best_child(data, first, count, arity, max);
+        if (!_above(data[child], value, max)) {
             break;
         }
         
-        _swap(&pq->data[index], &pq->data[smallest]);
-        index = smallest;
+        data[index] = data[child];
+        index = child;
+    }
+    data[index] = value;
+}
+
+static inline void _sift_up_any(int *data, size_t index, unsigned arity,
+                                int max) {
+    switch (arity) {
+        case 4:
+            _sift_up_d(data, index, 4, max);
+            break;
+        case 8:
+            _sift_up_d(data, index, 8, max);
+            break;
+        default:
+            _sift_up_d(data, index, 2, max);
+            break;
+    }
+}
+
+static inline void _sift_down_any(int *data, size_t size, size_t index,
+                                  unsigned arity, int max) {
+    switch (arity) {
+        case 4:
+            _sift_down_d(data, size, index, 4, max);
+            break;
+        case 8:
+            _sift_down_d(data, size, index, 8, max);
+            break;
+        default:
+            _sift_down_d(data, size, index, 2, max);
+            break;
+    }
+}
+
+// Constant arity and order let the compiler specialize each loop: six
+// branch-free variants instead of one loop calling a comparator
+static void _heapify_up(PriorityQueue *pq, size_t index) {
+    if (pq->order == PQUEUE_MAX) {
+        _sift_up_any(pq->data, index, pq->arity, 1);
+    } else {
+        _sift_up_any(pq->data, index, pq->arity, 0);
+    }
+}
+
+static void _heapify_down(PriorityQueue *pq, size_t index) {
+    if (pq->order == PQUEUE_MAX) {
+        _sift_down_any(pq->data, pq->size, index, pq->arity, 1);
+    } else {
+        _sift_down_any(pq->data, pq->size, index, pq->arity, 0);
+    }
+}
+
+// Floyd's bottom-up construction: sift down every parent, last first.
+// Most nodes sit near the leaves and move at most a level or two, so
+// the whole build is O(n) instead of n pushes at O(log n) each.
+static void _heapify_all(PriorityQueue *pq) {
+    if (pq->size < 2) {
+        return;
+    }
+    
+    for (size_t i = (pq->size - 2) / pq->arity + 1; i > 0; i--) {
+        _heapify_down(pq, i - 1);
+    }
+}
+
+// Reallocates to at least new_capacity elements after the pad. The pad
+// needs up to arity - 1 slots and depends on where the buffer lands.
+static int _resize(PriorityQueue *pq, size_t new_capacity) {
+    size_t slack = pq->arity - 1;
+    if (new_capacity == 0 || new_capacity > SIZE_MAX / sizeof(int) - slack) {
+        return -1;
+    }
+    
+    size_t total = new_capacity + slack;
+    int *buffer = growth_realloc(pq->buffer, sizeof(int),
+                                 pq->allocated, &total,
+                                 &pq->storage, &pq->growth);
+    if (!buffer) {
+        return -1;
+    }
+    
+    // Views start unpadded, and a moved buffer may need a different pad
+    size_t pad = _pad_for(buffer, pq->arity);
+    if (pq->pad != pad) {
+        memmove(buffer + pad, buffer + pq->pad, pq->size * sizeof(int));
+    }
+    
+    pq->buffer = buffer;
+    pq->data = buffer + pad;
+    pq->pad = pad;
+    pq->allocated = total;
+    pq->capacity = total - slack;
+    return 0;
+}
+
+static int _reserve(PriorityQueue *pq, size_t required) {
+    if (required <= pq->capacity) {
+        return 0;
     }
+    
+    return _resize(pq, growth_next_capacity(&pq->growth, pq->capacity,
+                                            required, sizeof(int)));
 }
 
 PriorityQueue* pqueue_create(size_t capacity) {
+    return pqueue_create_with_arity(capacity, DEFAULT_ARITY);
+}
+
+PriorityQueue* pqueue_create_with_arity(size_t capacity, unsigned arity) {
+    return pqueue_create_with_order(capacity, arity, PQUEUE_MIN);
+}
+
+PriorityQueue* pqueue_create_max(size_t capacity) {
+    return pqueue_create_with_order(capacity, DEFAULT_ARITY, PQUEUE_MAX);
+}
+
+PriorityQueue* pqueue_create_with_order(size_t capacity, unsigned arity,
+                                        PQueueOrder order) {
+    if (!_arity_valid(arity) || (order != PQUEUE_MIN && order != PQUEUE_MAX)) {
+        return NULL;
+    }
+    
     if (capacity == 0) {
         capacity = 16;
     }
@@ -60,15 +283,22 @@ PriorityQueue* pqueue_create(size_t capacity) {
         return NULL;
     }
     
-    pq->data = malloc(sizeof(int) * capacity);
-    if (!pq->data) {
+    pq->growth = growth_policy_default();
+    pq->storage = GROWTH_STORAGE_HEAP;
+    pq->buffer = NULL;
+    pq->data = NULL;
+    pq->pad = 0;
+    pq->allocated = 0;
+    pq->size = 0;
+    pq->capacity = 0;
+    pq->arity = arity;
+    pq->order = order;
+    
+    if (_resize(pq, capacity) != 0) {
         free(pq);
         return NULL;
     }
     
-    pq->size = 0;
-    pq->capacity = capacity;
-    
     return pq;
 }
 
@@ -77,23 +307,138 @@ void pqueue_destroy(PriorityQueue *pq) {
         return;
     }
     
-    free(pq->data);
+    growth_free(pq->buffer, sizeof(int), pq->allocated, pq->storage);
     free(pq);
 }
 
+int pqueue_set_growth_policy(PriorityQueue *pq, GrowthPolicy policy) {
+    if (!pq || growth_policy_validate(&policy) != 0) {
+        return -1;
+    }
+    
+    pq->growth = policy;
+    return 0;
+}
+
+unsigned pqueue_arity(const PriorityQueue *pq) {
+    if (!pq) {
+        return 0;
+    }
+    
+    return pq->arity;
+}
+
+PQueueOrder pqueue_order(const PriorityQueue *pq) {
+    if (!pq) {
+        return PQUEUE_MIN;
+    }
+    
+    return pq->order;
+}
+
+static int _heap_valid(const int *data, size_t size, unsigned arity,
+                       PQueueOrder order) {
+    int max = order == PQUEUE_MAX;
+    for (size_t i = 1; i < size; i++) {
+        if (_above(data[i], data[(i - 1) / arity], max)) {
+            return 0;
+        }
+    }
+    
+    return 1;
+}
+
+// Files written before arities existed have flags == 0 (binary min-heap)
+static unsigned _arity_from_flags(uint32_t flags) {
+    unsigned arity = (unsigned)(flags & FLAG_ARITY_MASK);
+    return arity == 0 ? DEFAULT_ARITY : arity;
+}
+
+static PQueueOrder _order_from_flags(uint32_t flags) {
+    return (flags & FLAG_MAX_ORDER) ? PQUEUE_MAX : PQUEUE_MIN;
+}
+
+int pqueue_save_fd(const PriorityQueue *pq, int fd) {
+    if (!pq) {
+        return -1;
+    }
+    
+    SerialHeader header;
+    serial_header_init(&header, SERIAL_KIND_PQUEUE, sizeof(int), pq->size);
+    header.flags = pq->arity;
+    if (pq->order == PQUEUE_MAX) {
+        header.flags |= FLAG_MAX_ORDER;
+    }
+    return serial_write(fd, &header, pq->data);
+}
+
+PriorityQueue* pqueue_load_fd(int fd) {
+    SerialHeader header;
+    if (serial_read_header(fd, &header, SERIAL_KIND_PQUEUE, sizeof(int)) != 0) {
+        return NULL;
+    }
+    
+    unsigned arity = _arity_from_flags(header.flags);
+    PQueueOrder order = _order_from_flags(header.flags);
+    PriorityQueue *pq = pqueue_create_with_order((size_t)header.count, arity,
+                                                 order);
+    if (!pq) {
+        return NULL;
+    }
+    
+    // Heap order is stored as-is, so loading is a straight copy
+    if (serial_read_payload(fd, pq->data, sizeof(int),
+                            (size_t)header.count) != 0 ||
+        !_heap_valid(pq->data, (size_t)header.count, arity, order)) {
+        pqueue_destroy(pq);
+        return NULL;
+    }
+    
+    pq->size = (size_t)header.count;
+    return pq;
+}
+
+PriorityQueue* pqueue_view_from_buffer(void *buf, size_t len) {
+    SerialHeader header;
+    int *payload = serial_view(buf, len, &header, SERIAL_KIND_PQUEUE,
+                               sizeof(int));
+    if (!payload) {
+        return NULL;
+    }
+    
+    unsigned arity = _arity_from_flags(header.flags);
+    PQueueOrder order = _order_from_flags(header.flags);
+    if (!_arity_valid(arity) ||
+        !_heap_valid(payload, (size_t)header.count, arity, order)) {
+        return NULL;
+    }
+    
+    PriorityQueue *pq = malloc(sizeof(PriorityQueue));
+    if (!pq) {
+        return NULL;
+    }
+    
+    pq->growth = growth_policy_default();
+    pq->storage = GROWTH_STORAGE_BORROWED;
+    pq->buffer = payload;
+    pq->data = payload;
+    pq->pad = 0;
+    pq->allocated = (size_t)header.count;
+    pq->size = (size_t)header.count;
+    pq->capacity = (size_t)header.count;
+    pq->arity = arity;
+    pq->order = order;
+    
+    return pq;
+}
+
 int pqueue_push(PriorityQueue *pq, int value) {
     if (!pq) {
         return -1;
     }
     
-    if (pq->size == pq->capacity) {
-        size_t new_capacity = pq->capacity * 2;
-        int *new_data = realloc(pq->data, sizeof(int) * new_capacity);
-        if (!new_data) {
-            return -1;
-        }
-        pq->data = new_data;
-        pq->capacity = new_capacity;
+    if (_reserve(pq, pq->size + 1) != 0) {
+        return -1;
     }
     
     pq->data[pq->size] = value;
@@ -103,6 +448,69 @@ int pqueue_push(PriorityQueue *pq, int value) {
     return 0;
 }
 
+PriorityQueue* pqueue_create_from_array(const int *values, size_t n) {
+    if (!values && n > 0) {
+        return NULL;
+    }
+    
+    PriorityQueue *pq = pqueue_create(n);
+    if (!pq) {
+        return NULL;
+    }
+    
+    if (n > 0) {
+        memcpy(pq->data, values, n * sizeof(int));
+    }
+    pq->size = n;
+    _heapify_all(pq);
+    
+    return pq;
+}
+
+static size_t _log2_floor(size_t n) {
+    size_t log = 0;
+    while (n >>= 1) {
+        log++;
+    }
+    return log;
+}
+
+int pqueue_push_n(PriorityQueue *pq, const int *values, size_t n) {
+    if (!pq || (!values && n > 0) || n > SIZE_MAX - pq->size) {
+        return -1;
+    }
+    
+    if (_reserve(pq, pq->size + n) != 0) {
+        return -1;
+    }
+    
+    size_t old_size = pq->size;
+    memcpy(pq->data + old_size, values, n * sizeof(int));
+    
+    // n sift-ups cost about n * log(total); a full rebuild costs ~total
+    size_t total = old_size + n;
+    if (n * _log2_floor(total) > total) {
+        pq->size = total;
+        _heapify_all(pq);
+        return 0;
+    }
+    
+    for (size_t i = old_size; i < total; i++) {
+        _heapify_up(pq, i);
+        pq->size++;
+    }
+    
+    return 0;
+}
+
+int pqueue_merge(PriorityQueue *dst, const PriorityQueue *src) {
+    if (!dst || !src || dst == src) {
+        return -1;
+    }
+    
+    return pqueue_push_n(dst, src->data, src->size);
+}
+
 int pqueue_pop(PriorityQueue *pq, int *out_value) {
     if (!pq || !out_value || pq->size == 0) {
         return -1;
@@ -119,6 +527,38 @@ int pqueue_pop(PriorityQueue *pq, int *out_value) {
     return 0;
 }
 
+int pqueue_replace_top(PriorityQueue *pq, int value, int *out_value) {
+    if (!pq || pq->size == 0) {
+        return -1;
+    }
+    
+    if (out_value) {
+        *out_value = pq->data[0];
+    }
+    
+    // One sift-down instead of a pop's sift-down plus a push's sift-up
+    pq->data[0] = value;
+    _heapify_down(pq, 0);
+    return 0;
+}
+
+int pqueue_pop_n(PriorityQueue *pq, int *out, size_t k) {
+    if (!pq || (!out && k > 0) || k > pq->size) {
+        return -1;
+    }
+    
+    for (size_t i = 0; i < k; i++) {
+        out[i] = pq->data[0];
+        pq->size--;
+        if (pq->size > 0) {
+            pq->data[0] = pq->data[pq->size];
+            _heapify_down(pq, 0);
+        }
+    }
+    
+    return 0;
+}
+
 int pqueue_peek(const PriorityQueue *pq, int *out_value) {
     if (!pq || !out_value || pq->size == 0) {
         return -1;
@@ -144,6 +584,14 @@ size_t pqueue_capacity(const PriorityQueue *pq) {
     return pq->capacity;
 }
 
+const int* pqueue_data(const PriorityQueue *pq) {
+    if (!pq) {
+        return NULL;
+    }
+    
+    return pq->data;
+}
+
 int pqueue_is_empty(const PriorityQueue *pq) {
     if (!pq) {
         return 1;
@@ -168,3 +168,29 @@ void queue_print(const Queue *queue) {
     }
     printf(")\n");
 }
+
+static size_t _queue_iter_step(ContainerIter *it, const int **span) {
+    const Node *node = it->cursor;
+    if (!node) {
+        return 0;
+    }
+    
+    *span = &node->data;
+    it->cursor = node->next;
+    it->index++;
+    
+    return 1;
+}
+
+int queue_iter_init(const Queue *queue, ContainerIter *it) {
+    if (!queue || !it) {
+        return -1;
+    }
+    
+    it->step = _queue_iter_step;
+    it->source = queue;
+    it->cursor = queue->front;
+    it->index = 0;
+    
+    return 0;
+}
@@ -0,0 +1,242 @@
+#include "../include/radix_heap.h"
+#include "../include/growth.h"
+#include <stdlib.h>
+#include <limits.h>
+
+#define NUM_BUCKETS 65
+#define BUCKET_INITIAL_CAPACITY 8
+
+typedef struct {
+    uint64_t *keys;
+    size_t size;
+    size_t capacity;
+    uint64_t min;       // Smallest key held (valid when size > 0)
+    GrowthStorage storage;
+} Bucket;
+
+// Bucket 0 holds keys equal to last; bucket b > 0 holds keys whose
+// highest bit differing from last is bit b - 1
+struct RadixHeap {
+    Bucket buckets[NUM_BUCKETS];
+    uint64_t occupied;  // Bit b - 1 set iff bucket b > 0 is non-empty
+    uint64_t last;      // Last popped key: the floor for new pushes
+    size_t size;
+    GrowthPolicy growth;
+};
+
+// Ints map onto [0, 2^32) in order, so the int and u64 paths share code
+static uint64_t _key_of(int value) {
+    return (uint64_t)((int64_t)value - INT_MIN);
+}
+
+static int _value_of(uint64_t key) {
+    return (int)((int64_t)key + INT_MIN);
+}
+
+static size_t _bucket_of(uint64_t key, uint64_t last) {
+    if (key == last) {
+        return 0;
+    }
+    return (size_t)(64 - __builtin_clzll(key ^ last));
+}
+
+static int _bucket_reserve(RadixHeap *heap, Bucket *bucket, size_t required) {
+    if (required <= bucket->capacity) {
+        return 0;
+    }
+    
+    size_t capacity = growth_next_capacity(&heap->growth, bucket->capacity,
+                                           required, sizeof(uint64_t));
+    if (capacity == 0) {
+        return -1;
+    }
+    if (capacity < BUCKET_INITIAL_CAPACITY) {
+        capacity = BUCKET_INITIAL_CAPACITY;
+    }
+    
+    uint64_t *keys = growth_realloc(bucket->keys, sizeof(uint64_t),
+                                    bucket->capacity, &capacity,
+                                    &bucket->storage, &heap->growth);
+    if (!keys) {
+        return -1;
+    }
+    
+    bucket->keys = keys;
+    bucket->capacity = capacity;
+    return 0;
+}
+
+// Caller has reserved room
+static void _bucket_append(RadixHeap *heap, size_t b, uint64_t key) {
+    Bucket *bucket = &heap->buckets[b];
+    if (bucket->size == 0 || key < bucket->min) {
+        bucket->min = key;
+    }
+    bucket->keys[bucket->size++] = key;
+    if (b > 0) {
+        heap->occupied |= 1ULL << (b - 1);
+    }
+}
+
+// Empties the lowest non-empty bucket into lower ones around its minimum.
+// Room is reserved first, so on allocation failure nothing has moved.
+static int _refill_bucket0(RadixHeap *heap) {
+    size_t b = (size_t)__builtin_ctzll(heap->occupied) + 1;
+    Bucket *src = &heap->buckets[b];
+    uint64_t last = src->min;
+    
+    size_t counts[NUM_BUCKETS] = {0};
+    for (size_t i = 0; i < src->size; i++) {
+        counts[_bucket_of(src->keys[i], last)]++;
+    }
+    for (size_t t = 0; t < b; t++) {
+        Bucket *dst = &heap->buckets[t];
+        if (_bucket_reserve(heap, dst, dst->size + counts[t]) != 0) {
+            return -1;
+        }
+    }
+    
+    // Every key differs from the new minimum below bit b - 1, so each
+    // lands in a strictly lower bucket and never moves back into src
+    heap->last = last;
+    heap->occupied &= ~(1ULL << (b - 1));
+    for (size_t i = 0; i < src->size; i++) {
+        uint64_t key = src->keys[i];
+        _bucket_append(heap, _bucket_of(key, last), key);
+    }
+    src->size = 0;
+    
+    return 0;
+}
+
+RadixHeap* radixheap_create(void) {
+    RadixHeap *heap = malloc(sizeof(RadixHeap));
+    if (!heap) {
+        return NULL;
+    }
+    
+    for (size_t b = 0; b < NUM_BUCKETS; b++) {
+        heap->buckets[b].keys = NULL;
+        heap->buckets[b].size = 0;
+        heap->buckets[b].capacity = 0;
+        heap->buckets[b].min = 0;
+        heap->buckets[b].storage = GROWTH_STORAGE_HEAP;
+    }
+    heap->occupied = 0;
+    heap->last = 0;
+    heap->size = 0;
+    heap->growth = growth_policy_default();
+    
+    return heap;
+}
+
+void radixheap_destroy(RadixHeap *heap) {
+    if (!heap) {
+        return;
+    }
+    
+    for (size_t b = 0; b < NUM_BUCKETS; b++) {
+        Bucket *bucket = &heap->buckets[b];
+        growth_free(bucket->keys, sizeof(uint64_t), bucket->capacity,
+                    bucket->storage);
+    }
+    free(heap);
+}
+
+int radixheap_push_u64(RadixHeap *heap, uint64_t key) {
+    if (!heap || key < heap->last) {
+        return -1;
+    }
+    
+    size_t b = _bucket_of(key, heap->last);
+    Bucket *bucket = &heap->buckets[b];
+    if (_bucket_reserve(heap, bucket, bucket->size + 1) != 0) {
+        return -1;
+    }
+    
+    _bucket_append(heap, b, key);
+    heap->size++;
+    return 0;
+}
+
+int radixheap_pop_u64(RadixHeap *heap, uint64_t *out_key) {
+    if (!heap || !out_key || heap->size == 0) {
+        return -1;
+    }
+    
+    if (heap->buckets[0].size == 0 && _refill_bucket0(heap) != 0) {
+        return -1;
+    }
+    
+    heap->buckets[0].size--;
+    heap->size--;
+    *out_key = heap->last;
+    return 0;
+}
+
+int radixheap_peek_u64(const RadixHeap *heap, uint64_t *out_key) {
+    if (!heap || !out_key || heap->size == 0) {
+        return -1;
+    }
+    
+    if (heap->buckets[0].size > 0) {
+        *out_key = heap->last;
+    } else {
+        size_t b = (size_t)__builtin_ctzll(heap->occupied) + 1;
+        *out_key = heap->buckets[b].min;
+    }
+    return 0;
+}
+
+int radixheap_push(RadixHeap *heap, int value) {
+    return radixheap_push_u64(heap, _key_of(value));
+}
+
+int radixheap_pop(RadixHeap *heap, int *out_value) {
+    uint64_t key;
+    if (!out_value || radixheap_pop_u64(heap, &key) != 0) {
+        return -1;
+    }
+    
+    *out_value = _value_of(key);
+    return 0;
+}
+
+int radixheap_peek(const RadixHeap *heap, int *out_value) {
+    uint64_t key;
+    if (!out_value || radixheap_peek_u64(heap, &key) != 0) {
+        return -1;
+    }
+    
+    *out_value = _value_of(key);
+    return 0;
+}
+
+size_t radixheap_size(const RadixHeap *heap) {
+    if (!heap) {
+        return 0;
+    }
+    
+    return heap->size;
+}
+
+int radixheap_is_empty(const RadixHeap *heap) {
+    if (!heap) {
+        return 1;
+    }
+    
+    return heap->size == 0;
+}
+
+void radixheap_clear(RadixHeap *heap) {
+    if (!heap) {
+        return;
+    }
+    
+    for (size_t b = 0; b < NUM_BUCKETS; b++) {
+        heap->buckets[b].size = 0;
+    }
+    heap->occupied = 0;
+    heap->last = 0;
+    heap->size = 0;
+}
@@ -151,3 +151,34 @@ void ring_buffer_print(const RingBuffer *rb) {
     
     printf("] (size: %zu, capacity: %zu)\n", rb->size, rb->capacity);
 }
+
+static size_t _ring_buffer_iter_step(ContainerIter *it, const int **span) {
+    const RingBuffer *rb = it->source;
+    if (it->index >= rb->size) {
+        return 0;
+    }
+    
+    size_t start = (rb->read_index + it->index) % rb->capacity;
+    size_t n = rb->size - it->index;
+    if (n > rb->capacity - start) {
+        n = rb->capacity - start;
+    }
+    
+    *span = rb->data + start;
+    it->index += n;
+    
+    return n;
+}
+
+int ring_buffer_iter_init(const RingBuffer *rb, ContainerIter *it) {
+    if (!rb || !it) {
+        return -1;
+    }
+    
+    it->step = _ring_buffer_iter_step;
+    it->source = rb;
+    it->cursor = NULL;
+    it->index = 0;
+    
+    return 0;
+}
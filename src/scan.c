@@ -0,0 +1,287 @@
+#include "../include/scan.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__SSE4_1__)
+#include <smmintrin.h>
+#endif
+
+#define SUB_HISTOGRAMS 4
+#define SUB_HISTOGRAM_MAX_BINS (1 << 16)
+
+#if defined(__SSE2__)
+static __m128i _min_epi32(__m128i a, __m128i b) {
+#if defined(__SSE4_1__)
+    return _mm_min_epi32(a, b);
+#else
+    __m128i gt = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, a));
+#endif
+}
+
+static __m128i _max_epi32(__m128i a, __m128i b) {
+#if defined(__SSE4_1__)
+    return _mm_max_epi32(a, b);
+#else
+    __m128i gt = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b));
+#endif
+}
+
+// Sign-extends four int32 lanes into two int64 pairs
+static void _widen_epi32(__m128i v, __m128i *lo, __m128i *hi) {
+    __m128i sign = _mm_srai_epi32(v, 31);
+    *lo = _mm_unpacklo_epi32(v, sign);
+    *hi = _mm_unpackhi_epi32(v, sign);
+}
+
+static int64_t _hsum_epi64(__m128i v) {
+    int64_t lanes[2];
+    _mm_storeu_si128((__m128i*)lanes, v);
+    return lanes[0] + lanes[1];
+}
+#endif
+
+int64_t scan_sum(const int *data, size_t n) {
+    if (!data) {
+        return 0;
+    }
+    
+    size_t i = 0;
+    int64_t total = 0;
+    
+#if defined(__SSE2__)
+    __m128i acc0 = _mm_setzero_si128();
+    __m128i acc1 = _mm_setzero_si128();
+    for (; i + 4 <= n; i += 4) {
+        __m128i lo, hi;
+        _widen_epi32(_mm_loadu_si128((const __m128i*)(data + i)), &lo, &hi);
+        acc0 = _mm_add_epi64(acc0, lo);
+        acc1 = _mm_add_epi64(acc1, hi);
+    }
+    total = _hsum_epi64(_mm_add_epi64(acc0, acc1));
+#endif
+    
+    for (; i < n; i++) {
+        total += data[i];
+    }
+    
+    return total;
+}
+
+static int _reduce(const int *data, size_t n, int want_max) {
+    size_t i = 0;
+    int best = data[0];
+    
+#if defined(__SSE2__)
+    if (n >= 4) {
+        __m128i acc = _mm_loadu_si128((const __m128i*)data);
+        for (i = 4; i + 4 <= n; i += 4) {
+            __m128i v = _mm_loadu_si128((const __m128i*)(data + i));
+            acc = want_max ? _max_epi32(acc, v) : _min_epi32(acc, v);
+        }
+        int lanes[4];
+        _mm_storeu_si128((__m128i*)lanes, acc);
+        best = lanes[0];
+        for (int k = 1; k < 4; k++) {
+            if (want_max ? lanes[k] > best : lanes[k] < best) {
+                best = lanes[k];
+            }
+        }
+    }
+#endif
+    
+    for (; i < n; i++) {
+        if (want_max ? data[i] > best : data[i] < best) {
+            best = data[i];
+        }
+    }
+    
+    return best;
+}
+
+int scan_min(const int *data, size_t n, int *out_value) {
+    if (!data || !out_value || n == 0) {
+        return -1;
+    }
+    
+    *out_value = _reduce(data, n, 0);
+    return 0;
+}
+
+int scan_max(const int *data, size_t n, int *out_value) {
+    if (!data || !out_value || n == 0) {
+        return -1;
+    }
+    
+    *out_value = _reduce(data, n, 1);
+    return 0;
+}
+
+// Two vectorizable passes (reduce, then locate) beat one branchy pass
+static size_t _find_first(const int *data, size_t n, int value) {
+    size_t i = 0;
+    
+#if defined(__SSE2__)
+    __m128i needle = _mm_set1_epi32(value);
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(data + i));
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(v, needle)));
+        if (mask) {
+            return i + (size_t)__builtin_ctz((unsigned)mask);
+        }
+    }
+#endif
+    
+    for (; i < n; i++) {
+        if (data[i] == value) {
+            return i;
+        }
+    }
+    
+    return n;
+}
+
+int scan_argmin(const int *data, size_t n, size_t *out_index) {
+    if (!data || !out_index || n == 0) {
+        return -1;
+    }
+    
+    *out_index = _find_first(data, n, _reduce(data, n, 0));
+    return 0;
+}
+
+int scan_argmax(const int *data, size_t n, size_t *out_index) {
+    if (!data || !out_index || n == 0) {
+        return -1;
+    }
+    
+    *out_index = _find_first(data, n, _reduce(data, n, 1));
+    return 0;
+}
+
+static void _prefix_sum(const int *in, int64_t *out, size_t n, int inclusive) {
+    size_t i = 0;
+    int64_t running = 0;
+    
+#if defined(__SSE2__)
+    // In-register scan of each int64 pair, then add the running carry
+    __m128i carry = _mm_setzero_si128();
+    for (; i + 4 <= n; i += 4) {
+        __m128i lo, hi;
+        _widen_epi32(_mm_loadu_si128((const __m128i*)(in + i)), &lo, &hi);
+        
+        __m128i scan_lo = _mm_add_epi64(lo, _mm_slli_si128(lo, 8));
+        __m128i scan_hi = _mm_add_epi64(hi, _mm_slli_si128(hi, 8));
+        
+        scan_lo = _mm_add_epi64(scan_lo, carry);
+        carry = _mm_unpackhi_epi64(scan_lo, scan_lo);
+        scan_hi = _mm_add_epi64(scan_hi, carry);
+        carry = _mm_unpackhi_epi64(scan_hi, scan_hi);
+        
+        if (!inclusive) {
+            scan_lo = _mm_sub_epi64(scan_lo, lo);
+            scan_hi = _mm_sub_epi64(scan_hi, hi);
+        }
+        _mm_storeu_si128((__m128i*)(out + i), scan_lo);
+        _mm_storeu_si128((__m128i*)(out + i + 2), scan_hi);
+    }
+    if (i > 0) {
+        int64_t lanes[2];
+        _mm_storeu_si128((__m128i*)lanes, carry);
+        running = lanes[0];
+    }
+#endif
+    
+    for (; i < n; i++) {
+        if (inclusive) {
+            running += in[i];
+            out[i] = running;
+        } else {
+            out[i] = running;
+            running += in[i];
+        }
+    }
+}
+
+int scan_prefix_sum_inclusive(const int *in, int64_t *out, size_t n) {
+    if (!in || !out) {
+        return -1;
+    }
+    
+    _prefix_sum(in, out, n, 1);
+    return 0;
+}
+
+int scan_prefix_sum_exclusive(const int *in, int64_t *out, size_t n) {
+    if (!in || !out) {
+        return -1;
+    }
+    
+    _prefix_sum(in, out, n, 0);
+    return 0;
+}
+
+static size_t _bin_of(int value, int min_value) {
+    return (size_t)((int64_t)value - (int64_t)min_value);
+}
+
+static size_t _histogram_direct(const int *data, size_t n, int min_value,
+                                size_t num_bins, uint64_t *bins) {
+    size_t outside = 0;
+    for (size_t i = 0; i < n; i++) {
+        size_t bin = _bin_of(data[i], min_value);
+        if (bin < num_bins) {
+            bins[bin]++;
+        } else {
+            outside++;
+        }
+    }
+    return outside;
+}
+
+size_t scan_histogram(const int *data, size_t n, int min_value,
+                      size_t num_bins, uint64_t *bins) {
+    if (!data || !bins || num_bins == 0) {
+        return 0;
+    }
+    
+    if (num_bins > SUB_HISTOGRAM_MAX_BINS || n < SUB_HISTOGRAMS * num_bins) {
+        return _histogram_direct(data, n, min_value, num_bins, bins);
+    }
+    
+    uint64_t *sub = calloc(SUB_HISTOGRAMS * num_bins, sizeof(uint64_t));
+    if (!sub) {
+        return _histogram_direct(data, n, min_value, num_bins, bins);
+    }
+    
+    // Consecutive elements hit different copies, so a run of equal values
+    // no longer serializes on one counter's load-increment-store chain
+    size_t outside = 0;
+    size_t i = 0;
+    for (; i + SUB_HISTOGRAMS <= n; i += SUB_HISTOGRAMS) {
+        for (size_t lane = 0; lane < SUB_HISTOGRAMS; lane++) {
+            size_t bin = _bin_of(data[i + lane], min_value);
+            if (bin < num_bins) {
+                sub[lane * num_bins + bin]++;
+            } else {
+                outside++;
+            }
+        }
+    }
+    outside += _histogram_direct(data + i, n - i, min_value, num_bins, bins);
+    
+    for (size_t b = 0; b < num_bins; b++) {
+        uint64_t total = 0;
+        for (size_t lane = 0; lane < SUB_HISTOGRAMS; lane++) {
+            total += sub[lane * num_bins + b];
+        }
+        bins[b] += total;
+    }
+    
+    free(sub);
+    return outside;
+}
@@ -0,0 +1,212 @@
+#include "../include/seg_stack.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+
+#define DEFAULT_CHUNK_SIZE 1024
+
+typedef struct Chunk {
+    struct Chunk *below; // Next chunk towards the bottom of the stack
+    int data[];
+} Chunk;
+
+struct SegStack {
+    Chunk *top;         // Chunk holding the top element (never NULL)
+    Chunk *spare;       // Cached empty chunk, or NULL
+    size_t top_count;   // Elements used in the top chunk
+    size_t size;
+    size_t chunk_size;
+    size_t chunk_count;
+};
+
+static Chunk* _chunk_alloc(size_t chunk_size) {
+    return malloc(sizeof(Chunk) + chunk_size * sizeof(int));
+}
+
+SegStack* seg_stack_create(void) {
+    return seg_stack_create_with_chunk_size(DEFAULT_CHUNK_SIZE);
+}
+
+SegStack* seg_stack_create_with_chunk_size(size_t chunk_size) {
+    if (chunk_size == 0) {
+        chunk_size = DEFAULT_CHUNK_SIZE;
+    }
+    
+    if (chunk_size > (SIZE_MAX - sizeof(Chunk)) / sizeof(int)) {
+        return NULL;
+    }
+    
+    SegStack *stack = malloc(sizeof(SegStack));
+    if (!stack) {
+        return NULL;
+    }
+    
+    stack->top = _chunk_alloc(chunk_size);
+    if (!stack->top) {
+        free(stack);
+        return NULL;
+    }
+    
+    stack->top->below = NULL;
+    stack->spare = NULL;
+    stack->top_count = 0;
+    stack->size = 0;
+    stack->chunk_size = chunk_size;
+    stack->chunk_count = 1;
+    
+    return stack;
+}
+
+void seg_stack_destroy(SegStack *stack) {
+    if (!stack) {
+        return;
+    }
+    
+    Chunk *chunk = stack->top;
+    while (chunk) {
+        Chunk *below = chunk->below;
+        free(chunk);
+        chunk = below;
+    }
+    
+    free(stack->spare);
+    free(stack);
+}
+
+int seg_stack_push(SegStack *stack, int value) {
+    if (!stack) {
+        return -1;
+    }
+    
+    if (stack->top_count == stack->chunk_size) {
+        Chunk *chunk = stack->spare;
+        if (chunk) {
+            stack->spare = NULL;
+        } else {
+            chunk = _chunk_alloc(stack->chunk_size);
+            if (!chunk) {
+                return -1;
+            }
+            stack->chunk_count++;
+        }
+        
+        chunk->below = stack->top;
+        stack->top = chunk;
+        stack->top_count = 0;
+    }
+    
+    stack->top->data[stack->top_count++] = value;
+    stack->size++;
+    
+    return 0;
+}
+
+int seg_stack_pop(SegStack *stack, int *out_value) {
+    if (!stack || !out_value || stack->size == 0) {
+        return -1;
+    }
+    
+    *out_value = stack->top->data[--stack->top_count];
+    stack->size--;
+    
+    // Step down to the full chunk below; the emptied one becomes the spare
+    if (stack->top_count == 0 && stack->top->below) {
+        Chunk *empty = stack->top;
+        stack->top = empty->below;
+        stack->top_count = stack->chunk_size;
+        
+        if (stack->spare) {
+            free(stack->spare);
+            stack->chunk_count--;
+        }
+        stack->spare = empty;
+    }
+    
+    return 0;
+}
+
+int seg_stack_peek(const SegStack *stack, int *out_value) {
+    if (!stack || !out_value || stack->size == 0) {
+        return -1;
+    }
+    
+    *out_value = stack->top->data[stack->top_count - 1];
+    return 0;
+}
+
+size_t seg_stack_size(const SegStack *stack) {
+    if (!stack) {
+        return 0;
+    }
+    
+    return stack->size;
+}
+
+size_t seg_stack_chunk_size(const SegStack *stack) {
+    if (!stack) {
+        return 0;
+    }
+    
+    return stack->chunk_size;
+}
+
+size_t seg_stack_chunk_count(const SegStack *stack) {
+    if (!stack) {
+        return 0;
+    }
+    
+    return stack->chunk_count;
+}
+
+int seg_stack_is_empty(const SegStack *stack) {
+    if (!stack) {
+        return 1;
+    }
+    
+    return stack->size == 0;
+}
+
+void seg_stack_clear(SegStack *stack) {
+    if (!stack) {
+        return;
+    }
+    
+    // Keep the bottom chunk; recycle the first freed one as the spare
+    while (stack->top->below) {
+        Chunk *chunk = stack->top;
+        stack->top = chunk->below;
+        if (!stack->spare) {
+            stack->spare = chunk;
+        } else {
+            free(chunk);
+            stack->chunk_count--;
+        }
+    }
+    
+    stack->top_count = 0;
+    stack->size = 0;
+}
+
+void seg_stack_print(const SegStack *stack) {
+    if (!stack) {
+        printf("NULL\n");
+        return;
+    }
+    
+    printf("[");
+    size_t printed = 0;
+    const Chunk *chunk = stack->top;
+    size_t count = stack->top_count;
+    while (chunk) {
+        for (size_t i = count; i > 0; i--) {
+            printf("%d", chunk->data[i - 1]);
+            if (++printed < stack->size) {
+                printf(", ");
+            }
+        }
+        chunk = chunk->below;
+        count = stack->chunk_size;
+    }
+    printf("] (size: %zu, chunks: %zu, top first)\n",
+           stack->size, stack->chunk_count);
+}
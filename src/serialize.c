@@ -0,0 +1,203 @@
+#define _POSIX_C_SOURCE 200809L
+#include "../include/serialize.h"
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+
+#define SWAP_CHUNK 4096
+
+_Static_assert(sizeof(SerialHeader) == SERIAL_HEADER_SIZE,
+               "serial header must stay 64 bytes");
+
+static int _host_is_big_endian(void) {
+    const uint16_t probe = 1;
+    return *(const unsigned char*)&probe == 0;
+}
+
+static void _swap_bytes(void *data, size_t elem_size, size_t count) {
+    unsigned char *bytes = data;
+    for (size_t i = 0; i < count; i++) {
+        unsigned char *e = bytes + i * elem_size;
+        for (size_t lo = 0, hi = elem_size - 1; lo < hi; lo++, hi--) {
+            unsigned char tmp = e[lo];
+            e[lo] = e[hi];
+            e[hi] = tmp;
+        }
+    }
+}
+
+static void _header_to_le(SerialHeader *h) {
+    if (!_host_is_big_endian()) {
+        return;
+    }
+    
+    _swap_bytes(&h->version, sizeof(h->version), 1);
+    _swap_bytes(&h->kind, sizeof(h->kind), 1);
+    _swap_bytes(&h->elem_size, sizeof(h->elem_size), 1);
+    _swap_bytes(&h->flags, sizeof(h->flags), 1);
+    _swap_bytes(&h->count, sizeof(h->count), 1);
+    _swap_bytes(&h->dim, sizeof(h->dim), 1);
+    _swap_bytes(&h->capacity, sizeof(h->capacity), 1);
+}
+
+static int _write_all(int fd, const void *buf, size_t len) {
+    const unsigned char *p = buf;
+    while (len > 0) {
+        ssize_t n = write(fd, p, len);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+        p += n;
+        len -= (size_t)n;
+    }
+    return 0;
+}
+
+static int _read_all(int fd, void *buf, size_t len) {
+    unsigned char *p = buf;
+    while (len > 0) {
+        ssize_t n = read(fd, p, len);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+        if (n == 0) {
+            return -1;
+        }
+        p += n;
+        len -= (size_t)n;
+    }
+    return 0;
+}
+
+void serial_header_init(SerialHeader *header, SerialKind kind,
+                        size_t elem_size, size_t count) {
+    if (!header) {
+        return;
+    }
+    
+    memset(header, 0, sizeof(SerialHeader));
+    memcpy(header->magic, SERIAL_MAGIC, 4);
+    header->version = SERIAL_VERSION;
+    header->kind = (uint16_t)kind;
+    header->elem_size = (uint32_t)elem_size;
+    header->count = count;
+    header->capacity = count;
+}
+
+int serial_header_check(const SerialHeader *header, SerialKind kind,
+                        size_t elem_size) {
+    if (!header || memcmp(header->magic, SERIAL_MAGIC, 4) != 0) {
+        return -1;
+    }
+    
+    if (header->version != SERIAL_VERSION || header->kind != (uint16_t)kind ||
+        header->elem_size != elem_size || header->count > header->capacity) {
+        return -1;
+    }
+    
+    if (header->count > SIZE_MAX / elem_size) {
+        return -1;
+    }
+    
+    return 0;
+}
+
+int serial_write(int fd, const SerialHeader *header, const void *payload) {
+    if (fd < 0 || !header || (header->count > 0 && !payload)) {
+        return -1;
+    }
+    
+    SerialHeader disk = *header;
+    _header_to_le(&disk);
+    if (_write_all(fd, &disk, sizeof(disk)) != 0) {
+        return -1;
+    }
+    
+    size_t elem_size = header->elem_size;
+    size_t count = (size_t)header->count;
+    
+    if (!_host_is_big_endian() || elem_size == 1) {
+        return _write_all(fd, payload, elem_size * count);
+    }
+    
+    // Big-endian hosts swap through a bounce buffer (payload is const)
+    unsigned char chunk[SWAP_CHUNK];
+    size_t per_chunk = SWAP_CHUNK / elem_size;
+    const unsigned char *src = payload;
+    while (count > 0) {
+        size_t n = count < per_chunk ? count : per_chunk;
+        memcpy(chunk, src, n * elem_size);
+        _swap_bytes(chunk, elem_size, n);
+        if (_write_all(fd, chunk, n * elem_size) != 0) {
+            return -1;
+        }
+        src += n * elem_size;
+        count -= n;
+    }
+    
+    return 0;
+}
+
+int serial_read_header(int fd, SerialHeader *header, SerialKind kind,
+                       size_t elem_size) {
+    if (fd < 0 || !header) {
+        return -1;
+    }
+    
+    if (_read_all(fd, header, sizeof(SerialHeader)) != 0) {
+        return -1;
+    }
+    
+    _header_to_le(header);
+    return serial_header_check(header, kind, elem_size);
+}
+
+int serial_read_payload(int fd, void *dst, size_t elem_size, size_t count) {
+    if (fd < 0 || (count > 0 && !dst)) {
+        return -1;
+    }
+    
+    if (_read_all(fd, dst, elem_size * count) != 0) {
+        return -1;
+    }
+    
+    if (_host_is_big_endian() && elem_size > 1) {
+        _swap_bytes(dst, elem_size, count);
+    }
+    
+    return 0;
+}
+
+void* serial_view(void *buf, size_t len, SerialHeader *out_header,
+                  SerialKind kind, size_t elem_size) {
+    if (!buf || len < SERIAL_HEADER_SIZE || _host_is_big_endian()) {
+        return NULL;
+    }
+    
+    SerialHeader header;
+    memcpy(&header, buf, sizeof(header));
+    if (serial_header_check(&header, kind, elem_size) != 0) {
+        return NULL;
+    }
+    
+    if (header.count > (len - SERIAL_HEADER_SIZE) / elem_size) {
+        return NULL;
+    }
+    
+    unsigned char *payload = (unsigned char*)buf + SERIAL_HEADER_SIZE;
+    if ((uintptr_t)payload % elem_size != 0) {
+        return NULL;
+    }
+    
+    if (out_header) {
+        *out_header = header;
+    }
+    
+    return payload;
+}
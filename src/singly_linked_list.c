@@ -1,21 +1,52 @@
 #include "../include/singly_linked_list.h"
 #include <stdlib.h>
 #include <stdio.h>
+#include <stdint.h>
+
+#define SORT_BINS 64
 
 typedef struct Node {
     int data;
     struct Node *next;
 } Node;
 
+// Nodes for slist_from_array, allocated in one block
+typedef struct NodeSlab {
+    struct NodeSlab *next;
+    size_t count;
+    Node nodes[];
+} NodeSlab;
+
 struct SinglyLinkedList {
     Node *head;
+    Node *tail;
     size_t size;
+    Node *finger;        // Last node reached by index (NULL = unknown)
+    size_t finger_index;
+    NodeSlab *slabs;
+    Node *spare;         // Released slab nodes, reused before malloc
 };
 
-static Node* _node_create(int value) {
-    Node *node = malloc(sizeof(Node));
-    if (!node) {
-        return NULL;
+static int _in_slab(const SinglyLinkedList *list, const Node *node) {
+    uintptr_t addr = (uintptr_t)node;
+    for (const NodeSlab *slab = list->slabs; slab; slab = slab->next) {
+        if (addr >= (uintptr_t)slab->nodes &&
+            addr < (uintptr_t)(slab->nodes + slab->count)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static Node* _node_create(SinglyLinkedList *list, int value) {
+    Node *node = list->spare;
+    if (node) {
+        list->spare = node->next;
+    } else {
+        node = malloc(sizeof(Node));
+        if (!node) {
+            return NULL;
+        }
     }
     
     node->data = value;
@@ -24,6 +55,38 @@ static Node* _node_create(int value) {
     return node;
 }
 
+// Slab nodes cannot be freed one by one; they go back to the spare list
+static void _node_free(SinglyLinkedList *list, Node *node) {
+    if (list->slabs && _in_slab(list, node)) {
+        node->next = list->spare;
+        list->spare = node;
+    } else {
+        free(node);
+    }
+}
+
+// Walks to index, starting from the finger when it is not past index
+static Node* _locate(const SinglyLinkedList *list, size_t index) {
+    // The finger is a cache, so lookups through a const list may move it.
+    // Lists only come from the heap (never defined const), so the write is
+    // well defined; the header warns that it makes get unsafe to share.
+    SinglyLinkedList *self = (SinglyLinkedList*)list;
+    
+    Node *current = list->head;
+    size_t i = 0;
+    if (list->finger && list->finger_index <= index) {
+        current = list->finger;
+        i = list->finger_index;
+    }
+    for (; i < index; i++) {
+        current = current->next;
+    }
+    
+    self->finger = current;
+    self->finger_index = index;
+    return current;
+}
+
 SinglyLinkedList* slist_create(void) {
     struct SinglyLinkedList *list = malloc(sizeof(struct SinglyLinkedList));
     if (!list) {
@@ -31,7 +94,12 @@ SinglyLinkedList* slist_create(void) {
     }
     
     list->head = NULL;
+    list->tail = NULL;
     list->size = 0;
+    list->finger = NULL;
+    list->finger_index = 0;
+    list->slabs = NULL;
+    list->spare = NULL;
     
     return list;
 }
@@ -41,11 +109,13 @@ void slist_destroy(SinglyLinkedList *list) {
         return;
     }
     
-    Node *current = list->head;
-    while (current) {
-        Node *next = current->next;
-        free(current);
-        current = next;
+    slist_clear(list);
+    
+    NodeSlab *slab = list->slabs;
+    while (slab) {
+        NodeSlab *next = slab->next;
+        free(slab);
+        slab = next;
     }
     
     free(list);
@@ -56,14 +126,20 @@ int slist_push_front(SinglyLinkedList *list, int value) {
         return -1;
     }
     
-    Node *node = _node_create(value);
+    Node *node = _node_create(list, value);
     if (!node) {
         return -1;
     }
     
     node->next = list->head;
     list->head = node;
+    if (!list->tail) {
+        list->tail = node;
+    }
     list->size++;
+    if (list->finger) {
+        list->finger_index++;
+    }
     
     return 0;
 }
@@ -73,20 +149,17 @@ int slist_push_back(SinglyLinkedList *list, int value) {
         return -1;
     }
     
-    Node *node = _node_create(value);
+    Node *node = _node_create(list, value);
     if (!node) {
         return -1;
     }
     
-    if (!list->head) {
+    if (!list->tail) {
         list->head = node;
     } else {
-        Node *current = list->head;
-        while (current->next) {
-            current = current->next;
-        }
-        current->next = node;
+        list->tail->next = node;
     }
+    list->tail = node;
     
     list->size++;
     return 0;
@@ -101,7 +174,15 @@ int slist_pop_front(SinglyLinkedList *list, int *out_value) {
     *out_value = old_head->data;
     
     list->head = old_head->next;
-    free(old_head);
+    if (!list->head) {
+        list->tail = NULL;
+    }
+    if (list->finger == old_head) {
+        list->finger = NULL;
+    } else if (list->finger) {
+        list->finger_index--;
+    }
+    _node_free(list, old_head);
     list->size--;
     
     return 0;
@@ -113,21 +194,17 @@ int slist_pop_back(SinglyLinkedList *list, int *out_value) {
     }
     
     if (!list->head->next) {
-        *out_value = list->head->data;
-        free(list->head);
-        list->head = NULL;
-        list->size--;
-        return 0;
+        return slist_pop_front(list, out_value);
     }
     
-    Node *current = list->head;
-    while (current->next->next) {
-        current = current->next;
-    }
+    // Still a walk to the predecessor (no prev links), but it starts
+    // from the finger when one is already close
+    Node *current = _locate(list, list->size - 2);
     
-    *out_value = current->next->data;
-    free(current->next);
+    *out_value = list->tail->data;
+    _node_free(list, list->tail);
     current->next = NULL;
+    list->tail = current;
     list->size--;
     
     return 0;
@@ -138,18 +215,18 @@ int slist_insert_after(SinglyLinkedList *list, size_t index, int value) {
         return -1;
     }
     
-    Node *current = list->head;
-    for (size_t i = 0; i < index; i++) {
-        current = current->next;
-    }
+    Node *current = _locate(list, index);
     
-    Node *node = _node_create(value);
+    Node *node = _node_create(list, value);
     if (!node) {
         return -1;
     }
     
     node->next = current->next;
     current->next = node;
+    if (current == list->tail) {
+        list->tail = node;
+    }
     list->size++;
     
     return 0;
@@ -164,10 +241,8 @@ int slist_remove_at(SinglyLinkedList *list, size_t index, int *out_value) {
         return slist_pop_front(list, out_value);
     }
     
-    Node *current = list->head;
-    for (size_t i = 0; i < index - 1; i++) {
-        current = current->next;
-    }
+    // Finger lands on the predecessor, which stays valid
+    Node *current = _locate(list, index - 1);
     
     Node *to_remove = current->next;
     if (out_value) {
@@ -175,7 +250,10 @@ int slist_remove_at(SinglyLinkedList *list, size_t index, int *out_value) {
     }
     
     current->next = to_remove->next;
-    free(to_remove);
+    if (to_remove == list->tail) {
+        list->tail = current;
+    }
+    _node_free(list, to_remove);
     list->size--;
     
     return 0;
@@ -186,12 +264,7 @@ int slist_get(const SinglyLinkedList *list, size_t index, int *out_value) {
         return -1;
     }
     
-    Node *current = list->head;
-    for (size_t i = 0; i < index; i++) {
-        current = current->next;
-    }
-    
-    *out_value = current->data;
+    *out_value = _locate(list, index)->data;
     return 0;
 }
 
@@ -200,12 +273,7 @@ int slist_set(SinglyLinkedList *list, size_t index, int value) {
         return -1;
     }
     
-    Node *current = list->head;
-    for (size_t i = 0; i < index; i++) {
-        current = current->next;
-    }
-    
-    current->data = value;
+    _locate(list, index)->data = value;
     return 0;
 }
 
@@ -252,12 +320,14 @@ void slist_clear(SinglyLinkedList *list) {
     Node *current = list->head;
     while (current) {
         Node *next = current->next;
-        free(current);
+        _node_free(list, current);
         current = next;
     }
     
     list->head = NULL;
+    list->tail = NULL;
     list->size = 0;
+    list->finger = NULL;
 }
 
 void slist_reverse(SinglyLinkedList *list) {
@@ -276,7 +346,125 @@ void slist_reverse(SinglyLinkedList *list) {
         current = next;
     }
     
+    list->tail = list->head;
     list->head = prev;
+    list->finger = NULL;
+}
+
+SinglyLinkedList* slist_from_array(const int *values, size_t count) {
+    if (!values && count > 0) {
+        return NULL;
+    }
+    
+    SinglyLinkedList *list = slist_create();
+    if (!list || count == 0) {
+        return list;
+    }
+    
+    if (count > (SIZE_MAX - sizeof(NodeSlab)) / sizeof(Node)) {
+        free(list);
+        return NULL;
+    }
+    
+    NodeSlab *slab = malloc(sizeof(NodeSlab) + count * sizeof(Node));
+    if (!slab) {
+        free(list);
+        return NULL;
+    }
+    
+    slab->next = NULL;
+    slab->count = count;
+    for (size_t i = 0; i < count; i++) {
+        slab->nodes[i].data = values[i];
+        slab->nodes[i].next = i + 1 < count ? &slab->nodes[i + 1] : NULL;
+    }
+    
+    list->slabs = slab;
+    list->head = &slab->nodes[0];
+    list->tail = &slab->nodes[count - 1];
+    list->size = count;
+    
+    return list;
+}
+
+int slist_to_array(const SinglyLinkedList *list, int *out) {
+    if (!list || (!out && list->size > 0)) {
+        return -1;
+    }
+    
+    size_t i = 0;
+    for (const Node *current = list->head; current; current = current->next) {
+        out[i++] = current->data;
+    }
+    
+    return 0;
+}
+
+// Merges two sorted next-chains; taking from a on ties keeps it stable
+static Node* _merge(Node *a, Node *b) {
+    Node head;
+    Node *tail = &head;
+    while (a && b) {
+        if (b->data < a->data) {
+            tail->next = b;
+            b = b->next;
+        } else {
+            tail->next = a;
+            a = a->next;
+        }
+        tail = tail->next;
+    }
+    tail->next = a ? a : b;
+    return head.next;
+}
+
+// Bottom-up merge sort with a binary counter of runs: bins[i] holds a
+// sorted run of 2^i nodes, so merges happen while the nodes are still
+// cache-hot instead of in log n full passes. Extra space is the fixed
+// array of bins (64 covers any size_t length).
+static Node* _merge_sort(Node *head) {
+    Node *bins[SORT_BINS] = {NULL};
+    size_t used = 0;
+    
+    while (head) {
+        Node *carry = head;
+        head = head->next;
+        carry->next = NULL;
+        
+        size_t i = 0;
+        for (; i < used && bins[i]; i++) {
+            carry = _merge(bins[i], carry);
+            bins[i] = NULL;
+        }
+        if (i == used && used < SORT_BINS) {
+            used++;
+        }
+        bins[i] = carry;
+    }
+    
+    // Older (earlier) runs live in higher bins, so they go first
+    Node *result = NULL;
+    for (size_t i = 0; i < used; i++) {
+        if (bins[i]) {
+            result = result ? _merge(bins[i], result) : bins[i];
+        }
+    }
+    return result;
+}
+
+void slist_sort(SinglyLinkedList *list) {
+    if (!list || !list->head) {
+        return;
+    }
+    
+    list->head = _merge_sort(list->head);
+    
+    Node *tail = list->head;
+    while (tail->next) {
+        tail = tail->next;
+    }
+    list->tail = tail;
+    list->finger = NULL;
 }
 
 void slist_print(const SinglyLinkedList *list) {
@@ -296,3 +484,29 @@ void slist_print(const SinglyLinkedList *list) {
     }
     printf("] (size: %zu)\n", list->size);
 }
+
+static size_t _slist_iter_step(ContainerIter *it, const int **span) {
+    const Node *node = it->cursor;
+    if (!node) {
+        return 0;
+    }
+    
+    *span = &node->data;
+    it->cursor = node->next;
+    it->index++;
+    
+    return 1;
+}
+
+int slist_iter_init(const SinglyLinkedList *list, ContainerIter *it) {
+    if (!list || !it) {
+        return -1;
+    }
+    
+    it->step = _slist_iter_step;
+    it->source = list;
+    it->cursor = list->head;
+    it->index = 0;
+    
+    return 0;
+}
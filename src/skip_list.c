@@ -0,0 +1,371 @@
+#include "../include/skip_list.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+
+#define MAX_LEVEL 32
+#define SLAB_NODES 64
+#define DEFAULT_SEED 0x9e3779b97f4a7c15ULL
+
+typedef struct SkipNode {
+    int key;   // First field: the container iterator yields &key
+    int value;
+    int level;
+    struct SkipNode *forward[];
+} SkipNode;
+
+typedef struct Slab {
+    struct Slab *next;
+} Slab;
+
+struct SkipList {
+    SkipNode *head;                  // Sentinel with MAX_LEVEL links
+    int level;                       // Highest level in use
+    size_t size;
+    uint64_t rng;
+    SkipNode *free_nodes[MAX_LEVEL]; // Pool per tower height (index = level - 1)
+    Slab *slabs;
+};
+
+static size_t _node_bytes(int level) {
+    return sizeof(SkipNode) + (size_t)level * sizeof(SkipNode*);
+}
+
+// xorshift64*: cheap, and plenty for tower heights
+static uint64_t _next_random(SkipList *list) {
+    uint64_t x = list->rng;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    list->rng = x;
+    return x * 0x2545f4914f6cdd1dULL;
+}
+
+// Geometric with p = 1/4: two random bits per extra level
+static int _random_level(SkipList *list) {
+    uint64_t bits = _next_random(list);
+    int level = 1;
+    while (level < MAX_LEVEL && (bits & 3) == 0) {
+        level++;
+        bits >>= 2;
+    }
+    return level;
+}
+
+static int _refill_pool(SkipList *list, int level) {
+    size_t node_bytes = _node_bytes(level);
+    // Round up so every node in the slab stays pointer-aligned
+    node_bytes = (node_bytes + sizeof(void*) - 1) / sizeof(void*) * sizeof(void*);
+    
+    size_t header = (sizeof(Slab) + sizeof(void*) - 1) / sizeof(void*) * sizeof(void*);
+    unsigned char *block = malloc(header + SLAB_NODES * node_bytes);
+    if (!block) {
+        return -1;
+    }
+    
+    Slab *slab = (Slab*)block;
+    slab->next = list->slabs;
+    list->slabs = slab;
+    
+    for (size_t i = 0; i < SLAB_NODES; i++) {
+        SkipNode *node = (SkipNode*)(block + header + i * node_bytes);
+        node->level = level;
+        node->forward[0] = list->free_nodes[level - 1];
+        list->free_nodes[level - 1] = node;
+    }
+    
+    return 0;
+}
+
+static SkipNode* _node_alloc(SkipList *list, int level) {
+    if (!list->free_nodes[level - 1] && _refill_pool(list, level) != 0) {
+        return NULL;
+    }
+    
+    SkipNode *node = list->free_nodes[level - 1];
+    list->free_nodes[level - 1] = node->forward[0];
+    return node;
+}
+
+static void _node_release(SkipList *list, SkipNode *node) {
+    node->forward[0] = list->free_nodes[node->level - 1];
+    list->free_nodes[node->level - 1] = node;
+}
+
+// Fills update[i] with the last node at level i whose key is < key
+static SkipNode* _find_predecessors(const SkipList *list, int key,
+                                    SkipNode **update) {
+    SkipNode *node = list->head;
+    for (int i = list->level - 1; i >= 0; i--) {
+        while (node->forward[i] && node->forward[i]->key < key) {
+            node = node->forward[i];
+        }
+        if (update) {
+            update[i] = node;
+        }
+    }
+    return node->forward[0];
+}
+
+SkipList* skiplist_create(void) {
+    return skiplist_create_seeded(DEFAULT_SEED);
+}
+
+SkipList* skiplist_create_seeded(unsigned long seed) {
+    SkipList *list = malloc(sizeof(SkipList));
+    if (!list) {
+        return NULL;
+    }
+    
+    list->head = malloc(_node_bytes(MAX_LEVEL));
+    if (!list->head) {
+        free(list);
+        return NULL;
+    }
+    
+    list->head->level = MAX_LEVEL;
+    for (int i = 0; i < MAX_LEVEL; i++) {
+        list->head->forward[i] = NULL;
+        list->free_nodes[i] = NULL;
+    }
+    
+    list->level = 1;
+    list->size = 0;
+    list->rng = seed ? (uint64_t)seed : DEFAULT_SEED;
+    list->slabs = NULL;
+    
+    return list;
+}
+
+void skiplist_destroy(SkipList *list) {
+    if (!list) {
+        return;
+    }
+    
+    Slab *slab = list->slabs;
+    while (slab) {
+        Slab *next = slab->next;
+        free(slab);
+        slab = next;
+    }
+    
+    free(list->head);
+    free(list);
+}
+
+int skiplist_insert(SkipList *list, int key, int value) {
+    if (!list) {
+        return -1;
+    }
+    
+    SkipNode *update[MAX_LEVEL];
+    SkipNode *found = _find_predecessors(list, key, update);
+    if (found && found->key == key) {
+        found->value = value;
+        return 0;
+    }
+    
+    int level = _random_level(list);
+    SkipNode *node = _node_alloc(list, level);
+    if (!node) {
+        return -1;
+    }
+    
+    for (int i = list->level; i < level; i++) {
+        update[i] = list->head;
+    }
+    if (level > list->level) {
+        list->level = level;
+    }
+    
+    node->key = key;
+    node->value = value;
+    for (int i = 0; i < level; i++) {
+        node->forward[i] = update[i]->forward[i];
+        update[i]->forward[i] = node;
+    }
+    
+    list->size++;
+    return 0;
+}
+
+int skiplist_find(const SkipList *list, int key, int *out_value) {
+    if (!list) {
+        return -1;
+    }
+    
+    const SkipNode *node = _find_predecessors(list, key, NULL);
+    if (!node || node->key != key) {
+        return -1;
+    }
+    
+    if (out_value) {
+        *out_value = node->value;
+    }
+    return 0;
+}
+
+int skiplist_contains(const SkipList *list, int key) {
+    return skiplist_find(list, key, NULL) == 0;
+}
+
+int skiplist_erase(SkipList *list, int key, int *out_value) {
+    if (!list) {
+        return -1;
+    }
+    
+    SkipNode *update[MAX_LEVEL];
+    SkipNode *node = _find_predecessors(list, key, update);
+    if (!node || node->key != key) {
+        return -1;
+    }
+    
+    for (int i = 0; i < node->level; i++) {
+        update[i]->forward[i] = node->forward[i];
+    }
+    while (list->level > 1 && !list->head->forward[list->level - 1]) {
+        list->level--;
+    }
+    
+    if (out_value) {
+        *out_value = node->value;
+    }
+    
+    _node_release(list, node);
+    list->size--;
+    return 0;
+}
+
+int skiplist_min(const SkipList *list, int *out_key, int *out_value) {
+    if (!list || !out_key || list->size == 0) {
+        return -1;
+    }
+    
+    const SkipNode *node = list->head->forward[0];
+    *out_key = node->key;
+    if (out_value) {
+        *out_value = node->value;
+    }
+    return 0;
+}
+
+int skiplist_max(const SkipList *list, int *out_key, int *out_value) {
+    if (!list || !out_key || list->size == 0) {
+        return -1;
+    }
+    
+    // Descend as far right as possible on every level
+    const SkipNode *node = list->head;
+    for (int i = list->level - 1; i >= 0; i--) {
+        while (node->forward[i]) {
+            node = node->forward[i];
+        }
+    }
+    
+    *out_key = node->key;
+    if (out_value) {
+        *out_value = node->value;
+    }
+    return 0;
+}
+
+size_t skiplist_size(const SkipList *list) {
+    if (!list) {
+        return 0;
+    }
+    
+    return list->size;
+}
+
+int skiplist_is_empty(const SkipList *list) {
+    if (!list) {
+        return 1;
+    }
+    
+    return list->size == 0;
+}
+
+void skiplist_clear(SkipList *list) {
+    if (!list) {
+        return;
+    }
+    
+    SkipNode *node = list->head->forward[0];
+    while (node) {
+        SkipNode *next = node->forward[0];
+        _node_release(list, node);
+        node = next;
+    }
+    
+    for (int i = 0; i < MAX_LEVEL; i++) {
+        list->head->forward[i] = NULL;
+    }
+    list->level = 1;
+    list->size = 0;
+}
+
+int skiplist_range_init(const SkipList *list, int lo, int hi, SkipListRange *range) {
+    if (!list || !range) {
+        return -1;
+    }
+    
+    range->node = lo <= hi ? _find_predecessors(list, lo, NULL) : NULL;
+    range->hi = hi;
+    return 0;
+}
+
+int skiplist_range_next(SkipListRange *range, int *out_key, int *out_value) {
+    if (!range || !out_key || !range->node || range->node->key > range->hi) {
+        return -1;
+    }
+    
+    *out_key = range->node->key;
+    if (out_value) {
+        *out_value = range->node->value;
+    }
+    range->node = range->node->forward[0];
+    return 0;
+}
+
+static size_t _skiplist_iter_step(ContainerIter *it, const int **span) {
+    const SkipNode *node = it->cursor;
+    if (!node) {
+        return 0;
+    }
+    
+    *span = &node->key;
+    it->cursor = node->forward[0];
+    it->index++;
+    
+    return 1;
+}
+
+int skiplist_iter_init(const SkipList *list, ContainerIter *it) {
+    if (!list || !it) {
+        return -1;
+    }
+    
+    it->step = _skiplist_iter_step;
+    it->source = list;
+    it->cursor = list->head->forward[0];
+    it->index = 0;
+    
+    return 0;
+}
+
+void skiplist_print(const SkipList *list) {
+    if (!list) {
+        printf("NULL\n");
+        return;
+    }
+    
+    printf("{");
+    for (const SkipNode *node = list->head->forward[0]; node;
+         node = node->forward[0]) {
+        printf("%d: %d", node->key, node->value);
+        if (node->forward[0]) {
+            printf(", ");
+        }
+    }
+    printf("} (size: %zu, levels: %d)\n", list->size, list->level);
+}
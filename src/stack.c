@@ -1,23 +1,40 @@
 #include "../include/stack.h"
+#include "../include/growth.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <stdint.h>
 
 #define DEFAULT_CAPACITY 16
-#define GROWTH_FACTOR 2
 
 struct Stack {
     int *data;
     size_t size;
     size_t capacity;
+    GrowthPolicy growth;
+    GrowthStorage storage;
+    int in_place;        // Struct lives in caller storage (stack_init)
+    int inline_data[STACK_INLINE_CAPACITY];
 };
 
+_Static_assert(sizeof(struct Stack) <= sizeof(StackStorage),
+               "StackStorage too small for struct Stack");
+
 static int _stack_resize(struct Stack *stack, size_t new_capacity) {
     if (!stack || new_capacity < stack->size) {
         return -1;
     }
     
-    int *new_data = realloc(stack->data, new_capacity * sizeof(int));
+    // Growing within the embedded buffer only changes the bookkeeping
+    if (stack->storage == GROWTH_STORAGE_INLINE &&
+        new_capacity <= STACK_INLINE_CAPACITY) {
+        stack->capacity = new_capacity;
+        return 0;
+    }
+    
+    int *new_data = growth_realloc(stack->data, sizeof(int), stack->capacity,
+                                   &new_capacity, &stack->storage,
+                                   &stack->growth);
     if (!new_data) {
         return -1;
     }
@@ -31,24 +48,54 @@ Stack* stack_create(void) {
     return stack_create_with_capacity(DEFAULT_CAPACITY);
 }
 
-Stack* stack_create_with_capacity(size_t capacity) {
+static int _stack_setup(struct Stack *stack, size_t capacity, int in_place) {
     if (capacity == 0) {
         capacity = DEFAULT_CAPACITY;
     }
     
+    stack->growth = growth_policy_default();
+    stack->in_place = in_place;
+    stack->size = 0;
+    
+    if (capacity <= STACK_INLINE_CAPACITY) {
+        stack->storage = GROWTH_STORAGE_INLINE;
+        stack->data = stack->inline_data;
+    } else {
+        stack->storage = GROWTH_STORAGE_HEAP;
+        stack->data = growth_realloc(NULL, sizeof(int), 0, &capacity,
+                                     &stack->storage, &stack->growth);
+        if (!stack->data) {
+            return -1;
+        }
+    }
+    
+    stack->capacity = capacity;
+    return 0;
+}
+
+Stack* stack_create_with_capacity(size_t capacity) {
     struct Stack *stack = malloc(sizeof(struct Stack));
     if (!stack) {
         return NULL;
     }
     
-    stack->data = malloc(capacity * sizeof(int));
-    if (!stack->data) {
+    if (_stack_setup(stack, capacity, 0) != 0) {
         free(stack);
         return NULL;
     }
     
-    stack->size = 0;
-    stack->capacity = capacity;
+    return stack;
+}
+
+Stack* stack_init(StackStorage *storage, size_t capacity) {
+    if (!storage) {
+        return NULL;
+    }
+    
+    struct Stack *stack = (struct Stack*)storage;
+    if (_stack_setup(stack, capacity, 1) != 0) {
+        return NULL;
+    }
     
     return stack;
 }
@@ -58,8 +105,45 @@ void stack_destroy(Stack *stack) {
         return;
     }
     
-    free(stack->data);
-    free(stack);
+    growth_free(stack->data, sizeof(int), stack->capacity, stack->storage);
+    if (!stack->in_place) {
+        free(stack);
+    }
+}
+
+int stack_set_growth_policy(Stack *stack, GrowthPolicy policy) {
+    if (!stack || growth_policy_validate(&policy) != 0) {
+        return -1;
+    }
+    
+    stack->growth = policy;
+    return 0;
+}
+
+static int _stack_ensure(struct Stack *stack, size_t required) {
+    if (required <= stack->capacity) {
+        return 0;
+    }
+    
+    size_t new_capacity = growth_next_capacity(&stack->growth, stack->capacity,
+                                               required, sizeof(int));
+    if (new_capacity == 0) {
+        return -1;
+    }
+    
+    return _stack_resize(stack, new_capacity);
+}
+
+int stack_reserve(Stack *stack, size_t capacity) {
+    if (!stack) {
+        return -1;
+    }
+    
+    if (capacity <= stack->capacity) {
+        return 0;
+    }
+    
+    return _stack_resize(stack, capacity);
 }
 
 int stack_push(Stack *stack, int value) {
@@ -67,11 +151,9 @@ int stack_push(Stack *stack, int value) {
         return -1;
     }
     
-    if (stack->size >= stack->capacity) {
-        size_t new_capacity = stack->capacity * GROWTH_FACTOR;
-        if (_stack_resize(stack, new_capacity) != 0) {
-            return -1;
-        }
+    if (stack->size >= stack->capacity &&
+        _stack_ensure(stack, stack->size + 1) != 0) {
+        return -1;
     }
     
     stack->data[stack->size] = value;
@@ -100,6 +182,44 @@ int stack_peek(const Stack *stack, int *out_value) {
     return 0;
 }
 
+int stack_push_n(Stack *stack, const int *values, size_t n) {
+    if (!stack || (!values && n > 0) || n > SIZE_MAX - stack->size) {
+        return -1;
+    }
+    
+    if (_stack_ensure(stack, stack->size + n) != 0) {
+        return -1;
+    }
+    
+    if (n > 0) {
+        memcpy(&stack->data[stack->size], values, n * sizeof(int));
+    }
+    stack->size += n;
+    
+    return 0;
+}
+
+int stack_pop_n(Stack *stack, int *out, size_t n) {
+    if (stack_peek_n(stack, out, n) != 0) {
+        return -1;
+    }
+    
+    stack->size -= n;
+    return 0;
+}
+
+int stack_peek_n(const Stack *stack, int *out, size_t n) {
+    if (!stack || (!out && n > 0) || n > stack->size) {
+        return -1;
+    }
+    
+    if (n > 0) {
+        memcpy(out, &stack->data[stack->size - n], n * sizeof(int));
+    }
+    
+    return 0;
+}
+
 size_t stack_size(const Stack *stack) {
     if (!stack) {
         return 0;
@@ -154,3 +274,29 @@ void stack_print(const Stack *stack) {
     }
     printf(")\n");
 }
+
+static size_t _stack_iter_step(ContainerIter *it, const int **span) {
+    const struct Stack *stack = it->source;
+    if (it->index >= stack->size) {
+        return 0;
+    }
+    
+    size_t n = stack->size - it->index;
+    *span = stack->data + it->index;
+    it->index += n;
+    
+    return n;
+}
+
+int stack_iter_init(const Stack *stack, ContainerIter *it) {
+    if (!stack || !it) {
+        return -1;
+    }
+    
+    it->step = _stack_iter_step;
+    it->source = stack;
+    it->cursor = NULL;
+    it->index = 0;
+    
+    return 0;
+}
@@ -1,4 +1,5 @@
 #include "../include/static_array.h"
+#include "../include/serialize.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -6,6 +7,7 @@
 struct StaticArray {
     int *data;
     size_t capacity;
+    int owns_data; // 0 for views over caller buffers
 };
 
 StaticArray* static_array_create(size_t capacity) {
@@ -25,6 +27,7 @@ StaticArray* static_array_create(size_t capacity) {
     }
     
     arr->capacity = capacity;
+    arr->owns_data = 1;
     
     memset(arr->data, 0, capacity * sizeof(int));
     
@@ -36,10 +39,64 @@ void static_array_destroy(StaticArray *arr) {
         return;
     }
     
-    free(arr->data);
+    if (arr->owns_data) {
+        free(arr->data);
+    }
     free(arr);
 }
 
+int static_array_save_fd(const StaticArray *arr, int fd) {
+    if (!arr) {
+        return -1;
+    }
+    
+    SerialHeader header;
+    serial_header_init(&header, SERIAL_KIND_STATIC_ARRAY, sizeof(int),
+                       arr->capacity);
+    return serial_write(fd, &header, arr->data);
+}
+
+StaticArray* static_array_load_fd(int fd) {
+    SerialHeader header;
+    if (serial_read_header(fd, &header, SERIAL_KIND_STATIC_ARRAY,
+                           sizeof(int)) != 0) {
+        return NULL;
+    }
+    
+    struct StaticArray *arr = static_array_create((size_t)header.count);
+    if (!arr) {
+        return NULL;
+    }
+    
+    if (serial_read_payload(fd, arr->data, sizeof(int),
+                            (size_t)header.count) != 0) {
+        static_array_destroy(arr);
+        return NULL;
+    }
+    
+    return arr;
+}
+
+StaticArray* static_array_view_from_buffer(void *buf, size_t len) {
+    SerialHeader header;
+    int *payload = serial_view(buf, len, &header, SERIAL_KIND_STATIC_ARRAY,
+                               sizeof(int));
+    if (!payload || header.count == 0) {
+        return NULL;
+    }
+    
+    struct StaticArray *arr = malloc(sizeof(struct StaticArray));
+    if (!arr) {
+        return NULL;
+    }
+    
+    arr->data = payload;
+    arr->capacity = (size_t)header.count;
+    arr->owns_data = 0;
+    
+    return arr;
+}
+
 int static_array_set(StaticArray *arr, size_t index, int value) {
     if (!arr || index >= arr->capacity) {
         return -1;
@@ -86,6 +143,14 @@ size_t static_array_capacity(const StaticArray *arr) {
     return arr->capacity;
 }
 
+const int* static_array_data(const StaticArray *arr) {
+    if (!arr) {
+        return NULL;
+    }
+    
+    return arr->data;
+}
+
 int static_array_find(const StaticArray *arr, int value) {
     if (!arr) {
         return -1;
@@ -144,3 +209,29 @@ void static_array_print(const StaticArray *arr) {
     }
     printf("] (capacity: %zu)\n", arr->capacity);
 }
+
+static size_t _static_array_iter_step(ContainerIter *it, const int **span) {
+    const struct StaticArray *arr = it->source;
+    if (it->index >= arr->capacity) {
+        return 0;
+    }
+    
+    size_t n = arr->capacity - it->index;
+    *span = arr->data + it->index;
+    it->index += n;
+    
+    return n;
+}
+
+int static_array_iter_init(const StaticArray *arr, ContainerIter *it) {
+    if (!arr || !it) {
+        return -1;
+    }
+    
+    it->step = _static_array_iter_step;
+    it->source = arr;
+    it->cursor = NULL;
+    it->index = 0;
+    
+    return 0;
+}
@@ -0,0 +1,199 @@
+#include "../include/timer_wheel.h"
+#include <stdlib.h>
+
+#define LEVELS 6
+#define SLOT_BITS 6
+#define SLOTS (1u << SLOT_BITS)
+#define SLOT_MASK (SLOTS - 1)
+#define MAX_SPAN ((uint64_t)1 << (LEVELS * SLOT_BITS))
+
+// Level l spans deadlines up to 64^(l + 1) ticks ahead; each level is
+// a ring of slots indexed by the deadline's bits for that level
+struct TimerWheel {
+    IList slots[LEVELS][SLOTS];
+    IList expiring;     // Timers of the tick being processed
+    uint64_t now;
+    size_t size;
+};
+
+static void _link(TimerWheel *wheel, Timer *timer) {
+    uint64_t delta = timer->expires - wheel->now;
+    IList *slot;
+    
+    if (delta >= MAX_SPAN) {
+        // Too far out: park in the last slot of the top level and let
+        // cascading re-place it when that slot comes around
+        unsigned shift = (LEVELS - 1) * SLOT_BITS;
+        slot = &wheel->slots[LEVELS - 1][((wheel->now >> shift) - 1) & SLOT_MASK];
+    } else {
+        unsigned level = 0;
+        while (delta >= ((uint64_t)1 << ((level + 1) * SLOT_BITS))) {
+            level++;
+        }
+        unsigned shift = level * SLOT_BITS;
+        slot = &wheel->slots[level][(timer->expires >> shift) & SLOT_MASK];
+    }
+    
+    ilist_push_back(slot, &timer->link);
+    timer->slot = slot;
+}
+
+// Re-places every timer of a higher-level slot relative to the new time
+static void _cascade(TimerWheel *wheel, unsigned level) {
+    unsigned shift = level * SLOT_BITS;
+    IList *slot = &wheel->slots[level][(wheel->now >> shift) & SLOT_MASK];
+    
+    IListLink *link;
+    while ((link = ilist_pop_front(slot)) != NULL) {
+        _link(wheel, ILIST_ENTRY(link, Timer, link));
+    }
+}
+
+static size_t _tick(TimerWheel *wheel) {
+    wheel->now++;
+    
+    // Each level whose lower levels all wrapped this tick is due; cascade
+    // top-down so timers can fall through several levels at once
+    unsigned top = 0;
+    while (top + 1 < LEVELS &&
+           ((wheel->now >> (top * SLOT_BITS)) & SLOT_MASK) == 0) {
+        top++;
+    }
+    for (unsigned level = top; level > 0; level--) {
+        _cascade(wheel, level);
+    }
+    
+    // Detach the due slot first: callbacks may arm timers that land in it
+    IList *slot = &wheel->slots[0][wheel->now & SLOT_MASK];
+    IListLink *link;
+    while ((link = ilist_pop_front(slot)) != NULL) {
+        ilist_push_back(&wheel->expiring, link);
+        ILIST_ENTRY(link, Timer, link)->slot = &wheel->expiring;
+    }
+    
+    size_t fired = 0;
+    while ((link = ilist_pop_front(&wheel->expiring)) != NULL) {
+        Timer *timer = ILIST_ENTRY(link, Timer, link);
+        timer->slot = NULL;
+        wheel->size--;
+        fired++;
+        if (timer->callback) {
+            timer->callback(timer, timer->ctx);
+        }
+    }
+    
+    return fired;
+}
+
+void twheel_timer_init(Timer *timer, TimerCallback callback, void *ctx) {
+    if (!timer) {
+        return;
+    }
+    
+    timer->link.next = NULL;
+    timer->link.prev = NULL;
+    timer->slot = NULL;
+    timer->expires = 0;
+    timer->callback = callback;
+    timer->ctx = ctx;
+}
+
+TimerWheel* twheel_create(uint64_t start_tick) {
+    TimerWheel *wheel = malloc(sizeof(TimerWheel));
+    if (!wheel) {
+        return NULL;
+    }
+    
+    for (unsigned level = 0; level < LEVELS; level++) {
+        for (unsigned s = 0; s < SLOTS; s++) {
+            ilist_init(&wheel->slots[level][s]);
+        }
+    }
+    ilist_init(&wheel->expiring);
+    wheel->now = start_tick;
+    wheel->size = 0;
+    
+    return wheel;
+}
+
+void twheel_destroy(TimerWheel *wheel) {
+    free(wheel);
+}
+
+int twheel_schedule(TimerWheel *wheel, Timer *timer, uint64_t delay) {
+    if (!wheel || !timer) {
+        return -1;
+    }
+    
+    if (delay == 0) {
+        delay = 1;
+    }
+    if (delay > UINT64_MAX - wheel->now) {
+        return -1;
+    }
+    
+    if (timer->slot) {
+        ilist_remove(timer->slot, &timer->link);
+        wheel->size--;
+    }
+    
+    timer->expires = wheel->now + delay;
+    _link(wheel, timer);
+    wheel->size++;
+    
+    return 0;
+}
+
+int twheel_cancel(TimerWheel *wheel, Timer *timer) {
+    if (!wheel || !timer || !timer->slot) {
+        return -1;
+    }
+    
+    ilist_remove(timer->slot, &timer->link);
+    timer->slot = NULL;
+    wheel->size--;
+    
+    return 0;
+}
+
+int twheel_is_pending(const Timer *timer) {
+    if (!timer) {
+        return 0;
+    }
+    
+    return timer->slot != NULL;
+}
+
+size_t twheel_advance(TimerWheel *wheel, uint64_t ticks) {
+    if (!wheel) {
+        return 0;
+    }
+    
+    size_t fired = 0;
+    for (uint64_t i = 0; i < ticks; i++) {
+        // Nothing armed: the slots stay empty, so jump the clock
+        if (wheel->size == 0) {
+            wheel->now += ticks - i;
+            break;
+        }
+        fired += _tick(wheel);
+    }
+    
+    return fired;
+}
+
+uint64_t twheel_now(const TimerWheel *wheel) {
+    if (!wheel) {
+        return 0;
+    }
+    
+    return wheel->now;
+}
+
+size_t twheel_size(const TimerWheel *wheel) {
+    if (!wheel) {
+        return 0;
+    }
+    
+    return wheel->size;
+}
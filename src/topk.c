@@ -0,0 +1,182 @@
+#include "../include/topk.h"
+#include <stdlib.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#define FILTER_BLOCK 16
+
+// The heap is ordered the opposite way to the selection: to keep the k
+// largest, a min-heap exposes the weakest survivor at the root
+struct TopK {
+    PriorityQueue *heap;
+    size_t k;
+    int largest;     // 1 for PQUEUE_MAX selection
+    int full;
+    int threshold;   // Root of the heap once full
+};
+
+static int _beats(const TopK *tk, int value) {
+    return tk->largest ? value > tk->threshold : value < tk->threshold;
+}
+
+TopK* topk_create(size_t k, PQueueOrder order) {
+    if (k == 0 || (order != PQUEUE_MIN && order != PQUEUE_MAX)) {
+        return NULL;
+    }
+    
+    TopK *tk = malloc(sizeof(TopK));
+    if (!tk) {
+        return NULL;
+    }
+    
+    PQueueOrder heap_order = order == PQUEUE_MAX ? PQUEUE_MIN : PQUEUE_MAX;
+    tk->heap = pqueue_create_with_order(k, 2, heap_order);
+    if (!tk->heap) {
+        free(tk);
+        return NULL;
+    }
+    
+    tk->k = k;
+    tk->largest = order == PQUEUE_MAX;
+    tk->full = 0;
+    tk->threshold = 0;
+    
+    return tk;
+}
+
+void topk_destroy(TopK *tk) {
+    if (!tk) {
+        return;
+    }
+    
+    pqueue_destroy(tk->heap);
+    free(tk);
+}
+
+int topk_offer(TopK *tk, int value) {
+    if (!tk) {
+        return -1;
+    }
+    
+    if (!tk->full) {
+        if (pqueue_push(tk->heap, value) != 0) {
+            return -1;
+        }
+        if (pqueue_size(tk->heap) == tk->k) {
+            tk->full = 1;
+            pqueue_peek(tk->heap, &tk->threshold);
+        }
+        return 1;
+    }
+    
+    if (!_beats(tk, value)) {
+        return 0;
+    }
+    
+    pqueue_replace_top(tk->heap, value, NULL);
+    pqueue_peek(tk->heap, &tk->threshold);
+    return 1;
+}
+
+#if defined(__SSE2__)
+// Non-zero if any of the FILTER_BLOCK values beats the threshold
+static int _block_has_candidate(const int *values, __m128i t, int largest) {
+    __m128i hit = _mm_setzero_si128();
+    for (size_t i = 0; i < FILTER_BLOCK; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(values + i));
+        hit = _mm_or_si128(hit, largest ? _mm_cmpgt_epi32(v, t)
+                                        : _mm_cmplt_epi32(v, t));
+    }
+    return _mm_movemask_epi8(hit);
+}
+#endif
+
+size_t topk_offer_n(TopK *tk, const int *values, size_t n) {
+    if (!tk || (!values && n > 0)) {
+        return 0;
+    }
+    
+    size_t kept = 0;
+    size_t i = 0;
+    
+    // Fill up to k first; only then is there a threshold to filter with
+    for (; i < n && !tk->full; i++) {
+        kept += topk_offer(tk, values[i]) == 1;
+    }
+    
+#if defined(__SSE2__)
+    // In a long stream almost every block is all rejects: one vector test
+    // per 16 values, and the scalar path only runs on blocks with a hit
+    while (i + FILTER_BLOCK <= n) {
+        __m128i t = _mm_set1_epi32(tk->threshold);
+        if (_block_has_candidate(values + i, t, tk->largest)) {
+            for (size_t j = i; j < i + FILTER_BLOCK; j++) {
+                kept += topk_offer(tk, values[j]) == 1;
+            }
+        }
+        i += FILTER_BLOCK;
+    }
+#endif
+    
+    for (; i < n; i++) {
+        kept += topk_offer(tk, values[i]) == 1;
+    }
+    
+    return kept;
+}
+
+int topk_threshold(const TopK *tk, int *out_value) {
+    if (!tk || !out_value || !tk->full) {
+        return -1;
+    }
+    
+    *out_value = tk->threshold;
+    return 0;
+}
+
+size_t topk_result(TopK *tk, int *out) {
+    if (!tk || !out) {
+        return 0;
+    }
+    
+    // Popping yields worst first; reverse, then rebuild the heap in O(k)
+    size_t n = pqueue_size(tk->heap);
+    if (pqueue_pop_n(tk->heap, out, n) != 0) {
+        return 0;
+    }
+    for (size_t lo = 0, hi = n; lo + 1 < hi; lo++, hi--) {
+        int tmp = out[lo];
+        out[lo] = out[hi - 1];
+        out[hi - 1] = tmp;
+    }
+    pqueue_push_n(tk->heap, out, n);
+    
+    return n;
+}
+
+size_t topk_size(const TopK *tk) {
+    if (!tk) {
+        return 0;
+    }
+    
+    return pqueue_size(tk->heap);
+}
+
+size_t topk_k(const TopK *tk) {
+    if (!tk) {
+        return 0;
+    }
+    
+    return tk->k;
+}
+
+void topk_clear(TopK *tk) {
+    if (!tk) {
+        return;
+    }
+    
+    pqueue_clear(tk->heap);
+    tk->full = 0;
+}
@@ -0,0 +1,391 @@
+#include "../include/unrolled_list.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#define NODE_BYTES 64
+#define NODE_CAPACITY ((NODE_BYTES - sizeof(void*) - sizeof(unsigned)) / sizeof(int))
+
+typedef struct UNode {
+    struct UNode *next;
+    unsigned count;
+    int data[NODE_CAPACITY];
+} UNode;
+
+_Static_assert(sizeof(UNode) <= NODE_BYTES, "unrolled node exceeds a cache line");
+
+struct UnrolledList {
+    UNode *head;
+    UNode *tail;
+    size_t size;
+    size_t nodes;
+};
+
+static UNode* _node_create(void) {
+    UNode *node = aligned_alloc(NODE_BYTES, NODE_BYTES);
+    if (!node) {
+        return NULL;
+    }
+    
+    node->next = NULL;
+    node->count = 0;
+    
+    return node;
+}
+
+// Finds the node holding index; *offset is the position inside it
+static UNode* _locate(const UnrolledList *list, size_t index, size_t *offset,
+                      UNode **prev) {
+    UNode *before = NULL;
+    UNode *node = list->head;
+    while (node && index >= node->count) {
+        index -= node->count;
+        before = node;
+        node = node->next;
+    }
+    
+    *offset = index;
+    if (prev) {
+        *prev = before;
+    }
+    
+    return node;
+}
+
+// Moves the upper half of a full node into a new node after it
+static UNode* _split(UnrolledList *list, UNode *node) {
+    UNode *upper = _node_create();
+    if (!upper) {
+        return NULL;
+    }
+    
+    unsigned keep = node->count / 2;
+    upper->count = node->count - keep;
+    memcpy(upper->data, &node->data[keep], upper->count * sizeof(int));
+    node->count = keep;
+    
+    upper->next = node->next;
+    node->next = upper;
+    if (list->tail == node) {
+        list->tail = upper;
+    }
+    list->nodes++;
+    
+    return upper;
+}
+
+UnrolledList* ulist_create(void) {
+    UnrolledList *list = malloc(sizeof(UnrolledList));
+    if (!list) {
+        return NULL;
+    }
+    
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+    list->nodes = 0;
+    
+    return list;
+}
+
+void ulist_destroy(UnrolledList *list) {
+    if (!list) {
+        return;
+    }
+    
+    ulist_clear(list);
+    free(list);
+}
+
+int ulist_push_front(UnrolledList *list, int value) {
+    return ulist_insert_at(list, 0, value);
+}
+
+int ulist_push_back(UnrolledList *list, int value) {
+    if (!list) {
+        return -1;
+    }
+    
+    if (!list->tail || list->tail->count == NODE_CAPACITY) {
+        UNode *node = _node_create();
+        if (!node) {
+            return -1;
+        }
+        
+        if (list->tail) {
+            list->tail->next = node;
+        } else {
+            list->head = node;
+        }
+        list->tail = node;
+        list->nodes++;
+    }
+    
+    list->tail->data[list->tail->count++] = value;
+    list->size++;
+    
+    return 0;
+}
+
+int ulist_pop_front(UnrolledList *list, int *out_value) {
+    if (!list || !out_value) {
+        return -1;
+    }
+    
+    return ulist_remove_at(list, 0, out_value);
+}
+
+int ulist_pop_back(UnrolledList *list, int *out_value) {
+    if (!list || !out_value || list->size == 0) {
+        return -1;
+    }
+    
+    return ulist_remove_at(list, list->size - 1, out_value);
+}
+
+int ulist_insert_at(UnrolledList *list, size_t index, int value) {
+    if (!list || index > list->size) {
+        return -1;
+    }
+    
+    if (index == list->size) {
+        return ulist_push_back(list, value);
+    }
+    
+    size_t offset;
+    UNode *node = _locate(list, index, &offset, NULL);
+    
+    if (node->count == NODE_CAPACITY) {
+        UNode *upper = _split(list, node);
+        if (!upper) {
+            return -1;
+        }
+        if (offset > node->count) {
+            offset -= node->count;
+            node = upper;
+        }
+    }
+    
+    memmove(&node->data[offset + 1], &node->data[offset],
+            (node->count - offset) * sizeof(int));
+    node->data[offset] = value;
+    node->count++;
+    list->size++;
+    
+    return 0;
+}
+
+int ulist_insert_after(UnrolledList *list, size_t index, int value) {
+    if (!list || index >= list->size) {
+        return -1;
+    }
+    
+    return ulist_insert_at(list, index + 1, value);
+}
+
+int ulist_remove_at(UnrolledList *list, size_t index, int *out_value) {
+    if (!list || index >= list->size) {
+        return -1;
+    }
+    
+    size_t offset;
+    UNode *prev;
+    UNode *node = _locate(list, index, &offset, &prev);
+    
+    if (out_value) {
+        *out_value = node->data[offset];
+    }
+    
+    memmove(&node->data[offset], &node->data[offset + 1],
+            (node->count - offset - 1) * sizeof(int));
+    node->count--;
+    list->size--;
+    
+    if (node->count == 0) {
+        if (prev) {
+            prev->next = node->next;
+        } else {
+            list->head = node->next;
+        }
+        if (list->tail == node) {
+            list->tail = prev;
+        }
+        free(node);
+        list->nodes--;
+        return 0;
+    }
+    
+    // Keep nodes at least half full by absorbing a small successor
+    UNode *next = node->next;
+    if (next && node->count < NODE_CAPACITY / 2 &&
+        node->count + next->count <= NODE_CAPACITY) {
+        memcpy(&node->data[node->count], next->data, next->count * sizeof(int));
+        node->count += next->count;
+        node->next = next->next;
+        if (list->tail == next) {
+            list->tail = node;
+        }
+        free(next);
+        list->nodes--;
+    }
+    
+    return 0;
+}
+
+int ulist_get(const UnrolledList *list, size_t index, int *out_value) {
+    if (!list || !out_value || index >= list->size) {
+        return -1;
+    }
+    
+    size_t offset;
+    const UNode *node = _locate(list, index, &offset, NULL);
+    *out_value = node->data[offset];
+    
+    return 0;
+}
+
+int ulist_set(UnrolledList *list, size_t index, int value) {
+    if (!list || index >= list->size) {
+        return -1;
+    }
+    
+    size_t offset;
+    UNode *node = _locate(list, index, &offset, NULL);
+    node->data[offset] = value;
+    
+    return 0;
+}
+
+size_t ulist_size(const UnrolledList *list) {
+    if (!list) {
+        return 0;
+    }
+    
+    return list->size;
+}
+
+size_t ulist_node_count(const UnrolledList *list) {
+    if (!list) {
+        return 0;
+    }
+    
+    return list->nodes;
+}
+
+int ulist_is_empty(const UnrolledList *list) {
+    if (!list) {
+        return 1;
+    }
+    
+    return list->size == 0;
+}
+
+int ulist_find(const UnrolledList *list, int value) {
+    if (!list) {
+        return -1;
+    }
+    
+    size_t base = 0;
+    for (const UNode *node = list->head; node; node = node->next) {
+        for (unsigned i = 0; i < node->count; i++) {
+            if (node->data[i] == value) {
+                return (int)(base + i);
+            }
+        }
+        base += node->count;
+    }
+    
+    return -1;
+}
+
+void ulist_clear(UnrolledList *list) {
+    if (!list) {
+        return;
+    }
+    
+    UNode *current = list->head;
+    while (current) {
+        UNode *next = current->next;
+        free(current);
+        current = next;
+    }
+    
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+    list->nodes = 0;
+}
+
+void ulist_reverse(UnrolledList *list) {
+    if (!list || !list->head) {
+        return;
+    }
+    
+    UNode *prev = NULL;
+    UNode *current = list->head;
+    list->tail = current;
+    
+    while (current) {
+        for (unsigned lo = 0, hi = current->count - 1; lo < hi; lo++, hi--) {
+            int tmp = current->data[lo];
+            current->data[lo] = current->data[hi];
+            current->data[hi] = tmp;
+        }
+        
+        UNode *next = current->next;
+        current->next = prev;
+        prev = current;
+        current = next;
+    }
+    
+    list->head = prev;
+}
+
+static size_t _ulist_iter_step(ContainerIter *it, const int **span) {
+    const UNode *node = it->cursor;
+    if (!node) {
+        return 0;
+    }
+    
+    *span = node->data;
+    it->cursor = node->next;
+    it->index += node->count;
+    
+    return node->count;
+}
+
+int ulist_iter_init(const UnrolledList *list, ContainerIter *it) {
+    if (!list || !it) {
+        return -1;
+    }
+    
+    it->step = _ulist_iter_step;
+    it->source = list;
+    it->cursor = list->head;
+    it->index = 0;
+    
+    return 0;
+}
+
+void ulist_print(const UnrolledList *list) {
+    if (!list) {
+        printf("NULL\n");
+        return;
+    }
+    
+    printf("[");
+    for (const UNode *node = list->head; node; node = node->next) {
+        printf("(");
+        for (unsigned i = 0; i < node->count; i++) {
+            printf("%d", node->data[i]);
+            if (i + 1 < node->count) {
+                printf(" ");
+            }
+        }
+        printf(")");
+        if (node->next) {
+            printf(" -> ");
+        }
+    }
+    printf("] (size: %zu, nodes: %zu)\n", list->size, list->nodes);
+}
@@ -1,5 +1,8 @@
+#define _POSIX_C_SOURCE 200809L
 #include <stdio.h>
+#include <stdlib.h>
 #include <assert.h>
+#include <unistd.h>
 #include "../include/array.h"
 
 #define TEST(name) printf("Testing %s... ", name)
@@ -228,6 +231,351 @@ int test_error_handling(void) {
     return 0;
 }
 
+int test_growth_policy(void) {
+    TEST("growth policy");
+    
+    DynamicArray *arr = array_create(4);
+    GrowthPolicy policy = growth_policy_default();
+    policy.kind = GROWTH_HALF;
+    assert(array_set_growth_policy(arr, policy) == 0);
+    
+    for (int i = 0; i < 5; i++) {
+        array_push(arr, i);
+    }
+    assert(array_capacity(arr) == 6);
+    
+    policy.kind = GROWTH_FIXED;
+    policy.increment = 10;
+    assert(array_set_growth_policy(arr, policy) == 0);
+    for (int i = 5; i < 7; i++) {
+        array_push(arr, i);
+    }
+    assert(array_capacity(arr) == 16);
+    
+    policy.increment = 0;
+    assert(array_set_growth_policy(arr, policy) == -1);
+    
+    int val;
+    for (int i = 0; i < 7; i++) {
+        array_get(arr, (size_t)i, &val);
+        assert(val == i);
+    }
+    
+    array_destroy(arr);
+    PASS();
+    return 0;
+}
+
+int test_mapped_growth(void) {
+    TEST("mmap-backed growth");
+    
+    DynamicArray *arr = array_create(2);
+    GrowthPolicy policy = growth_policy_default();
+    policy.mmap_threshold = 4096;
+    array_set_growth_policy(arr, policy);
+    
+    for (int i = 0; i < 100000; i++) {
+        assert(array_push(arr, i) == 0);
+    }
+    assert(array_size(arr) == 100000);
+    assert(array_capacity(arr) >= 100000);
+    
+    int val;
+    array_get(arr, 0, &val);
+    assert(val == 0);
+    array_get(arr, 4096, &val);
+    assert(val == 4096);
+    array_get(arr, 99999, &val);
+    assert(val == 99999);
+    
+    assert(array_reserve(arr, 300000) == 0);
+    assert(array_capacity(arr) >= 300000);
+    array_get(arr, 99999, &val);
+    assert(val == 99999);
+    
+    array_destroy(arr);
+    PASS();
+    return 0;
+}
+
+int test_mapped_file(void) {
+    TEST("file-backed mapped array");
+    
+    char path[] = "/tmp/test_array_mapped_XXXXXX";
+    int fd = mkstemp(path);
+    assert(fd >= 0);
+    close(fd);
+    
+    DynamicArray *arr = array_open_mapped(path, ARRAY_MAP_CREATE);
+    assert(arr != NULL);
+    assert(array_size(arr) == 0);
+    
+    for (int i = 0; i < 10000; i++) {
+        assert(array_push(arr, i * 3) == 0);
+    }
+    array_remove(arr, 0, NULL);
+    assert(array_advise(arr, ARRAY_ADVICE_SEQUENTIAL) == 0);
+    assert(array_sync(arr) == 0);
+    array_destroy(arr);
+    
+    arr = array_open_mapped(path, ARRAY_MAP_READONLY);
+    assert(arr != NULL);
+    assert(array_size(arr) == 9999);
+    
+    int val;
+    array_get(arr, 0, &val);
+    assert(val == 3);
+    array_get(arr, 9998, &val);
+    assert(val == 29997);
+    assert(array_push(arr, 1) == -1);
+    assert(array_set(arr, 0, 1) == -1);
+    assert(array_pop(arr, &val) == -1);
+    array_destroy(arr);
+    
+    arr = array_open_mapped(path, ARRAY_MAP_TRUNCATE);
+    assert(arr != NULL);
+    assert(array_size(arr) == 0);
+    array_destroy(arr);
+    
+    DynamicArray *heap = array_create(4);
+    assert(array_sync(heap) == -1);
+    assert(array_advise(heap, ARRAY_ADVICE_RANDOM) == -1);
+    array_destroy(heap);
+    
+    assert(array_open_mapped(NULL, 0) == NULL);
+    assert(array_open_mapped(path, ARRAY_MAP_READONLY | ARRAY_MAP_CREATE) == NULL);
+    
+    unlink(path);
+    PASS();
+    return 0;
+}
+
+static int _is_even(int value, void *ctx) {
+    (void)ctx;
+    return value % 2 == 0;
+}
+
+static int _less_than(int value, void *ctx) {
+    return value < *(int*)ctx;
+}
+
+int test_retain_and_remove_all(void) {
+    TEST("retain_if and remove_all");
+    
+    DynamicArray *arr = array_create(4);
+    for (int i = 0; i < 100; i++) {
+        array_push(arr, i % 10);
+    }
+    
+    assert(array_remove_all(arr, 3) == 10);
+    assert(array_size(arr) == 90);
+    assert(array_find(arr, 3) == -1);
+    assert(array_remove_all(arr, 42) == 0);
+    
+    assert(array_retain_if(arr, _is_even, NULL) == 40);
+    assert(array_size(arr) == 50);
+    
+    int val;
+    for (size_t i = 0; i < array_size(arr); i++) {
+        array_get(arr, i, &val);
+        assert(val == (int)(i % 5) * 2);
+    }
+    
+    assert(array_retain_if(NULL, _is_even, NULL) == 0);
+    assert(array_remove_all(NULL, 1) == 0);
+    
+    array_destroy(arr);
+    PASS();
+    return 0;
+}
+
+int test_partition(void) {
+    TEST("partition");
+    
+    DynamicArray *arr = array_create(8);
+    int values[] = {9, 1, 8, 2, 7, 3, 6, 4, 5};
+    for (size_t i = 0; i < 9; i++) {
+        array_push(arr, values[i]);
+    }
+    
+    int pivot = 5;
+    size_t split = array_partition(arr, _less_than, &pivot);
+    assert(split == 4);
+    assert(array_size(arr) == 9);
+    
+    int val;
+    for (size_t i = 0; i < array_size(arr); i++) {
+        array_get(arr, i, &val);
+        assert((i < split) == (val < pivot));
+    }
+    
+    array_destroy(arr);
+    PASS();
+    return 0;
+}
+
+int test_dedup_sorted(void) {
+    TEST("dedup sorted");
+    
+    DynamicArray *arr = array_create(8);
+    int values[] = {1, 1, 2, 3, 3, 3, 4, 5, 5};
+    for (size_t i = 0; i < 9; i++) {
+        array_push(arr, values[i]);
+    }
+    
+    assert(array_dedup_sorted(arr) == 4);
+    assert(array_size(arr) == 5);
+    
+    int val;
+    for (size_t i = 0; i < 5; i++) {
+        array_get(arr, i, &val);
+        assert(val == (int)i + 1);
+    }
+    assert(array_dedup_sorted(arr) == 0);
+    
+    array_destroy(arr);
+    PASS();
+    return 0;
+}
+
+int test_remove_indices(void) {
+    TEST("remove indices");
+    
+    DynamicArray *arr = array_create(16);
+    for (int i = 0; i < 10; i++) {
+        array_push(arr, i);
+    }
+    
+    size_t bad[] = {3, 3};
+    assert(array_remove_indices(arr, bad, 2) == -1);
+    size_t out_of_range[] = {2, 10};
+    assert(array_remove_indices(arr, out_of_range, 2) == -1);
+    assert(array_size(arr) == 10);
+    
+    size_t idx[] = {0, 4, 5, 9};
+    assert(array_remove_indices(arr, idx, 4) == 0);
+    assert(array_size(arr) == 6);
+    
+    int expected[] = {1, 2, 3, 6, 7, 8};
+    int val;
+    for (size_t i = 0; i < 6; i++) {
+        array_get(arr, i, &val);
+        assert(val == expected[i]);
+    }
+    
+    assert(array_remove_indices(arr, NULL, 0) == 0);
+    assert(array_size(arr) == 6);
+    
+    array_destroy(arr);
+    PASS();
+    return 0;
+}
+
+int test_inline_storage(void) {
+    TEST("inline small-buffer storage");
+    
+    DynamicArray *arr = array_create(4);
+    const int *inline_buf = array_data(arr);
+    for (int i = 0; i < ARRAY_INLINE_CAPACITY; i++) {
+        assert(array_push(arr, i) == 0);
+    }
+    // Growth up to the inline capacity stays in the embedded buffer
+    assert(array_data(arr) == inline_buf);
+    assert(array_capacity(arr) == ARRAY_INLINE_CAPACITY);
+    
+    assert(array_push(arr, 100) == 0);
+    assert(array_data(arr) != inline_buf);
+    assert(array_capacity(arr) == 2 * ARRAY_INLINE_CAPACITY);
+    for (int i = 0; i < ARRAY_INLINE_CAPACITY; i++) {
+        int val;
+        assert(array_get(arr, (size_t)i, &val) == 0 && val == i);
+    }
+    
+    array_destroy(arr);
+    PASS();
+    return 0;
+}
+
+int test_init_in_place(void) {
+    TEST("array_init in caller storage");
+    
+    assert(array_init(NULL, 4) == NULL);
+    
+    DynamicArrayStorage storage;
+    DynamicArray *arr = array_init(&storage, 0);
+    assert(arr != NULL);
+    assert((void*)arr == (void*)&storage);
+    assert(array_capacity(arr) == ARRAY_INLINE_CAPACITY);
+    
+    for (int i = 0; i < 100; i++) {
+        assert(array_insert(arr, 0, i) == 0);
+    }
+    int val;
+    assert(array_get(arr, 0, &val) == 0 && val == 99);
+    assert(array_get(arr, 99, &val) == 0 && val == 0);
+    array_destroy(arr);
+    
+    // Large initial capacity goes straight to the heap
+    arr = array_init(&storage, 1000);
+    assert(array_capacity(arr) == 1000);
+    assert(array_push(arr, 7) == 0);
+    array_destroy(arr);
+    
+    PASS();
+    return 0;
+}
+
+static int _cmp_int(const void *a, const void *b) {
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+int test_nth_element(void) {
+    TEST("nth_element");
+    
+    DynamicArray *arr = array_create(0);
+    assert(array_nth_element(arr, 0) == -1);
+    assert(array_nth_element(NULL, 0) == -1);
+    
+    // Random, many duplicates, sorted, reversed and organ-pipe inputs
+    size_t n = 3001;
+    int *ref = malloc(n * sizeof(int));
+    for (int shape = 0; shape < 5; shape++) {
+        for (size_t pick = 0; pick < n; pick += 250) {
+            array_clear(arr);
+            for (size_t i = 0; i < n; i++) {
+                int v;
+                switch (shape) {
+                    case 0: v = rand(); break;
+                    case 1: v = rand() % 4; break;
+                    case 2: v = (int)i; break;
+                    case 3: v = (int)(n - i); break;
+                    default: v = (int)(i < n / 2 ? i : n - i); break;
+                }
+                array_push(arr, v);
+                ref[i] = v;
+            }
+            qsort(ref, n, sizeof(int), _cmp_int);
+            
+            assert(array_nth_element(arr, pick) == 0);
+            const int *data = array_data(arr);
+            assert(data[pick] == ref[pick]);
+            for (size_t i = 0; i < n; i++) {
+                assert(i > pick || data[i] <= data[pick]);
+                assert(i < pick || data[i] >= data[pick]);
+            }
+        }
+    }
+    
+    assert(array_nth_element(arr, n) == -1);
+    free(ref);
+    array_destroy(arr);
+    
+    PASS();
+    return 0;
+}
+
 int main(void) {
     printf("=== Running Dynamic Array Tests ===\n\n");
     
@@ -243,6 +591,16 @@ int main(void) {
     failed += test_find();
     failed += test_clear();
     failed += test_error_handling();
+    failed += test_growth_policy();
+    failed += test_mapped_growth();
+    failed += test_mapped_file();
+    failed += test_retain_and_remove_all();
+    failed += test_partition();
+    failed += test_dedup_sorted();
+    failed += test_remove_indices();
+    failed += test_inline_storage();
+    failed += test_init_in_place();
+    failed += test_nth_element();
     
     printf("\n");
     if (failed == 0) {
@@ -314,6 +314,34 @@ int test_non_byte_aligned(void) {
     return 0;
 }
 
+int test_find_next(void) {
+    TEST("find_next");
+    
+    Bitset *bs = bitset_create(200);
+    size_t idx;
+    assert(bitset_find_next(bs, 0, &idx) == -1);
+    
+    bitset_set(bs, 3);
+    bitset_set(bs, 64);
+    bitset_set(bs, 199);
+    assert(bitset_find_next(bs, 0, &idx) == 0 && idx == 3);
+    assert(bitset_find_next(bs, 3, &idx) == 0 && idx == 3);
+    assert(bitset_find_next(bs, 4, &idx) == 0 && idx == 64);
+    assert(bitset_find_next(bs, 65, &idx) == 0 && idx == 199);
+    assert(bitset_find_next(bs, 200, &idx) == -1);
+    assert(bitset_find_next(NULL, 0, &idx) == -1);
+    
+    // Padding bits past the end are never reported
+    bitset_clear_all(bs);
+    bitset_flip_all(bs);
+    bitset_clear(bs, 199);
+    assert(bitset_find_next(bs, 199, &idx) == -1);
+    
+    bitset_destroy(bs);
+    PASS();
+    return 0;
+}
+
 int main(void) {
     printf("=== Running Bitset Tests ===\n\n");
     
@@ -333,6 +361,7 @@ int main(void) {
     failed += test_equals();
     failed += test_error_handling();
     failed += test_non_byte_aligned();
+    failed += test_find_next();
     
     printf("\n");
     if (failed == 0) {
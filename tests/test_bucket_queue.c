@@ -0,0 +1,132 @@
+#include <stdio.h>
+#include <assert.h>
+#include <stdlib.h>
+#include <limits.h>
+#include "../include/bucket_queue.h"
+
+#define TEST(name) printf("Testing %s... ", name)
+#define PASS() printf("✓ PASS\n")
+
+#define RANGE 3000
+
+int test_create_destroy(void) {
+    TEST("create and destroy");
+    
+    BucketQueue *bq = bqueue_create(-10, 100);
+    assert(bq != NULL);
+    assert(bqueue_size(bq) == 0);
+    assert(bqueue_is_empty(bq) == 1);
+    
+    int val;
+    assert(bqueue_pop(bq, &val) == -1);
+    assert(bqueue_peek(bq, &val) == -1);
+    bqueue_destroy(bq);
+    bqueue_destroy(NULL);
+    
+    assert(bqueue_create(0, 0) == NULL);
+    assert(bqueue_create(INT_MAX, 2) == NULL);
+    bq = bqueue_create(INT_MAX - 1, 2);
+    assert(bq != NULL);
+    assert(bqueue_push(bq, INT_MAX) == 0);
+    assert(bqueue_pop(bq, &val) == 0 && val == INT_MAX);
+    bqueue_destroy(bq);
+    
+    assert(bqueue_size(NULL) == 0);
+    assert(bqueue_is_empty(NULL) == 1);
+    assert(bqueue_push(NULL, 1) == -1);
+    
+    PASS();
+    return 0;
+}
+
+int test_push_pop(void) {
+    TEST("push, pop and range checks");
+    
+    BucketQueue *bq = bqueue_create(-10, 100);
+    assert(bqueue_push(bq, -11) == -1);
+    assert(bqueue_push(bq, 90) == -1);
+    
+    int values[] = {40, -10, 89, 3, 3, 70, 0};
+    for (int i = 0; i < 7; i++) {
+        assert(bqueue_push(bq, values[i]) == 0);
+    }
+    assert(bqueue_size(bq) == 7);
+    
+    int val;
+    assert(bqueue_peek(bq, &val) == 0 && val == -10);
+    assert(bqueue_pop(bq, &val) == 0 && val == -10);
+    assert(bqueue_pop(bq, &val) == 0 && val == 0);
+    
+    // Pushing below the current minimum is fine (not monotone-only)
+    assert(bqueue_push(bq, -5) == 0);
+    int expected[] = {-5, 3, 3, 40, 70, 89};
+    for (int i = 0; i < 6; i++) {
+        assert(bqueue_pop(bq, &val) == 0 && val == expected[i]);
+    }
+    assert(bqueue_is_empty(bq));
+    
+    bqueue_push(bq, 50);
+    bqueue_push(bq, 20);
+    bqueue_clear(bq);
+    assert(bqueue_is_empty(bq));
+    assert(bqueue_pop(bq, &val) == -1);
+    bqueue_push(bq, 60);
+    assert(bqueue_pop(bq, &val) == 0 && val == 60);
+    
+    bqueue_destroy(bq);
+    PASS();
+    return 0;
+}
+
+int test_matches_reference(void) {
+    TEST("random operations against a count table");
+    
+    BucketQueue *bq = bqueue_create(-1000, RANGE);
+    int counts[RANGE] = {0};
+    size_t size = 0;
+    
+    srand(777);
+    for (int step = 0; step < 100000; step++) {
+        int val;
+        if (rand() % 3 != 0) {
+            val = rand() % RANGE - 1000;
+            assert(bqueue_push(bq, val) == 0);
+            counts[val + 1000]++;
+            size++;
+        } else if (size > 0) {
+            int lo = 0;
+            while (counts[lo] == 0) {
+                lo++;
+            }
+            assert(bqueue_pop(bq, &val) == 0 && val == lo - 1000);
+            counts[lo]--;
+            size--;
+        } else {
+            assert(bqueue_pop(bq, &val) == -1);
+        }
+        assert(bqueue_size(bq) == size);
+    }
+    
+    bqueue_destroy(bq);
+    PASS();
+    return 0;
+}
+
+int main(void) {
+    printf("=== Running Bucket Queue Tests ===\n\n");
+    
+    int failed = 0;
+    
+    failed += test_create_destroy();
+    failed += test_push_pop();
+    failed += test_matches_reference();
+    
+    printf("\n");
+    if (failed == 0) {
+        printf("✓ All tests passed!\n");
+    } else {
+        printf("✗ %d test(s) failed\n", failed);
+    }
+    
+    return failed;
+}
@@ -0,0 +1,206 @@
+#include <stdio.h>
+#include <assert.h>
+#include "../include/container_iter.h"
+#include "../include/array.h"
+#include "../include/static_array.h"
+#include "../include/stack.h"
+#include "../include/gap_array.h"
+#include "../include/ring_buffer.h"
+#include "../include/queue.h"
+#include "../include/deque.h"
+#include "../include/singly_linked_list.h"
+#include "../include/doubly_linked_list.h"
+
+#define TEST(name) printf("Testing %s... ", name)
+#define PASS() printf("✓ PASS\n")
+
+#define MAX_ELEMS 64
+
+typedef struct {
+    int values[MAX_ELEMS];
+    size_t count;
+    size_t spans;
+} Walk;
+
+static Walk _walk(ContainerIter *it) {
+    Walk w = { {0}, 0, 0 };
+    const int *span;
+    size_t n;
+    while ((n = container_iter_next(it, &span)) > 0) {
+        for (size_t i = 0; i < n; i++) {
+            assert(w.count < MAX_ELEMS);
+            w.values[w.count++] = span[i];
+        }
+        w.spans++;
+    }
+    // Exhausted iterators stay exhausted
+    assert(container_iter_next(it, &span) == 0);
+    return w;
+}
+
+static void _assert_sequence(const Walk *w, int first, size_t count) {
+    assert(w->count == count);
+    for (size_t i = 0; i < count; i++) {
+        assert(w->values[i] == first + (int)i);
+    }
+}
+
+int test_contiguous_containers(void) {
+    TEST("DynamicArray, StaticArray and Stack yield one span");
+    
+    ContainerIter it;
+    assert(container_iter_next(NULL, NULL) == 0);
+    assert(array_iter_init(NULL, &it) == -1);
+    
+    DynamicArray *arr = array_create(4);
+    assert(array_iter_init(arr, &it) == 0);
+    Walk w = _walk(&it);
+    assert(w.count == 0 && w.spans == 0);
+    for (int i = 0; i < 40; i++) {
+        array_push(arr, i);
+    }
+    array_iter_init(arr, &it);
+    w = _walk(&it);
+    _assert_sequence(&w, 0, 40);
+    assert(w.spans == 1);
+    array_destroy(arr);
+    
+    StaticArray *sarr = static_array_create(5);
+    for (size_t i = 0; i < 5; i++) {
+        static_array_set(sarr, i, 10 + (int)i);
+    }
+    assert(static_array_iter_init(sarr, &it) == 0);
+    w = _walk(&it);
+    _assert_sequence(&w, 10, 5);
+    assert(w.spans == 1);
+    static_array_destroy(sarr);
+    
+    Stack *stack = stack_create();
+    for (int i = 0; i < 20; i++) {
+        stack_push(stack, i);
+    }
+    assert(stack_iter_init(stack, &it) == 0);
+    w = _walk(&it);
+    _assert_sequence(&w, 0, 20);
+    assert(w.spans == 1);
+    stack_destroy(stack);
+    
+    PASS();
+    return 0;
+}
+
+int test_split_containers(void) {
+    TEST("RingBuffer and GapArray yield up to two spans");
+    
+    ContainerIter it;
+    RingBuffer *rb = ring_buffer_create(8);
+    for (int i = 0; i < 6; i++) {
+        ring_buffer_write(rb, i);
+    }
+    assert(ring_buffer_iter_init(rb, &it) == 0);
+    Walk w = _walk(&it);
+    _assert_sequence(&w, 0, 6);
+    assert(w.spans == 1);
+    
+    // Wrap around: contents 4..10 straddle the end of the buffer
+    int val;
+    for (int i = 0; i < 4; i++) {
+        ring_buffer_read(rb, &val);
+    }
+    for (int i = 6; i < 11; i++) {
+        ring_buffer_write(rb, i);
+    }
+    ring_buffer_iter_init(rb, &it);
+    w = _walk(&it);
+    _assert_sequence(&w, 4, 7);
+    assert(w.spans == 2);
+    ring_buffer_destroy(rb);
+    
+    GapArray *gap = gap_array_create(4);
+    for (int i = 0; i < 10; i++) {
+        gap_array_push(gap, i);
+    }
+    gap_array_move_cursor(gap, 3);
+    assert(gap_array_iter_init(gap, &it) == 0);
+    w = _walk(&it);
+    _assert_sequence(&w, 0, 10);
+    assert(w.spans == 2);
+    
+    gap_array_move_cursor(gap, 0);
+    gap_array_iter_init(gap, &it);
+    w = _walk(&it);
+    _assert_sequence(&w, 0, 10);
+    assert(w.spans == 1);
+    gap_array_destroy(gap);
+    
+    PASS();
+    return 0;
+}
+
+int test_linked_containers(void) {
+    TEST("Queue, Deque and lists yield one node per span");
+    
+    ContainerIter it;
+    Queue *queue = queue_create();
+    Deque *deque = deque_create();
+    SinglyLinkedList *slist = slist_create();
+    DoublyLinkedList *dlist = dlist_create();
+    
+    assert(queue_iter_init(queue, &it) == 0);
+    assert(_walk(&it).count == 0);
+    
+    for (int i = 0; i < 12; i++) {
+        queue_enqueue(queue, i);
+        deque_push_back(deque, i);
+        slist_push_back(slist, i);
+        dlist_push_back(dlist, i);
+    }
+    deque_push_front(deque, -1);
+    
+    queue_iter_init(queue, &it);
+    Walk w = _walk(&it);
+    _assert_sequence(&w, 0, 12);
+    assert(w.spans == 12);
+    
+    deque_iter_init(deque, &it);
+    w = _walk(&it);
+    _assert_sequence(&w, -1, 13);
+    
+    slist_iter_init(slist, &it);
+    w = _walk(&it);
+    _assert_sequence(&w, 0, 12);
+    
+    dlist_iter_init(dlist, &it);
+    w = _walk(&it);
+    _assert_sequence(&w, 0, 12);
+    
+    assert(queue_iter_init(queue, NULL) == -1);
+    assert(slist_iter_init(NULL, &it) == -1);
+    
+    queue_destroy(queue);
+    deque_destroy(deque);
+    slist_destroy(slist);
+    dlist_destroy(dlist);
+    
+    PASS();
+    return 0;
+}
+
+int main(void) {
+    printf("=== Running Container Iterator Tests ===\n\n");
+    
+    int failed = 0;
+    
+    failed += test_contiguous_containers();
+    failed += test_split_containers();
+    failed += test_linked_containers();
+    
+    printf("\n");
+    if (failed == 0) {
+        printf("✓ All tests passed!\n");
+    } else {
+        printf("✗ %d test(s) failed\n", failed);
+    }
+    
+    return failed;
+}
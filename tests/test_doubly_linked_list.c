@@ -1,5 +1,7 @@
 #include <stdio.h>
 #include <assert.h>
+#include <stdlib.h>
+#include <string.h>
 #include "../include/doubly_linked_list.h"
 
 #define TEST(name) printf("Testing %s... ", name)
@@ -302,6 +304,458 @@ int test_error_handling(void) {
     return 0;
 }
 
+static void _assert_list(DoublyLinkedList *list, const int *expected, size_t n) {
+    assert(dlist_size(list) == n);
+    DListCursor cursor;
+    dlist_cursor_front(list, &cursor);
+    for (size_t i = 0; i < n; i++) {
+        int val;
+        assert(dlist_cursor_get(&cursor, &val) == 0);
+        assert(val == expected[i]);
+        dlist_cursor_next(&cursor);
+    }
+    assert(dlist_cursor_valid(&cursor) == 0);
+    
+    // Backwards links must agree
+    dlist_cursor_back(list, &cursor);
+    for (size_t i = n; i > 0; i--) {
+        int val;
+        assert(dlist_cursor_get(&cursor, &val) == 0);
+        assert(val == expected[i - 1]);
+        dlist_cursor_prev(&cursor);
+    }
+    assert(dlist_cursor_valid(&cursor) == 0);
+}
+
+int test_cursor_navigation(void) {
+    TEST("cursor navigation");
+    
+    DoublyLinkedList *list = dlist_create();
+    DListCursor cursor;
+    assert(dlist_cursor_front(NULL, &cursor) == -1);
+    assert(dlist_cursor_front(list, &cursor) == 0);
+    assert(dlist_cursor_valid(&cursor) == 0);
+    assert(dlist_cursor_next(&cursor) == -1);
+    
+    for (int i = 1; i <= 3; i++) {
+        dlist_push_back(list, i);
+    }
+    
+    int val;
+    dlist_cursor_front(list, &cursor);
+    assert(dlist_cursor_get(&cursor, &val) == 0 && val == 1);
+    assert(dlist_cursor_next(&cursor) == 0);
+    assert(dlist_cursor_next(&cursor) == 0);
+    assert(dlist_cursor_get(&cursor, &val) == 0 && val == 3);
+    assert(dlist_cursor_next(&cursor) == -1);
+    assert(dlist_cursor_get(&cursor, &val) == -1);
+    
+    // The end position wraps to either side
+    assert(dlist_cursor_next(&cursor) == 0);
+    assert(dlist_cursor_get(&cursor, &val) == 0 && val == 1);
+    assert(dlist_cursor_prev(&cursor) == -1);
+    assert(dlist_cursor_prev(&cursor) == 0);
+    assert(dlist_cursor_get(&cursor, &val) == 0 && val == 3);
+    
+    assert(dlist_cursor_set(&cursor, 30) == 0);
+    assert(dlist_get(list, 2, &val) == 0 && val == 30);
+    
+    dlist_destroy(list);
+    PASS();
+    return 0;
+}
+
+int test_cursor_editing(void) {
+    TEST("cursor insert/remove");
+    
+    DoublyLinkedList *list = dlist_create();
+    DListCursor cursor;
+    dlist_cursor_front(list, &cursor);
+    
+    // At the end position: insert_before appends, insert_after prepends
+    assert(dlist_cursor_insert_before(&cursor, 2) == 0);
+    assert(dlist_cursor_insert_after(&cursor, 1) == 0);
+    assert(dlist_cursor_insert_before(&cursor, 4) == 0);
+    int step1[] = {1, 2, 4};
+    _assert_list(list, step1, 3);
+    
+    dlist_cursor_front(list, &cursor);
+    dlist_cursor_next(&cursor);
+    assert(dlist_cursor_insert_after(&cursor, 3) == 0);
+    assert(dlist_cursor_insert_before(&cursor, 0) == 0);
+    int val;
+    assert(dlist_cursor_get(&cursor, &val) == 0 && val == 2);
+    int step2[] = {1, 0, 2, 3, 4};
+    _assert_list(list, step2, 5);
+    
+    assert(dlist_cursor_remove(&cursor, &val) == 0 && val == 2);
+    assert(dlist_cursor_get(&cursor, &val) == 0 && val == 3);
+    dlist_cursor_back(list, &cursor);
+    assert(dlist_cursor_remove(&cursor, NULL) == 0);
+    assert(dlist_cursor_valid(&cursor) == 0);
+    assert(dlist_cursor_remove(&cursor, NULL) == -1);
+    dlist_cursor_front(list, &cursor);
+    assert(dlist_cursor_remove(&cursor, &val) == 0 && val == 1);
+    int step3[] = {0, 3};
+    _assert_list(list, step3, 2);
+    
+    dlist_destroy(list);
+    PASS();
+    return 0;
+}
+
+int test_cursor_move_to_front(void) {
+    TEST("cursor move-to-front/back");
+    
+    DoublyLinkedList *list = dlist_create();
+    for (int i = 0; i < 5; i++) {
+        dlist_push_back(list, i);
+    }
+    
+    DListCursor cursor;
+    dlist_cursor_front(list, &cursor);
+    dlist_cursor_next(&cursor);
+    dlist_cursor_next(&cursor);
+    assert(dlist_cursor_move_to_front(&cursor) == 0);
+    int val;
+    assert(dlist_cursor_get(&cursor, &val) == 0 && val == 2);
+    int step1[] = {2, 0, 1, 3, 4};
+    _assert_list(list, step1, 5);
+    
+    assert(dlist_cursor_move_to_front(&cursor) == 0);
+    _assert_list(list, step1, 5);
+    
+    dlist_cursor_back(list, &cursor);
+    assert(dlist_cursor_move_to_front(&cursor) == 0);
+    int step2[] = {4, 2, 0, 1, 3};
+    _assert_list(list, step2, 5);
+    
+    assert(dlist_cursor_move_to_back(&cursor) == 0);
+    _assert_list(list, step1, 5);
+    
+    DListCursor end = { list, NULL };
+    assert(dlist_cursor_move_to_front(&end) == -1);
+    
+    dlist_destroy(list);
+    PASS();
+    return 0;
+}
+
+int test_splice_and_merge(void) {
+    TEST("splice and merge");
+    
+    DoublyLinkedList *a = dlist_create();
+    DoublyLinkedList *b = dlist_create();
+    for (int i = 0; i < 3; i++) {
+        dlist_push_back(a, i);
+        dlist_push_back(b, 10 + i);
+    }
+    
+    assert(dlist_splice(a, b) == 0);
+    assert(dlist_is_empty(b) == 1);
+    int step1[] = {0, 1, 2, 10, 11, 12};
+    _assert_list(a, step1, 6);
+    assert(dlist_splice(a, b) == 0);
+    assert(dlist_splice(a, a) == -1);
+    _assert_list(a, step1, 6);
+    
+    dlist_push_back(b, 100);
+    dlist_push_back(b, 101);
+    DListCursor cursor;
+    dlist_cursor_front(a, &cursor);
+    dlist_cursor_next(&cursor);
+    assert(dlist_cursor_splice_before(&cursor, b) == 0);
+    int step2[] = {0, 100, 101, 1, 2, 10, 11, 12};
+    _assert_list(a, step2, 8);
+    
+    dlist_push_back(b, 7);
+    dlist_cursor_front(a, &cursor);
+    assert(dlist_cursor_splice_before(&cursor, b) == 0);
+    int val;
+    assert(dlist_get(a, 0, &val) == 0 && val == 7);
+    assert(dlist_size(a) == 9);
+    
+    dlist_clear(a);
+    int left[] = {1, 3, 3, 8, 9};
+    int right[] = {0, 3, 4, 10, 11};
+    for (int i = 0; i < 5; i++) {
+        dlist_push_back(a, left[i]);
+        dlist_push_back(b, right[i]);
+    }
+    assert(dlist_merge(a, b) == 0);
+    assert(dlist_is_empty(b) == 1);
+    int merged[] = {0, 1, 3, 3, 3, 4, 8, 9, 10, 11};
+    _assert_list(a, merged, 10);
+    
+    // Merge into an empty list takes everything
+    dlist_push_back(b, 5);
+    dlist_clear(a);
+    assert(dlist_merge(a, b) == 0);
+    int single[] = {5};
+    _assert_list(a, single, 1);
+    assert(dlist_merge(a, a) == -1);
+    
+    dlist_destroy(a);
+    dlist_destroy(b);
+    PASS();
+    return 0;
+}
+
+static void _cursor_at(DoublyLinkedList *list, size_t index, DListCursor *cursor) {
+    dlist_cursor_front(list, cursor);
+    for (size_t k = 0; k < index; k++) {
+        dlist_cursor_next(cursor);
+    }
+}
+
+int test_indexed_access_after_mutation(void) {
+    TEST("indexed access stays correct across mutations");
+    
+    DoublyLinkedList *list = dlist_create();
+    DoublyLinkedList *other = dlist_create();
+    DListCursor cursor;
+    int ref[512];
+    size_t n = 0;
+    int val;
+    srand(13);
+    
+    for (int step = 0; step < 6000; step++) {
+        size_t i = n > 0 ? (size_t)rand() % n : 0;
+        switch (rand() % 10) {
+            case 0:
+                if (n < 500 && dlist_push_front(list, step) == 0) {
+                    memmove(ref + 1, ref, n * sizeof(int));
+                    ref[0] = step;
+                    n++;
+                }
+                break;
+            case 1:
+                if (n < 500 && dlist_push_back(list, step) == 0) {
+                    ref[n++] = step;
+                }
+                break;
+            case 2:
+                if (n > 0 && dlist_pop_front(list, &val) == 0) {
+                    assert(val == ref[0]);
+                    memmove(ref, ref + 1, --n * sizeof(int));
+                }
+                break;
+            case 3:
+                if (n > 0 && dlist_pop_back(list, &val) == 0) {
+                    assert(val == ref[--n]);
+                }
+                break;
+            case 4:
+                if (n < 500 && dlist_insert_at(list, i, step) == 0) {
+                    memmove(ref + i + 1, ref + i, (n - i) * sizeof(int));
+                    ref[i] = step;
+                    n++;
+                }
+                break;
+            case 5:
+                if (n > 0 && dlist_remove_at(list, i, &val) == 0) {
+                    assert(val == ref[i]);
+                    memmove(ref + i, ref + i + 1, (n - i - 1) * sizeof(int));
+                    n--;
+                }
+                break;
+            case 6:
+                if (n > 0) {
+                    _cursor_at(list, i, &cursor);
+                    dlist_cursor_move_to_front(&cursor);
+                    int moved = ref[i];
+                    memmove(ref + 1, ref, i * sizeof(int));
+                    ref[0] = moved;
+                }
+                break;
+            case 7:
+                if (n > 0) {
+                    _cursor_at(list, i, &cursor);
+                    assert(dlist_cursor_remove(&cursor, &val) == 0 && val == ref[i]);
+                    memmove(ref + i, ref + i + 1, (n - i - 1) * sizeof(int));
+                    n--;
+                }
+                break;
+            case 8:
+                if (n < 496) {
+                    size_t at = n > 0 ? (size_t)rand() % (n + 1) : 0;
+                    for (int k = 0; k < 3; k++) {
+                        dlist_push_back(other, 10000 + k);
+                    }
+                    _cursor_at(list, at, &cursor);
+                    dlist_cursor_splice_before(&cursor, other);
+                    memmove(ref + at + 3, ref + at, (n - at) * sizeof(int));
+                    for (int k = 0; k < 3; k++) {
+                        ref[at + (size_t)k] = 10000 + k;
+                    }
+                    n += 3;
+                }
+                break;
+            default:
+                dlist_reverse(list);
+                for (size_t k = 0; k < n / 2; k++) {
+                    int tmp = ref[k];
+                    ref[k] = ref[n - 1 - k];
+                    ref[n - 1 - k] = tmp;
+                }
+                break;
+        }
+        
+        assert(dlist_size(list) == n);
+        if (n > 0) {
+            size_t k = (size_t)rand() % n;
+            assert(dlist_get(list, k, &val) == 0 && val == ref[k]);
+            assert(dlist_set(list, k, -step) == 0);
+            ref[k] = -step;
+        }
+    }
+    
+    for (size_t k = 0; k < n; k++) {
+        assert(dlist_get(list, k, &val) == 0 && val == ref[k]);
+    }
+    for (size_t k = n; k > 0; k--) {
+        assert(dlist_get(list, k - 1, &val) == 0 && val == ref[k - 1]);
+    }
+    
+    dlist_destroy(other);
+    dlist_destroy(list);
+    PASS();
+    return 0;
+}
+
+int test_from_to_array(void) {
+    TEST("bulk construction and export");
+    
+    int values[] = {5, 3, 9, 1, 7};
+    DoublyLinkedList *list = dlist_from_array(values, 5);
+    assert(list != NULL);
+    assert(dlist_size(list) == 5);
+    
+    int out[8];
+    assert(dlist_to_array(list, out) == 0);
+    assert(memcmp(out, values, sizeof(values)) == 0);
+    
+    // Slab nodes are recycled through pops and pushes
+    int val;
+    assert(dlist_pop_front(list, &val) == 0 && val == 5);
+    assert(dlist_remove_at(list, 1, &val) == 0 && val == 9);
+    assert(dlist_push_front(list, 42) == 0);
+    assert(dlist_push_back(list, 43) == 0);
+    assert(dlist_push_back(list, 44) == 0);
+    int expected[] = {42, 3, 1, 7, 43, 44};
+    assert(dlist_to_array(list, out) == 0);
+    assert(memcmp(out, expected, sizeof(expected)) == 0);
+    dlist_destroy(list);
+    
+    list = dlist_from_array(NULL, 0);
+    assert(list != NULL && dlist_is_empty(list) == 1);
+    assert(dlist_to_array(list, NULL) == 0);
+    dlist_destroy(list);
+    assert(dlist_from_array(NULL, 3) == NULL);
+    assert(dlist_to_array(NULL, out) == -1);
+    
+    PASS();
+    return 0;
+}
+
+int test_sort(void) {
+    TEST("merge sort");
+    
+    DoublyLinkedList *list = dlist_create();
+    dlist_sort(list);
+    dlist_push_back(list, 1);
+    dlist_sort(list);
+    assert(dlist_size(list) == 1);
+    dlist_sort(NULL);
+    dlist_destroy(list);
+    
+    int values[1000];
+    srand(3);
+    for (int i = 0; i < 1000; i++) {
+        values[i] = rand() % 200 - 100;
+    }
+    list = dlist_from_array(values, 1000);
+    dlist_sort(list);
+    assert(dlist_size(list) == 1000);
+    
+    int out[1000];
+    dlist_to_array(list, out);
+    long sum_in = 0;
+    long sum_out = 0;
+    for (int i = 0; i < 1000; i++) {
+        sum_in += values[i];
+        sum_out += out[i];
+        if (i > 0) {
+            assert(out[i - 1] <= out[i]);
+        }
+    }
+    assert(sum_in == sum_out);
+    
+    // prev links and tail are rebuilt too
+    int k = 999;
+    DListCursor cursor;
+    dlist_cursor_back(list, &cursor);
+    while (dlist_cursor_valid(&cursor)) {
+        int v;
+        dlist_cursor_get(&cursor, &v);
+        assert(v == out[k--]);
+        dlist_cursor_prev(&cursor);
+    }
+    assert(k == -1);
+    
+    // The list stays fully usable after relinking
+    int val;
+    assert(dlist_get(list, 999, &val) == 0 && val == out[999]);
+    assert(dlist_pop_back(list, &val) == 0 && val == out[999]);
+    assert(dlist_push_back(list, 1000) == 0);
+    assert(dlist_get(list, 999, &val) == 0 && val == 1000);
+    
+    dlist_destroy(list);
+    PASS();
+    return 0;
+}
+
+int test_splice_slab_lists(void) {
+    TEST("splice and merge move slab-backed nodes");
+    
+    int evens[] = {0, 2, 4, 6};
+    int odds[] = {1, 3, 5, 7};
+    DoublyLinkedList *a = dlist_from_array(evens, 4);
+    DoublyLinkedList *b = dlist_from_array(odds, 4);
+    DoublyLinkedList *c = dlist_create();
+    
+    assert(dlist_merge(a, b) == 0);
+    assert(dlist_size(a) == 8 && dlist_is_empty(b) == 1);
+    int out[16];
+    dlist_to_array(a, out);
+    for (int i = 0; i < 8; i++) {
+        assert(out[i] == i);
+    }
+    
+    // b's nodes now belong to a; freeing them through a must work
+    int val;
+    assert(dlist_remove_at(a, 1, &val) == 0 && val == 1);
+    assert(dlist_pop_back(a, &val) == 0 && val == 7);
+    
+    dlist_push_back(c, 100);
+    assert(dlist_splice(c, a) == 0);
+    assert(dlist_size(c) == 7 && dlist_is_empty(a) == 1);
+    dlist_sort(c);
+    assert(dlist_get(c, 0, &val) == 0 && val == 0);
+    assert(dlist_get(c, 6, &val) == 0 && val == 100);
+    
+    // b is reusable after handing its slab away
+    assert(dlist_push_back(b, 9) == 0);
+    assert(dlist_pop_front(b, &val) == 0 && val == 9);
+    
+    dlist_destroy(a);
+    dlist_destroy(b);
+    dlist_clear(c);
+    dlist_destroy(c);
+    PASS();
+    return 0;
+}
+
 int main(void) {
     printf("=== Running Doubly Linked List Tests ===\n\n");
     
@@ -320,6 +774,14 @@ int main(void) {
     failed += test_reverse();
     failed += test_bidirectional_access();
     failed += test_error_handling();
+    failed += test_cursor_navigation();
+    failed += test_cursor_editing();
+    failed += test_cursor_move_to_front();
+    failed += test_splice_and_merge();
+    failed += test_indexed_access_after_mutation();
+    failed += test_from_to_array();
+    failed += test_sort();
+    failed += test_splice_slab_lists();
     
     printf("\n");
     if (failed == 0) {
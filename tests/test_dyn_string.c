@@ -309,6 +309,27 @@ int test_error_handling(void) {
     return 0;
 }
 
+int test_growth_policy(void) {
+    TEST("growth policy");
+    
+    String *str = string_create_with_capacity(4);
+    GrowthPolicy policy = growth_policy_default();
+    policy.kind = GROWTH_FIXED;
+    policy.increment = 8;
+    assert(string_set_growth_policy(str, policy) == 0);
+    
+    string_append(str, "Hello");
+    assert(string_capacity(str) == 12);
+    
+    string_append(str, ", World! This is longer");
+    assert(string_capacity(str) == 36);
+    assert(string_equals(str, "Hello, World! This is longer") == 1);
+    
+    string_destroy(str);
+    PASS();
+    return 0;
+}
+
 int main(void) {
     printf("=== Running String Tests ===\n\n");
     
@@ -330,6 +351,7 @@ int main(void) {
     failed += test_clear();
     failed += test_resize();
     failed += test_error_handling();
+    failed += test_growth_policy();
     
     printf("\n");
     if (failed == 0) {
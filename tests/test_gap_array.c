@@ -0,0 +1,201 @@
+#include <stdio.h>
+#include <assert.h>
+#include <stdlib.h>
+#include "../include/gap_array.h"
+#include "../include/array.h"
+
+#define TEST(name) printf("Testing %s... ", name)
+#define PASS() printf("✓ PASS\n")
+
+static void _assert_matches(const GapArray *gap, const DynamicArray *ref) {
+    assert(gap_array_size(gap) == array_size(ref));
+    for (size_t i = 0; i < array_size(ref); i++) {
+        int a, b;
+        assert(gap_array_get(gap, i, &a) == 0);
+        assert(array_get(ref, i, &b) == 0);
+        assert(a == b);
+    }
+}
+
+int test_create_destroy(void) {
+    TEST("create and destroy");
+    
+    GapArray *arr = gap_array_create(0);
+    assert(arr != NULL);
+    assert(gap_array_size(arr) == 0);
+    assert(gap_array_capacity(arr) == 16);
+    assert(gap_array_is_empty(arr) == 1);
+    assert(gap_array_cursor(arr) == 0);
+    gap_array_destroy(arr);
+    gap_array_destroy(NULL);
+    
+    assert(gap_array_size(NULL) == 0);
+    assert(gap_array_is_empty(NULL) == 1);
+    
+    PASS();
+    return 0;
+}
+
+int test_push_pop_get_set(void) {
+    TEST("push/pop/get/set");
+    
+    GapArray *arr = gap_array_create(2);
+    for (int i = 0; i < 100; i++) {
+        assert(gap_array_push(arr, i) == 0);
+    }
+    assert(gap_array_size(arr) == 100);
+    assert(gap_array_capacity(arr) >= 100);
+    
+    int val;
+    assert(gap_array_get(arr, 42, &val) == 0 && val == 42);
+    assert(gap_array_get(arr, 100, &val) == -1);
+    assert(gap_array_set(arr, 42, -42) == 0);
+    assert(gap_array_get(arr, 42, &val) == 0 && val == -42);
+    assert(gap_array_set(arr, 100, 0) == -1);
+    assert(gap_array_find(arr, -42) == 42);
+    assert(gap_array_find(arr, 1000) == -1);
+    
+    assert(gap_array_pop(arr, &val) == 0 && val == 99);
+    assert(gap_array_size(arr) == 99);
+    
+    gap_array_clear(arr);
+    assert(gap_array_is_empty(arr) == 1);
+    assert(gap_array_pop(arr, &val) == -1);
+    
+    gap_array_destroy(arr);
+    PASS();
+    return 0;
+}
+
+int test_cursor_editing(void) {
+    TEST("cursor editing");
+    
+    GapArray *arr = gap_array_create(4);
+    for (int i = 1; i <= 5; i++) {
+        gap_array_cursor_insert(arr, i);
+    }
+    assert(gap_array_cursor(arr) == 5);
+    
+    assert(gap_array_move_cursor(arr, 2) == 0);
+    assert(gap_array_move_cursor(arr, 6) == -1);
+    gap_array_cursor_insert(arr, 10);
+    gap_array_cursor_insert(arr, 11);
+    assert(gap_array_cursor(arr) == 4);
+    
+    // 1 2 10 11 | 3 4 5
+    int val;
+    assert(gap_array_cursor_backspace(arr, &val) == 0 && val == 11);
+    assert(gap_array_cursor_delete(arr, &val) == 0 && val == 3);
+    
+    int expected[] = {1, 2, 10, 4, 5};
+    int out[5];
+    assert(gap_array_size(arr) == 5);
+    assert(gap_array_copy_to(arr, out) == 0);
+    for (int i = 0; i < 5; i++) {
+        assert(out[i] == expected[i]);
+        assert(gap_array_get(arr, (size_t)i, &val) == 0 && val == expected[i]);
+    }
+    assert(gap_array_find(arr, 4) == 3);
+    
+    gap_array_move_cursor(arr, 0);
+    assert(gap_array_cursor_backspace(arr, NULL) == -1);
+    gap_array_move_cursor(arr, 5);
+    assert(gap_array_cursor_delete(arr, NULL) == -1);
+    
+    gap_array_destroy(arr);
+    PASS();
+    return 0;
+}
+
+int test_matches_dynamic_array(void) {
+    TEST("random edits match DynamicArray");
+    
+    GapArray *gap = gap_array_create(1);
+    DynamicArray *ref = array_create(1);
+    srand(7);
+    
+    for (int step = 0; step < 5000; step++) {
+        size_t size = array_size(ref);
+        int op = rand() % 4;
+        if (op < 2 || size == 0) {
+            size_t idx = (size_t)rand() % (size + 1);
+            assert(gap_array_insert(gap, idx, step) == 0);
+            assert(array_insert(ref, idx, step) == 0);
+        } else if (op == 2) {
+            size_t idx = (size_t)rand() % size;
+            int a, b;
+            assert(gap_array_remove(gap, idx, &a) == 0);
+            assert(array_remove(ref, idx, &b) == 0);
+            assert(a == b);
+        } else {
+            size_t idx = (size_t)rand() % size;
+            assert(gap_array_set(gap, idx, -step) == 0);
+            assert(array_set(ref, idx, -step) == 0);
+        }
+    }
+    _assert_matches(gap, ref);
+    
+    assert(gap_array_insert(gap, array_size(ref) + 1, 0) == -1);
+    assert(gap_array_remove(gap, array_size(ref), NULL) == -1);
+    
+    array_destroy(ref);
+    gap_array_destroy(gap);
+    PASS();
+    return 0;
+}
+
+int test_growth_keeps_tail(void) {
+    TEST("growth with elements after the cursor");
+    
+    GapArray *arr = gap_array_create(4);
+    GrowthPolicy policy = growth_policy_default();
+    policy.kind = GROWTH_FIXED;
+    policy.increment = 3;
+    assert(gap_array_set_growth_policy(arr, policy) == 0);
+    policy.increment = 0;
+    assert(gap_array_set_growth_policy(arr, policy) == -1);
+    
+    for (int i = 0; i < 4; i++) {
+        gap_array_push(arr, 100 + i);
+    }
+    gap_array_move_cursor(arr, 1);
+    for (int i = 0; i < 20; i++) {
+        assert(gap_array_cursor_insert(arr, i) == 0);
+    }
+    
+    int val;
+    assert(gap_array_size(arr) == 24);
+    assert(gap_array_get(arr, 0, &val) == 0 && val == 100);
+    assert(gap_array_get(arr, 20, &val) == 0 && val == 19);
+    assert(gap_array_get(arr, 21, &val) == 0 && val == 101);
+    assert(gap_array_get(arr, 23, &val) == 0 && val == 103);
+    
+    assert(gap_array_reserve(arr, 1000) == 0);
+    assert(gap_array_capacity(arr) >= 1000);
+    assert(gap_array_get(arr, 23, &val) == 0 && val == 103);
+    
+    gap_array_destroy(arr);
+    PASS();
+    return 0;
+}
+
+int main(void) {
+    printf("=== Running Gap Array Tests ===\n\n");
+    
+    int failed = 0;
+    
+    failed += test_create_destroy();
+    failed += test_push_pop_get_set();
+    failed += test_cursor_editing();
+    failed += test_matches_dynamic_array();
+    failed += test_growth_keeps_tail();
+    
+    printf("\n");
+    if (failed == 0) {
+        printf("✓ All tests passed!\n");
+    } else {
+        printf("✗ %d test(s) failed\n", failed);
+    }
+    
+    return failed;
+}
@@ -0,0 +1,154 @@
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+#include "../include/growth.h"
+
+#define TEST(name) printf("Testing %s... ", name)
+#define PASS() printf("✓ PASS\n")
+
+int test_default_policy(void) {
+    TEST("default policy");
+    
+    GrowthPolicy policy = growth_policy_default();
+    assert(policy.kind == GROWTH_DOUBLE);
+    assert(policy.mmap_threshold == GROWTH_DEFAULT_MMAP_THRESHOLD);
+    assert(growth_policy_validate(&policy) == 0);
+    assert(growth_policy_validate(NULL) == -1);
+    
+    assert(growth_next_capacity(&policy, 16, 17, sizeof(int)) == 32);
+    assert(growth_next_capacity(&policy, 16, 100, sizeof(int)) == 128);
+    assert(growth_next_capacity(&policy, 0, 1, sizeof(int)) == 1);
+    assert(growth_next_capacity(NULL, 2, 3, sizeof(int)) == 4);
+    
+    PASS();
+    return 0;
+}
+
+int test_half_policy(void) {
+    TEST("1.5x policy");
+    
+    GrowthPolicy policy = growth_policy_default();
+    policy.kind = GROWTH_HALF;
+    
+    assert(growth_next_capacity(&policy, 16, 17, sizeof(int)) == 24);
+    assert(growth_next_capacity(&policy, 1, 2, sizeof(int)) == 2);
+    assert(growth_next_capacity(&policy, 2, 3, sizeof(int)) == 3);
+    assert(growth_next_capacity(&policy, 100, 200, sizeof(int)) == 225);
+    
+    PASS();
+    return 0;
+}
+
+int test_fixed_policy(void) {
+    TEST("fixed increment policy");
+    
+    GrowthPolicy policy = growth_policy_default();
+    policy.kind = GROWTH_FIXED;
+    policy.increment = 0;
+    assert(growth_policy_validate(&policy) == -1);
+    
+    policy.increment = 100;
+    assert(growth_policy_validate(&policy) == 0);
+    assert(growth_next_capacity(&policy, 16, 17, sizeof(int)) == 116);
+    assert(growth_next_capacity(&policy, 16, 1000, sizeof(int)) == 1016);
+    
+    PASS();
+    return 0;
+}
+
+int test_page_aligned_policy(void) {
+    TEST("page-aligned policy");
+    
+    GrowthPolicy policy = growth_policy_default();
+    policy.kind = GROWTH_PAGE_ALIGNED;
+    size_t page = growth_page_size();
+    
+    size_t cap = growth_next_capacity(&policy, 16, 17, sizeof(int));
+    assert(cap >= 32);
+    assert((cap * sizeof(int)) % page == 0);
+    
+    cap = growth_next_capacity(&policy, cap, cap + 1, sizeof(int));
+    assert((cap * sizeof(int)) % page == 0);
+    
+    PASS();
+    return 0;
+}
+
+int test_overflow(void) {
+    TEST("overflow detection");
+    
+    GrowthPolicy policy = growth_policy_default();
+    size_t max_elems = (size_t)-1 / sizeof(int);
+    
+    assert(growth_next_capacity(&policy, 16, max_elems + 1, sizeof(int)) == 0);
+    assert(growth_next_capacity(&policy, max_elems - 1, max_elems,
+                                sizeof(int)) == max_elems);
+    
+    PASS();
+    return 0;
+}
+
+int test_realloc_heap_and_mapped(void) {
+    TEST("realloc across heap and mmap");
+    
+    GrowthPolicy policy = growth_policy_default();
+    policy.mmap_threshold = 64 * 1024;
+    GrowthStorage storage = GROWTH_STORAGE_HEAP;
+    
+    size_t capacity = 16;
+    int *data = growth_realloc(NULL, sizeof(int), 0, &capacity, &storage,
+                               &policy);
+    assert(data != NULL);
+    assert(capacity == 16);
+    assert(storage == GROWTH_STORAGE_HEAP);
+    for (int i = 0; i < 16; i++) {
+        data[i] = i;
+    }
+    
+    size_t old_capacity = capacity;
+    capacity = 1 << 20;
+    data = growth_realloc(data, sizeof(int), old_capacity, &capacity,
+                          &storage, &policy);
+    assert(data != NULL);
+    assert(capacity >= (1 << 20));
+    for (int i = 0; i < 16; i++) {
+        assert(data[i] == i);
+    }
+    data[capacity - 1] = 42;
+    
+    old_capacity = capacity;
+    capacity = 1 << 22;
+    data = growth_realloc(data, sizeof(int), old_capacity, &capacity,
+                          &storage, &policy);
+    assert(data != NULL);
+    assert(data[15] == 15);
+    assert(data[old_capacity - 1] == 42);
+    
+    growth_free(data, sizeof(int), capacity, storage);
+    growth_free(NULL, sizeof(int), 0, GROWTH_STORAGE_HEAP);
+    
+    PASS();
+    return 0;
+}
+
+int main(void) {
+    printf("=== Running Growth Policy Tests ===\n\n");
+    
+    int failed = 0;
+    
+    failed += test_default_policy();
+    failed += test_half_policy();
+    failed += test_fixed_policy();
+    failed += test_page_aligned_policy();
+    failed += test_overflow();
+    failed += test_realloc_heap_and_mapped();
+    
+    printf("\n");
+    if (failed == 0) {
+        printf("✓ All tests passed!\n");
+    } else {
+        printf("✗ %d test(s) failed\n", failed);
+    }
+    
+    return failed;
+}
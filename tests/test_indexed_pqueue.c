@@ -0,0 +1,205 @@
+#include <stdio.h>
+#include <assert.h>
+#include <stdlib.h>
+#include <limits.h>
+#include "../include/indexed_pqueue.h"
+
+#define TEST(name) printf("Testing %s... ", name)
+#define PASS() printf("✓ PASS\n")
+
+#define ID_SPACE 500
+
+int test_create_destroy(void) {
+    TEST("create and destroy");
+    
+    IndexedPQ *pq = ipqueue_create(10);
+    assert(pq != NULL);
+    assert(ipqueue_size(pq) == 0);
+    assert(ipqueue_is_empty(pq) == 1);
+    assert(ipqueue_max_ids(pq) == 10);
+    
+    size_t id;
+    int prio;
+    assert(ipqueue_pop(pq, &id, &prio) == -1);
+    assert(ipqueue_peek(pq, &id, &prio) == -1);
+    assert(ipqueue_remove(pq, 3, NULL) == -1);
+    assert(ipqueue_decrease_key(pq, 3, 0) == -1);
+    ipqueue_destroy(pq);
+    ipqueue_destroy(NULL);
+    
+    assert(ipqueue_create(0) == NULL);
+    assert(ipqueue_size(NULL) == 0);
+    assert(ipqueue_is_empty(NULL) == 1);
+    assert(ipqueue_push(NULL, 0, 1) == -1);
+    assert(ipqueue_contains(NULL, 0) == 0);
+    
+    PASS();
+    return 0;
+}
+
+int test_push_pop(void) {
+    TEST("push, pop and duplicate ids");
+    
+    IndexedPQ *pq = ipqueue_create(8);
+    assert(ipqueue_push(pq, 3, 30) == 0);
+    assert(ipqueue_push(pq, 1, 10) == 0);
+    assert(ipqueue_push(pq, 7, 5) == 0);
+    assert(ipqueue_push(pq, 0, 20) == 0);
+    assert(ipqueue_push(pq, 3, 1) == -1);
+    assert(ipqueue_push(pq, 8, 1) == -1);
+    assert(ipqueue_size(pq) == 4);
+    
+    size_t id;
+    int prio;
+    assert(ipqueue_peek(pq, &id, &prio) == 0 && id == 7 && prio == 5);
+    assert(ipqueue_contains(pq, 7) == 1);
+    assert(ipqueue_contains(pq, 2) == 0);
+    assert(ipqueue_contains(pq, 100) == 0);
+    
+    size_t expected_ids[] = {7, 1, 0, 3};
+    int expected_prios[] = {5, 10, 20, 30};
+    for (int i = 0; i < 4; i++) {
+        assert(ipqueue_pop(pq, &id, &prio) == 0);
+        assert(id == expected_ids[i] && prio == expected_prios[i]);
+        assert(ipqueue_contains(pq, id) == 0);
+    }
+    assert(ipqueue_is_empty(pq));
+    
+    // Popped ids can be queued again
+    assert(ipqueue_push(pq, 7, 1) == 0);
+    assert(ipqueue_priority(pq, 7, &prio) == 0 && prio == 1);
+    ipqueue_destroy(pq);
+    
+    PASS();
+    return 0;
+}
+
+int test_change_key_remove(void) {
+    TEST("decrease_key, increase_key and remove");
+    
+    IndexedPQ *pq = ipqueue_create(16);
+    for (size_t i = 0; i < 16; i++) {
+        assert(ipqueue_push(pq, i, 100 + (int)i) == 0);
+    }
+    
+    size_t id;
+    int prio;
+    assert(ipqueue_decrease_key(pq, 12, 50) == 0);
+    assert(ipqueue_peek(pq, &id, &prio) == 0 && id == 12 && prio == 50);
+    assert(ipqueue_decrease_key(pq, 12, 60) == -1);
+    assert(ipqueue_increase_key(pq, 12, 40) == -1);
+    
+    assert(ipqueue_increase_key(pq, 12, 200) == 0);
+    assert(ipqueue_peek(pq, &id, &prio) == 0 && id == 0 && prio == 100);
+    assert(ipqueue_increase_key(pq, 0, 150) == 0);
+    assert(ipqueue_peek(pq, &id, NULL) == 0 && id == 1);
+    
+    assert(ipqueue_remove(pq, 1, &prio) == 0 && prio == 101);
+    assert(ipqueue_remove(pq, 1, NULL) == -1);
+    assert(ipqueue_contains(pq, 1) == 0);
+    assert(ipqueue_size(pq) == 15);
+    
+    int last = INT_MIN;
+    while (ipqueue_pop(pq, &id, &prio) == 0) {
+        assert(prio >= last);
+        last = prio;
+    }
+    assert(last == 200 && id == 12);
+    
+    for (size_t i = 0; i < 16; i++) {
+        ipqueue_push(pq, i, (int)i);
+    }
+    ipqueue_clear(pq);
+    assert(ipqueue_is_empty(pq));
+    for (size_t i = 0; i < 16; i++) {
+        assert(ipqueue_contains(pq, i) == 0);
+    }
+    assert(ipqueue_push(pq, 5, 5) == 0);
+    ipqueue_destroy(pq);
+    
+    PASS();
+    return 0;
+}
+
+int test_matches_reference(void) {
+    TEST("random operations against a reference array");
+    
+    IndexedPQ *pq = ipqueue_create(ID_SPACE);
+    int present[ID_SPACE] = {0};
+    int prios[ID_SPACE] = {0};
+    
+    srand(12345);
+    for (int step = 0; step < 50000; step++) {
+        size_t id = (size_t)(rand() % ID_SPACE);
+        int prio = rand() % 10000 - 5000;
+        int op = rand() % 5;
+        
+        if (op == 0) {
+            assert(ipqueue_push(pq, id, prio) == (present[id] ? -1 : 0));
+            if (!present[id]) {
+                present[id] = 1;
+                prios[id] = prio;
+            }
+        } else if (op == 1) {
+            int ok = present[id] && prio <= prios[id];
+            assert(ipqueue_decrease_key(pq, id, prio) == (ok ? 0 : -1));
+            if (ok) {
+                prios[id] = prio;
+            }
+        } else if (op == 2) {
+            int ok = present[id] && prio >= prios[id];
+            assert(ipqueue_increase_key(pq, id, prio) == (ok ? 0 : -1));
+            if (ok) {
+                prios[id] = prio;
+            }
+        } else if (op == 3) {
+            int got;
+            assert(ipqueue_remove(pq, id, &got) == (present[id] ? 0 : -1));
+            if (present[id]) {
+                assert(got == prios[id]);
+                present[id] = 0;
+            }
+        } else {
+            size_t top;
+            int got;
+            if (ipqueue_pop(pq, &top, &got) == 0) {
+                assert(present[top] && prios[top] == got);
+                for (size_t i = 0; i < ID_SPACE; i++) {
+                    assert(!present[i] || prios[i] >= got);
+                }
+                present[top] = 0;
+            }
+        }
+    }
+    
+    size_t count = 0;
+    for (size_t i = 0; i < ID_SPACE; i++) {
+        assert(ipqueue_contains(pq, i) == present[i]);
+        count += (size_t)present[i];
+    }
+    assert(ipqueue_size(pq) == count);
+    
+    ipqueue_destroy(pq);
+    PASS();
+    return 0;
+}
+
+int main(void) {
+    printf("=== Running Indexed Priority Queue Tests ===\n\n");
+    
+    int failed = 0;
+    
+    failed += test_create_destroy();
+    failed += test_push_pop();
+    failed += test_change_key_remove();
+    failed += test_matches_reference();
+    
+    printf("\n");
+    if (failed == 0) {
+        printf("✓ All tests passed!\n");
+    } else {
+        printf("✗ %d test(s) failed\n", failed);
+    }
+    
+    return failed;
+}
@@ -0,0 +1,189 @@
+#include <stdio.h>
+#include <assert.h>
+#include "../include/intrusive_list.h"
+
+#define TEST(name) printf("Testing %s... ", name)
+#define PASS() printf("✓ PASS\n")
+
+typedef struct Task {
+    int id;
+    IListLink by_owner;
+    IListLink by_priority;
+} Task;
+
+static void _number_tasks(Task *tasks, int n) {
+    for (int i = 0; i < n; i++) {
+        tasks[i].id = i;
+    }
+}
+
+static int _id_at(const IList *list, size_t index) {
+    IListLink *link = ilist_front(list);
+    for (size_t i = 0; i < index; i++) {
+        link = ilist_next(link);
+    }
+    return ILIST_ENTRY(link, Task, by_owner)->id;
+}
+
+int test_init_empty(void) {
+    TEST("init and empty list");
+    
+    IList list = ILIST_INIT;
+    assert(ilist_size(&list) == 0);
+    assert(ilist_is_empty(&list) == 1);
+    assert(ilist_front(&list) == NULL);
+    assert(ilist_back(&list) == NULL);
+    assert(ilist_pop_front(&list) == NULL);
+    assert(ilist_pop_back(&list) == NULL);
+    
+    ilist_init(&list);
+    assert(ilist_is_empty(&list) == 1);
+    
+    assert(ilist_size(NULL) == 0);
+    assert(ilist_is_empty(NULL) == 1);
+    assert(ilist_push_back(NULL, NULL) == -1);
+    assert(ilist_push_front(&list, NULL) == -1);
+    assert(ilist_remove(&list, NULL) == -1);
+    
+    PASS();
+    return 0;
+}
+
+int test_push_pop(void) {
+    TEST("push and pop at both ends");
+    
+    Task tasks[4];
+    _number_tasks(tasks, 4);
+    IList list = ILIST_INIT;
+    
+    assert(ilist_push_back(&list, &tasks[1].by_owner) == 0);
+    assert(ilist_push_back(&list, &tasks[2].by_owner) == 0);
+    assert(ilist_push_front(&list, &tasks[0].by_owner) == 0);
+    assert(ilist_push_back(&list, &tasks[3].by_owner) == 0);
+    assert(ilist_size(&list) == 4);
+    for (int i = 0; i < 4; i++) {
+        assert(_id_at(&list, (size_t)i) == i);
+    }
+    
+    IListLink *link = ilist_pop_front(&list);
+    assert(ILIST_ENTRY(link, Task, by_owner) == &tasks[0]);
+    link = ilist_pop_back(&list);
+    assert(ILIST_ENTRY(link, Task, by_owner) == &tasks[3]);
+    assert(ilist_size(&list) == 2);
+    assert(ilist_prev(ilist_front(&list)) == NULL);
+    assert(ilist_next(ilist_back(&list)) == NULL);
+    
+    PASS();
+    return 0;
+}
+
+int test_insert_remove(void) {
+    TEST("insert relative to a link and O(1) remove");
+    
+    Task tasks[5];
+    _number_tasks(tasks, 5);
+    IList list = ILIST_INIT;
+    
+    ilist_push_back(&list, &tasks[0].by_owner);
+    ilist_push_back(&list, &tasks[4].by_owner);
+    assert(ilist_insert_before(&list, &tasks[4].by_owner, &tasks[2].by_owner) == 0);
+    assert(ilist_insert_after(&list, &tasks[0].by_owner, &tasks[1].by_owner) == 0);
+    assert(ilist_insert_after(&list, &tasks[2].by_owner, &tasks[3].by_owner) == 0);
+    for (int i = 0; i < 5; i++) {
+        assert(_id_at(&list, (size_t)i) == i);
+    }
+    
+    assert(ilist_remove(&list, &tasks[2].by_owner) == 0);
+    assert(ilist_remove(&list, &tasks[0].by_owner) == 0);
+    assert(ilist_remove(&list, &tasks[4].by_owner) == 0);
+    assert(ilist_size(&list) == 2);
+    assert(_id_at(&list, 0) == 1 && _id_at(&list, 1) == 3);
+    
+    // NULL anchors mean "end": insert_after(NULL) prepends, insert_before(NULL) appends
+    ilist_insert_after(&list, NULL, &tasks[0].by_owner);
+    ilist_insert_before(&list, NULL, &tasks[4].by_owner);
+    assert(_id_at(&list, 0) == 0 && _id_at(&list, 3) == 4);
+    
+    PASS();
+    return 0;
+}
+
+int test_multiple_memberships(void) {
+    TEST("object on two lists at once");
+    
+    Task tasks[6];
+    IList owner = ILIST_INIT;
+    IList priority = ILIST_INIT;
+    for (int i = 0; i < 6; i++) {
+        tasks[i].id = i;
+        ilist_push_back(&owner, &tasks[i].by_owner);
+        ilist_push_front(&priority, &tasks[i].by_priority);
+    }
+    
+    // Leaving one list does not disturb the other
+    ilist_remove(&priority, &tasks[2].by_priority);
+    assert(ilist_size(&priority) == 5);
+    assert(ilist_size(&owner) == 6);
+    assert(_id_at(&owner, 2) == 2);
+    
+    int expected[] = {5, 4, 3, 1, 0};
+    int i = 0;
+    for (IListLink *l = ilist_front(&priority); l; l = ilist_next(l)) {
+        assert(ILIST_ENTRY(l, Task, by_priority)->id == expected[i++]);
+    }
+    assert(i == 5);
+    
+    PASS();
+    return 0;
+}
+
+int test_reverse_splice(void) {
+    TEST("reverse and splice");
+    
+    Task tasks[6];
+    _number_tasks(tasks, 6);
+    IList a = ILIST_INIT;
+    IList b = ILIST_INIT;
+    for (int i = 0; i < 3; i++) {
+        ilist_push_back(&a, &tasks[i].by_owner);
+        ilist_push_back(&b, &tasks[i + 3].by_owner);
+    }
+    
+    ilist_reverse(&a);
+    assert(_id_at(&a, 0) == 2 && _id_at(&a, 2) == 0);
+    assert(ILIST_ENTRY(ilist_back(&a), Task, by_owner)->id == 0);
+    ilist_reverse(&a);
+    
+    assert(ilist_splice(&a, &b) == 0);
+    assert(ilist_size(&a) == 6 && ilist_is_empty(&b) == 1);
+    for (int i = 0; i < 6; i++) {
+        assert(_id_at(&a, (size_t)i) == i);
+    }
+    assert(ilist_splice(&a, &a) == -1);
+    assert(ilist_splice(&b, &a) == 0);
+    assert(ilist_size(&b) == 6 && ILIST_ENTRY(ilist_back(&b), Task, by_owner)->id == 5);
+    
+    PASS();
+    return 0;
+}
+
+int main(void) {
+    printf("=== Running Intrusive List Tests ===\n\n");
+    
+    int failed = 0;
+    
+    failed += test_init_empty();
+    failed += test_push_pop();
+    failed += test_insert_remove();
+    failed += test_multiple_memberships();
+    failed += test_reverse_splice();
+    
+    printf("\n");
+    if (failed == 0) {
+        printf("✓ All tests passed!\n");
+    } else {
+        printf("✗ %d test(s) failed\n", failed);
+    }
+    
+    return failed;
+}
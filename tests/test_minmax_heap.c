@@ -0,0 +1,132 @@
+#include <stdio.h>
+#include <assert.h>
+#include <stdlib.h>
+#include <limits.h>
+#include "../include/minmax_heap.h"
+
+#define TEST(name) printf("Testing %s... ", name)
+#define PASS() printf("✓ PASS\n")
+
+#define VALUE_SPACE 1000
+
+int test_create_destroy(void) {
+    TEST("create and destroy");
+    
+    MinMaxHeap *heap = mmheap_create(0);
+    assert(heap != NULL);
+    assert(mmheap_size(heap) == 0);
+    assert(mmheap_is_empty(heap) == 1);
+    
+    int val;
+    assert(mmheap_pop_min(heap, &val) == -1);
+    assert(mmheap_pop_max(heap, &val) == -1);
+    assert(mmheap_peek_min(heap, &val) == -1);
+    assert(mmheap_peek_max(heap, &val) == -1);
+    mmheap_destroy(heap);
+    mmheap_destroy(NULL);
+    
+    assert(mmheap_size(NULL) == 0);
+    assert(mmheap_is_empty(NULL) == 1);
+    assert(mmheap_push(NULL, 1) == -1);
+    
+    PASS();
+    return 0;
+}
+
+int test_both_ends(void) {
+    TEST("min and max from both ends");
+    
+    MinMaxHeap *heap = mmheap_create(2);
+    int values[] = {5, INT_MIN, 9, 1, INT_MAX, 7, 3, 3, 0};
+    for (int i = 0; i < 9; i++) {
+        assert(mmheap_push(heap, values[i]) == 0);
+    }
+    
+    int val;
+    assert(mmheap_peek_min(heap, &val) == 0 && val == INT_MIN);
+    assert(mmheap_peek_max(heap, &val) == 0 && val == INT_MAX);
+    
+    assert(mmheap_pop_max(heap, &val) == 0 && val == INT_MAX);
+    assert(mmheap_pop_min(heap, &val) == 0 && val == INT_MIN);
+    assert(mmheap_pop_max(heap, &val) == 0 && val == 9);
+    assert(mmheap_pop_max(heap, &val) == 0 && val == 7);
+    assert(mmheap_pop_min(heap, &val) == 0 && val == 0);
+    assert(mmheap_pop_min(heap, &val) == 0 && val == 1);
+    assert(mmheap_pop_max(heap, &val) == 0 && val == 5);
+    assert(mmheap_pop_max(heap, &val) == 0 && val == 3);
+    assert(mmheap_pop_min(heap, &val) == 0 && val == 3);
+    assert(mmheap_is_empty(heap));
+    
+    mmheap_push(heap, 4);
+    assert(mmheap_peek_min(heap, &val) == 0 && val == 4);
+    assert(mmheap_peek_max(heap, &val) == 0 && val == 4);
+    mmheap_clear(heap);
+    assert(mmheap_is_empty(heap));
+    
+    mmheap_destroy(heap);
+    PASS();
+    return 0;
+}
+
+int test_matches_reference(void) {
+    TEST("random operations against a count table");
+    
+    MinMaxHeap *heap = mmheap_create(0);
+    int counts[VALUE_SPACE] = {0};
+    size_t size = 0;
+    
+    srand(4242);
+    for (int step = 0; step < 100000; step++) {
+        int op = rand() % 4;
+        int val;
+        if (op < 2) {
+            val = rand() % VALUE_SPACE;
+            assert(mmheap_push(heap, val) == 0);
+            counts[val]++;
+            size++;
+        } else if (size > 0) {
+            int lo = 0;
+            while (counts[lo] == 0) {
+                lo++;
+            }
+            int hi = VALUE_SPACE - 1;
+            while (counts[hi] == 0) {
+                hi--;
+            }
+            
+            assert(mmheap_peek_min(heap, &val) == 0 && val == lo);
+            assert(mmheap_peek_max(heap, &val) == 0 && val == hi);
+            if (op == 2) {
+                assert(mmheap_pop_min(heap, &val) == 0 && val == lo);
+            } else {
+                assert(mmheap_pop_max(heap, &val) == 0 && val == hi);
+            }
+            counts[val]--;
+            size--;
+        }
+        assert(mmheap_size(heap) == size);
+    }
+    
+    mmheap_destroy(heap);
+    PASS();
+    return 0;
+}
+
+int main(void) {
+    printf("=== Running Min-Max Heap Tests ===\n\n");
+    
+    int failed = 0;
+    
+    failed += test_create_destroy();
+    failed += test_both_ends();
+    failed += test_matches_reference();
+    
+    printf("\n");
+    if (failed == 0) {
+        printf("✓ All tests passed!\n");
+    } else {
+        printf("✗ %d test(s) failed\n", failed);
+    }
+    
+    return failed;
+}
@@ -0,0 +1,225 @@
+#include <stdio.h>
+#include <assert.h>
+#include <stdlib.h>
+#include "../include/pairing_heap.h"
+
+#define TEST(name) printf("Testing %s... ", name)
+#define PASS() printf("✓ PASS\n")
+
+#define SLOTS 256
+
+int test_create_destroy(void) {
+    TEST("create and destroy");
+    
+    PairingHeap *heap = pheap_create();
+    assert(heap != NULL);
+    assert(pheap_size(heap) == 0);
+    assert(pheap_is_empty(heap) == 1);
+    
+    int val;
+    assert(pheap_pop(heap, &val) == -1);
+    assert(pheap_peek(heap, &val) == -1);
+    pheap_destroy(heap);
+    pheap_destroy(NULL);
+    
+    assert(pheap_size(NULL) == 0);
+    assert(pheap_is_empty(NULL) == 1);
+    assert(pheap_push(NULL, 1) == NULL);
+    assert(pheap_meld(NULL, NULL) == -1);
+    
+    PASS();
+    return 0;
+}
+
+int test_push_pop(void) {
+    TEST("push and pop in order");
+    
+    PairingHeap *heap = pheap_create();
+    for (int i = 0; i < 2000; i++) {
+        assert(pheap_push(heap, (i * 7919) % 2000) != NULL);
+    }
+    assert(pheap_push(heap, 500) != NULL);
+    assert(pheap_size(heap) == 2001);
+    
+    int val;
+    assert(pheap_peek(heap, &val) == 0 && val == 0);
+    int prev = -1;
+    size_t popped = 0;
+    while (pheap_pop(heap, &val) == 0) {
+        assert(val >= prev);
+        prev = val;
+        popped++;
+    }
+    assert(popped == 2001);
+    assert(pheap_is_empty(heap) == 1);
+    
+    pheap_destroy(heap);
+    PASS();
+    return 0;
+}
+
+int test_decrease_key(void) {
+    TEST("decrease_key");
+    
+    PairingHeap *heap = pheap_create();
+    PHeapNode *nodes[100];
+    for (int i = 0; i < 100; i++) {
+        nodes[i] = pheap_push(heap, 1000 + i);
+    }
+    int val;
+    assert(pheap_pop(heap, &val) == 0 && val == 1000);
+    
+    assert(pheap_decrease_key(heap, nodes[50], 2000) == -1);
+    assert(pheap_decrease_key(heap, nodes[50], 5) == 0);
+    assert(pheap_node_value(nodes[50]) == 5);
+    assert(pheap_peek(heap, &val) == 0 && val == 5);
+    
+    assert(pheap_decrease_key(heap, nodes[50], 3) == 0);
+    assert(pheap_decrease_key(heap, nodes[99], 4) == 0);
+    assert(pheap_decrease_key(heap, nodes[98], 4) == 0);
+    
+    int expected[] = {3, 4, 4, 1001, 1002};
+    for (int i = 0; i < 5; i++) {
+        assert(pheap_pop(heap, &val) == 0 && val == expected[i]);
+    }
+    assert(pheap_size(heap) == 94);
+    
+    pheap_clear(heap);
+    assert(pheap_is_empty(heap) == 1);
+    assert(pheap_push(heap, 9) != NULL);
+    assert(pheap_pop(heap, &val) == 0 && val == 9);
+    
+    pheap_destroy(heap);
+    PASS();
+    return 0;
+}
+
+int test_meld(void) {
+    TEST("meld");
+    
+    PairingHeap *a = pheap_create();
+    PairingHeap *b = pheap_create();
+    PHeapNode *from_b = NULL;
+    for (int i = 0; i < 600; i++) {
+        pheap_push(a, 2 * i);
+        PHeapNode *node = pheap_push(b, 2 * i + 1);
+        if (i == 300) {
+            from_b = node;
+        }
+    }
+    assert(pheap_meld(a, a) == -1);
+    
+    assert(pheap_meld(a, b) == 0);
+    assert(pheap_size(a) == 1200);
+    
+    // Handles from the consumed heap keep working
+    assert(pheap_decrease_key(a, from_b, -1) == 0);
+    int val;
+    assert(pheap_pop(a, &val) == 0 && val == -1);
+    for (int i = 0; i < 1199; i++) {
+        int want = i < 601 ? i : i + 1;
+        assert(pheap_pop(a, &val) == 0 && val == want);
+    }
+    
+    // Melding into an empty heap, and melding an empty heap
+    PairingHeap *c = pheap_create();
+    pheap_push(c, 42);
+    assert(pheap_meld(a, c) == 0);
+    assert(pheap_meld(a, pheap_create()) == 0);
+    assert(pheap_size(a) == 1);
+    assert(pheap_pop(a, &val) == 0 && val == 42);
+    
+    pheap_destroy(a);
+    PASS();
+    return 0;
+}
+
+int test_matches_reference(void) {
+    TEST("random operations against a reference array");
+    
+    // Values are key * SLOTS + slot, so every queued value is unique and
+    // a popped value names exactly one handle
+    PairingHeap *heap = pheap_create();
+    PairingHeap *side = pheap_create();
+    PHeapNode *handles[SLOTS] = {0};
+    int values[SLOTS] = {0};
+    int in_side[SLOTS] = {0};
+    
+    srand(4242);
+    for (int step = 0; step < 60000; step++) {
+        int slot = rand() % SLOTS;
+        int key = rand() % 20000 - 10000;
+        int op = rand() % 6;
+        
+        if (op <= 1 && !handles[slot]) {
+            values[slot] = key * SLOTS + slot;
+            in_side[slot] = op == 1;
+            handles[slot] = pheap_push(op == 0 ? heap : side, values[slot]);
+            assert(handles[slot] != NULL);
+        } else if (op == 2 && handles[slot]) {
+            int value = key * SLOTS + slot;
+            int ok = value <= values[slot];
+            PairingHeap *owner = in_side[slot] ? side : heap;
+            assert(pheap_decrease_key(owner, handles[slot], value) == (ok ? 0 : -1));
+            if (ok) {
+                values[slot] = value;
+            }
+        } else if (op == 3) {
+            assert(pheap_meld(heap, side) == 0);
+            side = pheap_create();
+            for (int s = 0; s < SLOTS; s++) {
+                in_side[s] = 0;
+            }
+        } else if (op >= 4) {
+            int got;
+            if (pheap_pop(heap, &got) == 0) {
+                int s = ((got % SLOTS) + SLOTS) % SLOTS;
+                assert(handles[s] && values[s] == got);
+                for (int t = 0; t < SLOTS; t++) {
+                    assert(!handles[t] || in_side[t] || values[t] >= got);
+                }
+                handles[s] = NULL;
+            }
+        }
+    }
+    
+    assert(pheap_meld(heap, side) == 0);
+    size_t count = 0;
+    for (int s = 0; s < SLOTS; s++) {
+        count += handles[s] != NULL;
+    }
+    assert(pheap_size(heap) == count);
+    
+    int prev, got;
+    if (pheap_pop(heap, &prev) == 0) {
+        while (pheap_pop(heap, &got) == 0) {
+            assert(got > prev);
+            prev = got;
+        }
+    }
+    
+    pheap_destroy(heap);
+    PASS();
+    return 0;
+}
+
+int main(void) {
+    printf("=== Running Pairing Heap Tests ===\n\n");
+    
+    int failed = 0;
+    
+    failed += test_create_destroy();
+    failed += test_push_pop();
+    failed += test_decrease_key();
+    failed += test_meld();
+    failed += test_matches_reference();
+    
+    printf("\n");
+    if (failed == 0) {
+        printf("✓ All tests passed!\n");
+    } else {
+        printf("✗ %d test(s) failed\n", failed);
+    }
+    
+    return failed;
+}
@@ -1,5 +1,8 @@
 #include <stdio.h>
 #include <assert.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <limits.h>
 #include "../include/priority_queue.h"
 
 #define TEST(name) printf("Testing %s... ", name)
@@ -269,6 +272,311 @@ int test_negative_values(void) {
     return 0;
 }
 
+int test_growth_policy(void) {
+    TEST("growth policy");
+    
+    PriorityQueue *pq = pqueue_create(2);
+    GrowthPolicy policy = growth_policy_default();
+    policy.kind = GROWTH_HALF;
+    policy.mmap_threshold = 4096;
+    assert(pqueue_set_growth_policy(pq, policy) == 0);
+    
+    for (int i = 5000; i > 0; i--) {
+        assert(pqueue_push(pq, i) == 0);
+    }
+    
+    int val;
+    for (int i = 1; i <= 5000; i++) {
+        pqueue_pop(pq, &val);
+        assert(val == i);
+    }
+    
+    pqueue_destroy(pq);
+    PASS();
+    return 0;
+}
+
+static int _drain_sorted(PriorityQueue *pq, size_t expected_size) {
+    int prev = 0;
+    size_t count = 0;
+    int val;
+    while (pqueue_pop(pq, &val) == 0) {
+        if (count > 0 && val < prev) {
+            return 0;
+        }
+        prev = val;
+        count++;
+    }
+    return count == expected_size;
+}
+
+int test_arity(void) {
+    TEST("4-ary and 8-ary heaps");
+    
+    assert(pqueue_create_with_arity(8, 3) == NULL);
+    assert(pqueue_create_with_arity(8, 0) == NULL);
+    assert(pqueue_arity(NULL) == 0);
+    
+    PriorityQueue *binary = pqueue_create(8);
+    assert(pqueue_arity(binary) == 2);
+    pqueue_destroy(binary);
+    
+    unsigned arities[] = {2, 4, 8};
+    for (int a = 0; a < 3; a++) {
+        PriorityQueue *pq = pqueue_create_with_arity(2, arities[a]);
+        assert(pq != NULL);
+        assert(pqueue_arity(pq) == arities[a]);
+        assert(pqueue_capacity(pq) == 2);
+        
+        // Interleaved pushes and pops keep min order, including duplicates
+        srand(5);
+        int val;
+        size_t size = 0;
+        for (int i = 0; i < 5000; i++) {
+            if (rand() % 3 != 0) {
+                assert(pqueue_push(pq, rand() % 1000) == 0);
+                size++;
+            } else if (size > 0) {
+                assert(pqueue_peek(pq, &val) == 0);
+                int peeked = val;
+                assert(pqueue_pop(pq, &val) == 0 && val == peeked);
+                size--;
+            }
+        }
+        assert(pqueue_size(pq) == size);
+        assert(_drain_sorted(pq, size) == 1);
+        
+        for (int i = 100; i > 0; i--) {
+            pqueue_push(pq, i % 10 - 5);
+        }
+        assert(_drain_sorted(pq, 100) == 1);
+        pqueue_destroy(pq);
+    }
+    
+    PASS();
+    return 0;
+}
+
+int test_bulk(void) {
+    TEST("Floyd build, push_n and pop_n");
+    
+    int values[1000];
+    for (int i = 0; i < 1000; i++) {
+        values[i] = (i * 7919) % 1000 - 500;
+    }
+    
+    PriorityQueue *pq = pqueue_create_from_array(values, 1000);
+    assert(pq != NULL);
+    assert(pqueue_size(pq) == 1000);
+    assert(pqueue_arity(pq) == 2);
+    assert(_drain_sorted(pq, 1000) == 1);
+    pqueue_destroy(pq);
+    
+    pq = pqueue_create_from_array(NULL, 0);
+    assert(pq != NULL && pqueue_is_empty(pq));
+    pqueue_destroy(pq);
+    assert(pqueue_create_from_array(NULL, 5) == NULL);
+    
+    unsigned arities[] = {2, 4, 8};
+    for (size_t a = 0; a < 3; a++) {
+        // Large batch into an empty queue rebuilds; small batches sift up
+        pq = pqueue_create_with_arity(4, arities[a]);
+        assert(pqueue_push_n(pq, values, 600) == 0);
+        for (int i = 600; i < 1000; i += 8) {
+            assert(pqueue_push_n(pq, values + i, 8) == 0);
+        }
+        assert(pqueue_push_n(pq, values, 0) == 0);
+        assert(pqueue_size(pq) == 1000);
+        
+        int out[1000];
+        assert(pqueue_pop_n(pq, out, 1001) == -1);
+        assert(pqueue_size(pq) == 1000);
+        assert(pqueue_pop_n(pq, out, 10) == 0);
+        assert(out[0] == -500);
+        for (int i = 1; i < 10; i++) {
+            assert(out[i] >= out[i - 1]);
+        }
+        assert(pqueue_pop_n(pq, out + 10, 990) == 0);
+        for (int i = 1; i < 1000; i++) {
+            assert(out[i] >= out[i - 1]);
+        }
+        assert(out[999] == 499);
+        assert(pqueue_is_empty(pq));
+        pqueue_destroy(pq);
+    }
+    
+    assert(pqueue_push_n(NULL, values, 1) == -1);
+    assert(pqueue_pop_n(NULL, values, 0) == -1);
+    
+    PASS();
+    return 0;
+}
+
+int test_max_order(void) {
+    TEST("max-heap order");
+    
+    PriorityQueue *pq = pqueue_create_max(0);
+    assert(pq != NULL);
+    assert(pqueue_order(pq) == PQUEUE_MAX && pqueue_arity(pq) == 2);
+    
+    // Extreme values need no negation tricks
+    int values[] = {3, INT_MIN, 17, INT_MAX, -4, 0, 17};
+    for (int i = 0; i < 7; i++) {
+        assert(pqueue_push(pq, values[i]) == 0);
+    }
+    
+    int val;
+    int expected[] = {INT_MAX, 17, 17, 3, 0, -4, INT_MIN};
+    assert(pqueue_peek(pq, &val) == 0 && val == INT_MAX);
+    for (int i = 0; i < 7; i++) {
+        assert(pqueue_pop(pq, &val) == 0 && val == expected[i]);
+    }
+    pqueue_destroy(pq);
+    
+    assert(pqueue_create_with_order(4, 3, PQUEUE_MAX) == NULL);
+    assert(pqueue_create_with_order(4, 2, (PQueueOrder)7) == NULL);
+    assert(pqueue_order(NULL) == PQUEUE_MIN);
+    
+    int data[500];
+    for (int i = 0; i < 500; i++) {
+        data[i] = (i * 7919) % 500;
+    }
+    
+    unsigned arities[] = {2, 4, 8};
+    for (size_t a = 0; a < 3; a++) {
+        pq = pqueue_create_with_order(0, arities[a], PQUEUE_MAX);
+        assert(pqueue_push_n(pq, data, 300) == 0);
+        for (int i = 300; i < 500; i++) {
+            assert(pqueue_push(pq, data[i]) == 0);
+        }
+        
+        int out[500];
+        assert(pqueue_pop_n(pq, out, 500) == 0);
+        for (int i = 0; i < 500; i++) {
+            assert(out[i] == 499 - i);
+        }
+        pqueue_destroy(pq);
+    }
+    
+    PASS();
+    return 0;
+}
+
+int test_replace_top(void) {
+    TEST("replace_top");
+    
+    PriorityQueue *pq = pqueue_create(0);
+    int val;
+    assert(pqueue_replace_top(pq, 1, &val) == -1);
+    
+    for (int i = 10; i <= 50; i += 10) {
+        pqueue_push(pq, i);
+    }
+    assert(pqueue_replace_top(pq, 35, &val) == 0 && val == 10);
+    assert(pqueue_peek(pq, &val) == 0 && val == 20);
+    assert(pqueue_replace_top(pq, 5, NULL) == 0);
+    assert(pqueue_size(pq) == 5);
+    
+    int expected[] = {5, 30, 35, 40, 50};
+    for (int i = 0; i < 5; i++) {
+        assert(pqueue_pop(pq, &val) == 0 && val == expected[i]);
+    }
+    pqueue_destroy(pq);
+    
+    pq = pqueue_create_with_order(0, 4, PQUEUE_MAX);
+    for (int i = 0; i < 20; i++) {
+        pqueue_push(pq, i);
+    }
+    assert(pqueue_replace_top(pq, -1, &val) == 0 && val == 19);
+    assert(pqueue_peek(pq, &val) == 0 && val == 18);
+    pqueue_destroy(pq);
+    
+    PASS();
+    return 0;
+}
+
+int test_merge(void) {
+    TEST("merge");
+    
+    PriorityQueue *a = pqueue_create(0);
+    PriorityQueue *b = pqueue_create_with_order(0, 4, PQUEUE_MAX);
+    for (int i = 0; i < 500; i++) {
+        pqueue_push(a, (i * 37) % 500);
+        pqueue_push(b, 1000 - i);
+    }
+    assert(pqueue_merge(a, a) == -1);
+    assert(pqueue_merge(NULL, b) == -1);
+    
+    assert(pqueue_merge(a, b) == 0);
+    assert(pqueue_size(a) == 1000);
+    assert(pqueue_size(b) == 500);
+    
+    int prev, val;
+    assert(pqueue_pop(a, &prev) == 0 && prev == 0);
+    while (pqueue_pop(a, &val) == 0) {
+        assert(val >= prev);
+        prev = val;
+    }
+    assert(prev == 1000);
+    
+    // Small source: takes the sift-up path
+    PriorityQueue *small = pqueue_create(0);
+    pqueue_push(small, -5);
+    assert(pqueue_merge(b, small) == 0);
+    assert(pqueue_peek(b, &val) == 0 && val == 1000);
+    assert(pqueue_size(b) == 501);
+    
+    pqueue_destroy(a);
+    pqueue_destroy(b);
+    pqueue_destroy(small);
+    
+    PASS();
+    return 0;
+}
+
+int test_child_alignment(void) {
+    TEST("child groups aligned across regrowth");
+    
+    unsigned arities[] = {4, 8};
+    for (int a = 0; a < 2; a++) {
+        unsigned arity = arities[a];
+        size_t group = arity * sizeof(int);
+        // Odd-sized allocations in between shift where each regrowth lands
+        for (int round = 0; round < 8; round++) {
+            void *shift = malloc((size_t)(round * 12 + 4));
+            PriorityQueue *pq = pqueue_create_with_arity(1, arity);
+            size_t capacity = 0;
+            size_t regrowths = 0;
+            for (int i = 0; i < 5000; i++) {
+                assert(pqueue_push(pq, (i * 7919) % 5000) == 0);
+                if (pqueue_capacity(pq) == capacity) {
+                    continue;
+                }
+                // Check every internal node once per regrowth
+                capacity = pqueue_capacity(pq);
+                regrowths++;
+                const int *data = pqueue_data(pq);
+                size_t size = pqueue_size(pq);
+                for (size_t node = 0; arity * node + 1 < size; node++) {
+                    assert((uintptr_t)&data[arity * node + 1] % group == 0);
+                }
+            }
+            assert(regrowths > 3);
+            const int *data = pqueue_data(pq);
+            for (size_t node = 0; arity * node + 1 < pqueue_size(pq); node++) {
+                assert((uintptr_t)&data[arity * node + 1] % group == 0);
+            }
+            assert(pqueue_data(pq)[0] == 0);
+            pqueue_destroy(pq);
+            free(shift);
+        }
+    }
+    assert(pqueue_data(NULL) == NULL);
+    
+    PASS();
+    return 0;
+}
+
 int main(void) {
     printf("=== Running Priority Queue Tests ===\n\n");
     
@@ -285,6 +593,13 @@ int main(void) {
     failed += test_error_handling();
     failed += test_large_dataset();
     failed += test_negative_values();
+    failed += test_growth_policy();
+    failed += test_arity();
+    failed += test_bulk();
+    failed += test_max_order();
+    failed += test_replace_top();
+    failed += test_merge();
+    failed += test_child_alignment();
     
     printf("\n");
     if (failed == 0) {
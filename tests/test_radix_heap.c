@@ -0,0 +1,144 @@
+#include <stdio.h>
+#include <assert.h>
+#include <stdlib.h>
+#include <limits.h>
+#include "../include/radix_heap.h"
+#include "../include/priority_queue.h"
+
+#define TEST(name) printf("Testing %s... ", name)
+#define PASS() printf("✓ PASS\n")
+
+int test_create_destroy(void) {
+    TEST("create and destroy");
+    
+    RadixHeap *heap = radixheap_create();
+    assert(heap != NULL);
+    assert(radixheap_size(heap) == 0);
+    assert(radixheap_is_empty(heap) == 1);
+    
+    int val;
+    assert(radixheap_pop(heap, &val) == -1);
+    assert(radixheap_peek(heap, &val) == -1);
+    radixheap_destroy(heap);
+    radixheap_destroy(NULL);
+    
+    assert(radixheap_size(NULL) == 0);
+    assert(radixheap_is_empty(NULL) == 1);
+    assert(radixheap_push(NULL, 1) == -1);
+    
+    PASS();
+    return 0;
+}
+
+int test_monotone(void) {
+    TEST("monotone push/pop with int keys");
+    
+    RadixHeap *heap = radixheap_create();
+    int values[] = {50, INT_MIN, -3, 50, INT_MAX, 7};
+    for (int i = 0; i < 6; i++) {
+        assert(radixheap_push(heap, values[i]) == 0);
+    }
+    
+    int val;
+    assert(radixheap_peek(heap, &val) == 0 && val == INT_MIN);
+    assert(radixheap_pop(heap, &val) == 0 && val == INT_MIN);
+    assert(radixheap_peek(heap, &val) == 0 && val == -3);
+    assert(radixheap_pop(heap, &val) == 0 && val == -3);
+    
+    // Keys below the last popped one are rejected, equal ones accepted
+    assert(radixheap_push(heap, -4) == -1);
+    assert(radixheap_push(heap, -3) == 0);
+    assert(radixheap_pop(heap, &val) == 0 && val == -3);
+    
+    int expected[] = {7, 50, 50, INT_MAX};
+    for (int i = 0; i < 4; i++) {
+        assert(radixheap_pop(heap, &val) == 0 && val == expected[i]);
+    }
+    assert(radixheap_is_empty(heap));
+    
+    // Clearing resets the floor
+    radixheap_clear(heap);
+    assert(radixheap_push(heap, -100) == 0);
+    assert(radixheap_pop(heap, &val) == 0 && val == -100);
+    
+    radixheap_destroy(heap);
+    PASS();
+    return 0;
+}
+
+int test_u64_keys(void) {
+    TEST("uint64_t keys");
+    
+    RadixHeap *heap = radixheap_create();
+    uint64_t keys[] = {UINT64_MAX, 0, 1ULL << 40, 5, (1ULL << 40) + 1};
+    for (int i = 0; i < 5; i++) {
+        assert(radixheap_push_u64(heap, keys[i]) == 0);
+    }
+    
+    uint64_t key;
+    uint64_t expected[] = {0, 5, 1ULL << 40, (1ULL << 40) + 1, UINT64_MAX};
+    for (int i = 0; i < 5; i++) {
+        assert(radixheap_peek_u64(heap, &key) == 0 && key == expected[i]);
+        assert(radixheap_pop_u64(heap, &key) == 0 && key == expected[i]);
+    }
+    assert(radixheap_push_u64(heap, 7) == -1);
+    
+    radixheap_destroy(heap);
+    PASS();
+    return 0;
+}
+
+int test_matches_pqueue(void) {
+    TEST("event simulation against PriorityQueue");
+    
+    RadixHeap *heap = radixheap_create();
+    PriorityQueue *pq = pqueue_create(0);
+    
+    srand(31337);
+    for (int i = 0; i < 1000; i++) {
+        int t = rand() % 100000;
+        radixheap_push(heap, t);
+        pqueue_push(pq, t);
+    }
+    
+    // Each popped event schedules up to two later ones
+    for (int step = 0; step < 200000 && !pqueue_is_empty(pq); step++) {
+        int a, b;
+        assert(radixheap_pop(heap, &a) == 0);
+        assert(pqueue_pop(pq, &b) == 0);
+        assert(a == b);
+        
+        int spawn = rand() % 3 == 0 ? 2 : (step < 150000 ? 1 : 0);
+        for (int s = 0; s < spawn; s++) {
+            int t = a + rand() % 5000;
+            assert(radixheap_push(heap, t) == 0);
+            pqueue_push(pq, t);
+        }
+        assert(radixheap_size(heap) == pqueue_size(pq));
+    }
+    
+    radixheap_destroy(heap);
+    pqueue_destroy(pq);
+    PASS();
+    return 0;
+}
+
+int main(void) {
+    printf("=== Running Radix Heap Tests ===\n\n");
+    
+    int failed = 0;
+    
+    failed += test_create_destroy();
+    failed += test_monotone();
+    failed += test_u64_keys();
+    failed += test_matches_pqueue();
+    
+    printf("\n");
+    if (failed == 0) {
+        printf("✓ All tests passed!\n");
+    } else {
+        printf("✗ %d test(s) failed\n", failed);
+    }
+    
+    return failed;
+}
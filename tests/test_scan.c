@@ -0,0 +1,187 @@
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+#include <limits.h>
+#include "../include/scan.h"
+#include "../include/array.h"
+#include "../include/static_array.h"
+
+#define TEST(name) printf("Testing %s... ", name)
+#define PASS() printf("✓ PASS\n")
+
+int test_sum(void) {
+    TEST("sum with 64-bit accumulation");
+    
+    assert(scan_sum(NULL, 10) == 0);
+    
+    int small[] = {1, -2, 3, -4, 5, 6, 7};
+    assert(scan_sum(small, 0) == 0);
+    assert(scan_sum(small, 7) == 16);
+    assert(scan_sum(small, 3) == 2);
+    
+    int big[1000];
+    for (int i = 0; i < 1000; i++) {
+        big[i] = (i % 2 == 0) ? INT_MAX : INT_MIN + 1;
+    }
+    assert(scan_sum(big, 1000) == 0);
+    assert(scan_sum(big, 999) == (int64_t)INT_MAX);
+    
+    for (int i = 0; i < 1000; i++) {
+        big[i] = INT_MAX;
+    }
+    assert(scan_sum(big, 1000) == (int64_t)INT_MAX * 1000);
+    
+    PASS();
+    return 0;
+}
+
+int test_min_max(void) {
+    TEST("min/max/argmin/argmax");
+    
+    int value;
+    size_t idx;
+    assert(scan_min(NULL, 3, &value) == -1);
+    assert(scan_max((int[]){1}, 0, &value) == -1);
+    assert(scan_argmin((int[]){1}, 0, &idx) == -1);
+    
+    int one[] = {42};
+    assert(scan_min(one, 1, &value) == 0 && value == 42);
+    assert(scan_argmax(one, 1, &idx) == 0 && idx == 0);
+    
+    int data[37];
+    for (int i = 0; i < 37; i++) {
+        data[i] = (i * 17) % 37 - 18;
+    }
+    data[5] = INT_MIN;
+    data[29] = INT_MIN;
+    data[33] = INT_MAX;
+    data[36] = INT_MAX;
+    
+    assert(scan_min(data, 37, &value) == 0 && value == INT_MIN);
+    assert(scan_max(data, 37, &value) == 0 && value == INT_MAX);
+    assert(scan_argmin(data, 37, &idx) == 0 && idx == 5);
+    assert(scan_argmax(data, 37, &idx) == 0 && idx == 33);
+    
+    // Extremum in the scalar tail only
+    assert(scan_argmax(data, 35, &idx) == 0 && idx == 33);
+    assert(scan_max(data, 33, &value) == 0 && value < INT_MAX);
+    
+    PASS();
+    return 0;
+}
+
+int test_prefix_sums(void) {
+    TEST("inclusive/exclusive prefix sums");
+    
+    int in[23];
+    int64_t inc[23];
+    int64_t exc[23];
+    for (int i = 0; i < 23; i++) {
+        in[i] = (i % 3 == 0) ? INT_MAX : -i;
+    }
+    
+    assert(scan_prefix_sum_inclusive(NULL, inc, 3) == -1);
+    assert(scan_prefix_sum_exclusive(in, NULL, 3) == -1);
+    
+    for (size_t n = 0; n <= 23; n++) {
+        memset(inc, 0, sizeof(inc));
+        memset(exc, 0, sizeof(exc));
+        assert(scan_prefix_sum_inclusive(in, inc, n) == 0);
+        assert(scan_prefix_sum_exclusive(in, exc, n) == 0);
+        
+        int64_t running = 0;
+        for (size_t i = 0; i < n; i++) {
+            assert(exc[i] == running);
+            running += in[i];
+            assert(inc[i] == running);
+        }
+    }
+    
+    PASS();
+    return 0;
+}
+
+int test_histogram(void) {
+    TEST("histogram");
+    
+    uint64_t bins[8];
+    memset(bins, 0, sizeof(bins));
+    assert(scan_histogram(NULL, 4, 0, 8, bins) == 0);
+    assert(scan_histogram((int[]){1}, 1, 0, 0, bins) == 0);
+    
+    // Small input takes the direct path
+    int few[] = {-1, 0, 3, 3, 7, 8, INT_MIN, INT_MAX};
+    assert(scan_histogram(few, 8, 0, 8, bins) == 4);
+    assert(bins[0] == 1 && bins[3] == 2 && bins[7] == 1);
+    
+    // Large input takes the sub-histogram path and adds to existing counts
+    int many[1003];
+    uint64_t expect[8];
+    memcpy(expect, bins, sizeof(expect));
+    size_t expect_out = 0;
+    for (int i = 0; i < 1003; i++) {
+        many[i] = (i % 50 < 30) ? 5 : (i % 11) - 2;
+        int bin = many[i] + 2;
+        if (bin >= 0 && bin < 8) {
+            expect[bin]++;
+        } else {
+            expect_out++;
+        }
+    }
+    assert(scan_histogram(many, 1003, -2, 8, bins) == expect_out);
+    assert(memcmp(bins, expect, sizeof(bins)) == 0);
+    
+    PASS();
+    return 0;
+}
+
+int test_container_spans(void) {
+    TEST("kernels on container data");
+    
+    DynamicArray *arr = array_create(4);
+    assert(array_data(NULL) == NULL);
+    for (int i = 1; i <= 100; i++) {
+        array_push(arr, i);
+    }
+    assert(scan_sum(array_data(arr), array_size(arr)) == 5050);
+    
+    size_t idx;
+    assert(scan_argmax(array_data(arr), array_size(arr), &idx) == 0);
+    assert(idx == 99);
+    array_destroy(arr);
+    
+    StaticArray *sarr = static_array_create(10);
+    assert(static_array_data(NULL) == NULL);
+    for (size_t i = 0; i < 10; i++) {
+        static_array_set(sarr, i, (int)(10 - i));
+    }
+    int value;
+    assert(scan_min(static_array_data(sarr), static_array_capacity(sarr),
+                    &value) == 0);
+    assert(value == 1);
+    static_array_destroy(sarr);
+    
+    PASS();
+    return 0;
+}
+
+int main(void) {
+    printf("=== Running Scan Kernel Tests ===\n\n");
+    
+    int failed = 0;
+    
+    failed += test_sum();
+    failed += test_min_max();
+    failed += test_prefix_sums();
+    failed += test_histogram();
+    failed += test_container_spans();
+    
+    printf("\n");
+    if (failed == 0) {
+        printf("✓ All tests passed!\n");
+    } else {
+        printf("✗ %d test(s) failed\n", failed);
+    }
+    
+    return failed;
+}
@@ -0,0 +1,124 @@
+#include <stdio.h>
+#include <assert.h>
+#include "../include/seg_stack.h"
+
+#define TEST(name) printf("Testing %s... ", name)
+#define PASS() printf("✓ PASS\n")
+
+int test_create_destroy(void) {
+    TEST("create and destroy");
+    
+    SegStack *stack = seg_stack_create();
+    assert(stack != NULL);
+    assert(seg_stack_size(stack) == 0);
+    assert(seg_stack_is_empty(stack) == 1);
+    assert(seg_stack_chunk_size(stack) == 1024);
+    assert(seg_stack_chunk_count(stack) == 1);
+    seg_stack_destroy(stack);
+    seg_stack_destroy(NULL);
+    
+    stack = seg_stack_create_with_chunk_size(0);
+    assert(seg_stack_chunk_size(stack) == 1024);
+    seg_stack_destroy(stack);
+    
+    assert(seg_stack_size(NULL) == 0);
+    assert(seg_stack_is_empty(NULL) == 1);
+    
+    PASS();
+    return 0;
+}
+
+int test_push_pop_across_chunks(void) {
+    TEST("push/pop across chunks");
+    
+    SegStack *stack = seg_stack_create_with_chunk_size(4);
+    for (int i = 0; i < 100; i++) {
+        assert(seg_stack_push(stack, i) == 0);
+    }
+    assert(seg_stack_size(stack) == 100);
+    assert(seg_stack_chunk_count(stack) == 25);
+    
+    int val;
+    assert(seg_stack_peek(stack, &val) == 0 && val == 99);
+    for (int i = 99; i >= 0; i--) {
+        assert(seg_stack_pop(stack, &val) == 0);
+        assert(val == i);
+    }
+    assert(seg_stack_is_empty(stack) == 1);
+    assert(seg_stack_pop(stack, &val) == -1);
+    assert(seg_stack_peek(stack, &val) == -1);
+    assert(seg_stack_push(NULL, 1) == -1);
+    
+    // Bottom chunk plus one spare survive
+    assert(seg_stack_chunk_count(stack) == 2);
+    
+    seg_stack_destroy(stack);
+    PASS();
+    return 0;
+}
+
+int test_spare_chunk_at_boundary(void) {
+    TEST("spare chunk avoids boundary thrashing");
+    
+    SegStack *stack = seg_stack_create_with_chunk_size(8);
+    for (int i = 0; i < 8; i++) {
+        seg_stack_push(stack, i);
+    }
+    assert(seg_stack_chunk_count(stack) == 1);
+    
+    int val;
+    for (int round = 0; round < 1000; round++) {
+        assert(seg_stack_push(stack, round) == 0);
+        assert(seg_stack_chunk_count(stack) == 2);
+        assert(seg_stack_pop(stack, &val) == 0 && val == round);
+        assert(seg_stack_chunk_count(stack) == 2);
+    }
+    assert(seg_stack_peek(stack, &val) == 0 && val == 7);
+    
+    seg_stack_destroy(stack);
+    PASS();
+    return 0;
+}
+
+int test_clear(void) {
+    TEST("clear keeps one chunk and the spare");
+    
+    SegStack *stack = seg_stack_create_with_chunk_size(3);
+    for (int i = 0; i < 30; i++) {
+        seg_stack_push(stack, i);
+    }
+    seg_stack_clear(stack);
+    assert(seg_stack_is_empty(stack) == 1);
+    assert(seg_stack_chunk_count(stack) == 2);
+    
+    for (int i = 0; i < 5; i++) {
+        seg_stack_push(stack, i);
+    }
+    int val;
+    assert(seg_stack_pop(stack, &val) == 0 && val == 4);
+    assert(seg_stack_size(stack) == 4);
+    
+    seg_stack_destroy(stack);
+    PASS();
+    return 0;
+}
+
+int main(void) {
+    printf("=== Running Segmented Stack Tests ===\n\n");
+    
+    int failed = 0;
+    
+    failed += test_create_destroy();
+    failed += test_push_pop_across_chunks();
+    failed += test_spare_chunk_at_boundary();
+    failed += test_clear();
+    
+    printf("\n");
+    if (failed == 0) {
+        printf("✓ All tests passed!\n");
+    } else {
+        printf("✗ %d test(s) failed\n", failed);
+    }
+    
+    return failed;
+}
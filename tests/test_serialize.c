@@ -0,0 +1,416 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <unistd.h>
+#include "../include/serialize.h"
+#include "../include/array.h"
+#include "../include/static_array.h"
+#include "../include/array2d.h"
+#include "../include/bitset.h"
+#include "../include/priority_queue.h"
+#include "../include/dyn_string.h"
+
+#define TEST(name) printf("Testing %s... ", name)
+#define PASS() printf("✓ PASS\n")
+
+static _Alignas(64) unsigned char buffer[1 << 16];
+
+static int _temp_fd(void) {
+    char path[] = "/tmp/test_serialize_XXXXXX";
+    int fd = mkstemp(path);
+    assert(fd >= 0);
+    unlink(path);
+    return fd;
+}
+
+// Rewinds fd and copies its contents into the aligned buffer
+static size_t _slurp(int fd) {
+    off_t end = lseek(fd, 0, SEEK_END);
+    assert(end > 0 && (size_t)end <= sizeof(buffer));
+    lseek(fd, 0, SEEK_SET);
+    assert(read(fd, buffer, (size_t)end) == end);
+    lseek(fd, 0, SEEK_SET);
+    return (size_t)end;
+}
+
+int test_header(void) {
+    TEST("header validation");
+    
+    SerialHeader header;
+    serial_header_init(&header, SERIAL_KIND_ARRAY, sizeof(int), 10);
+    assert(memcmp(header.magic, SERIAL_MAGIC, 4) == 0);
+    assert(header.count == 10);
+    assert(header.capacity == 10);
+    assert(serial_header_check(&header, SERIAL_KIND_ARRAY, sizeof(int)) == 0);
+    assert(serial_header_check(&header, SERIAL_KIND_BITSET, sizeof(int)) == -1);
+    assert(serial_header_check(&header, SERIAL_KIND_ARRAY, 8) == -1);
+    
+    header.version = 99;
+    assert(serial_header_check(&header, SERIAL_KIND_ARRAY, sizeof(int)) == -1);
+    
+    PASS();
+    return 0;
+}
+
+int test_dynamic_array(void) {
+    TEST("dynamic array save/load/view");
+    
+    DynamicArray *arr = array_create(4);
+    for (int i = 0; i < 100; i++) {
+        array_push(arr, i * i - 50);
+    }
+    
+    int fd = _temp_fd();
+    assert(array_save_fd(arr, fd) == 0);
+    size_t len = _slurp(fd);
+    assert(len == SERIAL_HEADER_SIZE + 100 * sizeof(int));
+    
+    DynamicArray *loaded = array_load_fd(fd);
+    assert(loaded != NULL);
+    assert(array_size(loaded) == 100);
+    
+    DynamicArray *view = array_view_from_buffer(buffer, len);
+    assert(view != NULL);
+    assert(array_size(view) == 100);
+    
+    int a, b, c;
+    for (size_t i = 0; i < 100; i++) {
+        array_get(arr, i, &a);
+        array_get(loaded, i, &b);
+        array_get(view, i, &c);
+        assert(a == b && b == c);
+    }
+    
+    // In-place edit writes through, growth copies out
+    array_set(view, 0, 12345);
+    assert(((int*)(buffer + SERIAL_HEADER_SIZE))[0] == 12345);
+    assert(array_push(view, 7) == 0);
+    array_set(view, 0, 1);
+    assert(((int*)(buffer + SERIAL_HEADER_SIZE))[0] == 12345);
+    array_get(view, 100, &a);
+    assert(a == 7);
+    
+    assert(array_view_from_buffer(buffer, len - 1) == NULL);
+    assert(array_view_from_buffer(buffer + 4, len - 4) == NULL);
+    
+    array_destroy(view);
+    array_destroy(loaded);
+    array_destroy(arr);
+    close(fd);
+    PASS();
+    return 0;
+}
+
+int test_static_array(void) {
+    TEST("static array save/load/view");
+    
+    StaticArray *arr = static_array_create(8);
+    for (size_t i = 0; i < 8; i++) {
+        static_array_set(arr, i, (int)i * 10);
+    }
+    
+    int fd = _temp_fd();
+    assert(static_array_save_fd(arr, fd) == 0);
+    size_t len = _slurp(fd);
+    
+    StaticArray *loaded = static_array_load_fd(fd);
+    StaticArray *view = static_array_view_from_buffer(buffer, len);
+    assert(loaded != NULL && view != NULL);
+    assert(static_array_capacity(loaded) == 8);
+    assert(static_array_capacity(view) == 8);
+    
+    int val;
+    static_array_get(loaded, 7, &val);
+    assert(val == 70);
+    static_array_get(view, 3, &val);
+    assert(val == 30);
+    
+    // Kind tag prevents loading as a different container
+    lseek(fd, 0, SEEK_SET);
+    assert(array_load_fd(fd) == NULL);
+    
+    static_array_destroy(view);
+    static_array_destroy(loaded);
+    static_array_destroy(arr);
+    close(fd);
+    PASS();
+    return 0;
+}
+
+int test_array2d(void) {
+    TEST("array2d save/load/view");
+    
+    Array2D *arr = array2d_create(3, 5);
+    for (size_t r = 0; r < 3; r++) {
+        for (size_t c = 0; c < 5; c++) {
+            array2d_set(arr, r, c, (int)(r * 100 + c));
+        }
+    }
+    
+    int fd = _temp_fd();
+    assert(array2d_save_fd(arr, fd) == 0);
+    size_t len = _slurp(fd);
+    
+    Array2D *loaded = array2d_load_fd(fd);
+    Array2D *view = array2d_view_from_buffer(buffer, len);
+    assert(loaded != NULL && view != NULL);
+    assert(array2d_rows(loaded) == 3 && array2d_cols(loaded) == 5);
+    assert(array2d_rows(view) == 3 && array2d_cols(view) == 5);
+    
+    int val;
+    array2d_get(loaded, 2, 4, &val);
+    assert(val == 204);
+    array2d_get(view, 1, 3, &val);
+    assert(val == 103);
+    
+    array2d_destroy(view);
+    array2d_destroy(loaded);
+    array2d_destroy(arr);
+    close(fd);
+    PASS();
+    return 0;
+}
+
+int test_bitset(void) {
+    TEST("bitset save/load/view");
+    
+    Bitset *bs = bitset_create(130);
+    bitset_set(bs, 0);
+    bitset_set(bs, 64);
+    bitset_set(bs, 129);
+    
+    int fd = _temp_fd();
+    assert(bitset_save_fd(bs, fd) == 0);
+    size_t len = _slurp(fd);
+    
+    Bitset *loaded = bitset_load_fd(fd);
+    Bitset *view = bitset_view_from_buffer(buffer, len);
+    assert(loaded != NULL && view != NULL);
+    assert(bitset_size(loaded) == 130);
+    assert(bitset_equals(bs, loaded) == 1);
+    assert(bitset_equals(bs, view) == 1);
+    assert(bitset_count(view) == 3);
+    
+    // Padding bits past num_bits must be clear
+    ((unsigned char*)buffer)[len - 1] = 0xFF;
+    assert(bitset_view_from_buffer(buffer, len) == NULL);
+    
+    bitset_destroy(view);
+    bitset_destroy(loaded);
+    bitset_destroy(bs);
+    close(fd);
+    PASS();
+    return 0;
+}
+
+int test_bitset_corrupt_header(void) {
+    TEST("bitset rejects corrupt headers");
+    
+    // dim near UINT64_MAX rounds up to zero words without a guard
+    uint64_t dims[] = {UINT64_MAX, UINT64_MAX - 62, 0};
+    uint64_t counts[] = {0, 0, 0};
+    for (int i = 0; i < 3; i++) {
+        SerialHeader header;
+        serial_header_init(&header, SERIAL_KIND_BITSET, sizeof(uint64_t),
+                           (size_t)counts[i]);
+        header.dim = dims[i];
+        
+        int fd = _temp_fd();
+        assert(serial_write(fd, &header, NULL) == 0);
+        size_t len = _slurp(fd);
+        
+        assert(bitset_load_fd(fd) == NULL);
+        assert(bitset_view_from_buffer(buffer, len) == NULL);
+        close(fd);
+    }
+    
+    // Word count that disagrees with dim
+    uint64_t words[2] = {1, 0};
+    SerialHeader header;
+    serial_header_init(&header, SERIAL_KIND_BITSET, sizeof(uint64_t), 2);
+    header.dim = 64;
+    int fd = _temp_fd();
+    assert(serial_write(fd, &header, words) == 0);
+    size_t len = _slurp(fd);
+    assert(bitset_load_fd(fd) == NULL);
+    assert(bitset_view_from_buffer(buffer, len) == NULL);
+    close(fd);
+    
+    PASS();
+    return 0;
+}
+
+int test_priority_queue(void) {
+    TEST("priority queue save/load/view");
+    
+    PriorityQueue *pq = pqueue_create(4);
+    int values[] = {42, 7, 19, 3, 88, 7, 1, 56};
+    for (size_t i = 0; i < 8; i++) {
+        pqueue_push(pq, values[i]);
+    }
+    
+    int fd = _temp_fd();
+    assert(pqueue_save_fd(pq, fd) == 0);
+    size_t len = _slurp(fd);
+    
+    PriorityQueue *loaded = pqueue_load_fd(fd);
+    PriorityQueue *view = pqueue_view_from_buffer(buffer, len);
+    assert(loaded != NULL && view != NULL);
+    
+    int a, b, c;
+    while (!pqueue_is_empty(pq)) {
+        pqueue_pop(pq, &a);
+        pqueue_pop(loaded, &b);
+        pqueue_pop(view, &c);
+        assert(a == b && b == c);
+    }
+    assert(pqueue_is_empty(loaded) && pqueue_is_empty(view));
+    
+    // A payload that violates heap order is rejected
+    _slurp(fd);
+    int *payload = (int*)(buffer + SERIAL_HEADER_SIZE);
+    payload[0] = 1000;
+    assert(pqueue_view_from_buffer(buffer, len) == NULL);
+    
+    pqueue_destroy(view);
+    pqueue_destroy(loaded);
+    pqueue_destroy(pq);
+    close(fd);
+    
+    // Arity round-trips through the header flags
+    pq = pqueue_create_with_arity(4, 4);
+    for (int i = 40; i > 0; i--) {
+        pqueue_push(pq, i);
+    }
+    fd = _temp_fd();
+    assert(pqueue_save_fd(pq, fd) == 0);
+    len = _slurp(fd);
+    loaded = pqueue_load_fd(fd);
+    view = pqueue_view_from_buffer(buffer, len);
+    assert(loaded != NULL && view != NULL);
+    assert(pqueue_arity(loaded) == 4 && pqueue_arity(view) == 4);
+    
+    // Growing the view copies it out into an owned buffer
+    assert(pqueue_push(view, 0) == 0);
+    assert(pqueue_pop(view, &c) == 0 && c == 0);
+    for (int i = 1; i <= 40; i++) {
+        pqueue_pop(loaded, &b);
+        pqueue_pop(view, &c);
+        assert(b == i && c == i);
+    }
+    
+    pqueue_destroy(view);
+    pqueue_destroy(loaded);
+    pqueue_destroy(pq);
+    close(fd);
+    
+    // So does max order, which also changes what counts as heap order
+    pq = pqueue_create_with_order(4, 8, PQUEUE_MAX);
+    for (int i = 1; i <= 40; i++) {
+        pqueue_push(pq, i);
+    }
+    fd = _temp_fd();
+    assert(pqueue_save_fd(pq, fd) == 0);
+    len = _slurp(fd);
+    loaded = pqueue_load_fd(fd);
+    view = pqueue_view_from_buffer(buffer, len);
+    assert(loaded != NULL && view != NULL);
+    assert(pqueue_order(loaded) == PQUEUE_MAX && pqueue_arity(loaded) == 8);
+    assert(pqueue_order(view) == PQUEUE_MAX && pqueue_arity(view) == 8);
+    for (int i = 40; i >= 1; i--) {
+        pqueue_pop(loaded, &b);
+        pqueue_pop(view, &c);
+        assert(b == i && c == i);
+    }
+    
+    pqueue_destroy(view);
+    pqueue_destroy(loaded);
+    pqueue_destroy(pq);
+    close(fd);
+    PASS();
+    return 0;
+}
+
+int test_string(void) {
+    TEST("string save/load/view");
+    
+    String *str = string_create_from("serialize me");
+    
+    int fd = _temp_fd();
+    assert(string_save_fd(str, fd) == 0);
+    size_t len = _slurp(fd);
+    
+    String *loaded = string_load_fd(fd);
+    String *view = string_view_from_buffer(buffer, len);
+    assert(loaded != NULL && view != NULL);
+    assert(string_equals(loaded, "serialize me") == 1);
+    assert(string_equals(view, "serialize me") == 1);
+    assert(string_cstr(view) == (const char*)buffer + SERIAL_HEADER_SIZE);
+    
+    assert(string_append(view, ", please") == 0);
+    assert(string_equals(view, "serialize me, please") == 1);
+    assert(strcmp((const char*)buffer + SERIAL_HEADER_SIZE, "serialize me") == 0);
+    
+    string_destroy(view);
+    string_destroy(loaded);
+    string_destroy(str);
+    close(fd);
+    PASS();
+    return 0;
+}
+
+int test_concatenated_stream(void) {
+    TEST("several containers in one stream");
+    
+    DynamicArray *arr = array_create(2);
+    array_push(arr, 1);
+    array_push(arr, 2);
+    String *str = string_create_from("tail");
+    
+    int fd = _temp_fd();
+    assert(array_save_fd(arr, fd) == 0);
+    assert(string_save_fd(str, fd) == 0);
+    lseek(fd, 0, SEEK_SET);
+    
+    DynamicArray *arr2 = array_load_fd(fd);
+    String *str2 = string_load_fd(fd);
+    assert(arr2 != NULL && str2 != NULL);
+    assert(array_size(arr2) == 2);
+    assert(string_equals(str2, "tail") == 1);
+    assert(string_load_fd(fd) == NULL);
+    
+    string_destroy(str2);
+    array_destroy(arr2);
+    string_destroy(str);
+    array_destroy(arr);
+    close(fd);
+    PASS();
+    return 0;
+}
+
+int main(void) {
+    printf("=== Running Serialization Tests ===\n\n");
+    
+    int failed = 0;
+    
+    failed += test_header();
+    failed += test_dynamic_array();
+    failed += test_static_array();
+    failed += test_array2d();
+    failed += test_bitset();
+    failed += test_bitset_corrupt_header();
+    failed += test_priority_queue();
+    failed += test_string();
+    failed += test_concatenated_stream();
+    
+    printf("\n");
+    if (failed == 0) {
+        printf("✓ All tests passed!\n");
+    } else {
+        printf("✗ %d test(s) failed\n", failed);
+    }
+    
+    return failed;
+}
@@ -1,5 +1,7 @@
 #include <stdio.h>
 #include <assert.h>
+#include <stdlib.h>
+#include <string.h>
 #include "../include/singly_linked_list.h"
 
 #define TEST(name) printf("Testing %s... ", name)
@@ -285,6 +287,225 @@ int test_error_handling(void) {
     return 0;
 }
 
+int test_indexed_access_after_mutation(void) {
+    TEST("indexed access stays correct across mutations");
+    
+    SinglyLinkedList *list = slist_create();
+    int ref[256];
+    size_t n = 0;
+    int val;
+    srand(11);
+    
+    for (int step = 0; step < 4000; step++) {
+        size_t i = n > 0 ? (size_t)rand() % n : 0;
+        switch (rand() % 8) {
+            case 0:
+                if (n < 256 && slist_push_front(list, step) == 0) {
+                    memmove(ref + 1, ref, n * sizeof(int));
+                    ref[0] = step;
+                    n++;
+                }
+                break;
+            case 1:
+                if (n < 256 && slist_push_back(list, step) == 0) {
+                    ref[n++] = step;
+                }
+                break;
+            case 2:
+                if (n > 0 && slist_pop_front(list, &val) == 0) {
+                    assert(val == ref[0]);
+                    memmove(ref, ref + 1, --n * sizeof(int));
+                }
+                break;
+            case 3:
+                if (n > 0 && slist_pop_back(list, &val) == 0) {
+                    assert(val == ref[--n]);
+                }
+                break;
+            case 4:
+                if (n > 0 && n < 256 && slist_insert_after(list, i, step) == 0) {
+                    memmove(ref + i + 2, ref + i + 1, (n - i - 1) * sizeof(int));
+                    ref[i + 1] = step;
+                    n++;
+                }
+                break;
+            case 5:
+                if (n > 0 && slist_remove_at(list, i, &val) == 0) {
+                    assert(val == ref[i]);
+                    memmove(ref + i, ref + i + 1, (n - i - 1) * sizeof(int));
+                    n--;
+                }
+                break;
+            case 6:
+                if (n > 0) {
+                    assert(slist_set(list, i, -step) == 0);
+                    ref[i] = -step;
+                }
+                break;
+            default:
+                slist_reverse(list);
+                for (size_t k = 0; k < n / 2; k++) {
+                    int tmp = ref[k];
+                    ref[k] = ref[n - 1 - k];
+                    ref[n - 1 - k] = tmp;
+                }
+                break;
+        }
+        
+        assert(slist_size(list) == n);
+        if (n > 0) {
+            assert(slist_get(list, i < n ? i : n - 1, &val) == 0);
+            assert(val == ref[i < n ? i : n - 1]);
+        }
+    }
+    
+    // Sequential scan in both directions, then random order
+    for (size_t k = 0; k < n; k++) {
+        assert(slist_get(list, k, &val) == 0 && val == ref[k]);
+    }
+    for (size_t k = n; k > 0; k--) {
+        assert(slist_get(list, k - 1, &val) == 0 && val == ref[k - 1]);
+    }
+    
+    slist_destroy(list);
+    PASS();
+    return 0;
+}
+
+int test_from_to_array(void) {
+    TEST("bulk construction and export");
+    
+    int values[] = {5, 3, 9, 1, 7};
+    SinglyLinkedList *list = slist_from_array(values, 5);
+    assert(list != NULL);
+    assert(slist_size(list) == 5);
+    
+    int out[8];
+    assert(slist_to_array(list, out) == 0);
+    assert(memcmp(out, values, sizeof(values)) == 0);
+    
+    // Slab nodes are recycled through pops and pushes
+    int val;
+    assert(slist_pop_front(list, &val) == 0 && val == 5);
+    assert(slist_remove_at(list, 1, &val) == 0 && val == 9);
+    assert(slist_push_front(list, 42) == 0);
+    assert(slist_push_back(list, 43) == 0);
+    assert(slist_push_back(list, 44) == 0);
+    int expected[] = {42, 3, 1, 7, 43, 44};
+    assert(slist_to_array(list, out) == 0);
+    assert(memcmp(out, expected, sizeof(expected)) == 0);
+    slist_destroy(list);
+    
+    list = slist_from_array(NULL, 0);
+    assert(list != NULL && slist_is_empty(list) == 1);
+    assert(slist_to_array(list, NULL) == 0);
+    slist_destroy(list);
+    assert(slist_from_array(NULL, 3) == NULL);
+    assert(slist_to_array(NULL, out) == -1);
+    
+    PASS();
+    return 0;
+}
+
+int test_sort(void) {
+    TEST("merge sort");
+    
+    SinglyLinkedList *list = slist_create();
+    slist_sort(list);
+    slist_push_back(list, 1);
+    slist_sort(list);
+    assert(slist_size(list) == 1);
+    slist_sort(NULL);
+    slist_destroy(list);
+    
+    int values[1000];
+    srand(3);
+    for (int i = 0; i < 1000; i++) {
+        values[i] = rand() % 200 - 100;
+    }
+    list = slist_from_array(values, 1000);
+    slist_sort(list);
+    assert(slist_size(list) == 1000);
+    
+    int out[1000];
+    slist_to_array(list, out);
+    long sum_in = 0;
+    long sum_out = 0;
+    for (int i = 0; i < 1000; i++) {
+        sum_in += values[i];
+        sum_out += out[i];
+        if (i > 0) {
+            assert(out[i - 1] <= out[i]);
+        }
+    }
+    assert(sum_in == sum_out);
+    
+    // The list stays fully usable after relinking
+    int val;
+    assert(slist_get(list, 999, &val) == 0 && val == out[999]);
+    assert(slist_pop_back(list, &val) == 0 && val == out[999]);
+    assert(slist_push_back(list, 1000) == 0);
+    assert(slist_get(list, 999, &val) == 0 && val == 1000);
+    
+    slist_destroy(list);
+    PASS();
+    return 0;
+}
+
+static int _last(const SinglyLinkedList *list) {
+    int val = 0;
+    slist_get(list, slist_size(list) - 1, &val);
+    return val;
+}
+
+int test_tail_tracking(void) {
+    TEST("appends after tail-changing operations");
+    
+    SinglyLinkedList *list = slist_create();
+    int val;
+    
+    slist_push_front(list, 1);
+    assert(slist_push_back(list, 2) == 0 && _last(list) == 2);
+    
+    slist_reverse(list);
+    assert(slist_push_back(list, 3) == 0);
+    assert(slist_get(list, 0, &val) == 0 && val == 2 && _last(list) == 3);
+    
+    assert(slist_remove_at(list, 2, &val) == 0 && val == 3);
+    assert(slist_push_back(list, 4) == 0 && _last(list) == 4);
+    
+    assert(slist_insert_after(list, 2, 5) == 0);
+    assert(slist_push_back(list, 6) == 0 && _last(list) == 6);
+    
+    assert(slist_pop_back(list, &val) == 0 && val == 6);
+    assert(slist_pop_back(list, &val) == 0 && val == 5);
+    assert(slist_push_back(list, 7) == 0 && _last(list) == 7);
+    
+    slist_sort(list);
+    assert(slist_push_back(list, 0) == 0 && _last(list) == 0);
+    
+    while (!slist_is_empty(list)) {
+        slist_pop_front(list, &val);
+    }
+    assert(slist_push_back(list, 8) == 0);
+    assert(slist_size(list) == 1 && _last(list) == 8);
+    assert(slist_pop_back(list, &val) == 0 && val == 8);
+    assert(slist_is_empty(list) == 1);
+    
+    slist_clear(list);
+    assert(slist_push_back(list, 9) == 0 && _last(list) == 9);
+    slist_destroy(list);
+    
+    int values[] = {1, 2, 3};
+    list = slist_from_array(values, 3);
+    assert(slist_push_back(list, 4) == 0 && _last(list) == 4);
+    assert(slist_size(list) == 4);
+    slist_destroy(list);
+    
+    PASS();
+    return 0;
+}
+
 int main(void) {
     printf("=== Running Singly Linked List Tests ===\n\n");
     
@@ -302,6 +523,10 @@ int main(void) {
     failed += test_clear();
     failed += test_reverse();
     failed += test_error_handling();
+    failed += test_indexed_access_after_mutation();
+    failed += test_from_to_array();
+    failed += test_sort();
+    failed += test_tail_tracking();
     
     printf("\n");
     if (failed == 0) {
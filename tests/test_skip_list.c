@@ -0,0 +1,191 @@
+#include <stdio.h>
+#include <assert.h>
+#include <stdlib.h>
+#include "../include/skip_list.h"
+
+#define TEST(name) printf("Testing %s... ", name)
+#define PASS() printf("✓ PASS\n")
+
+#define KEY_SPACE 2000
+
+int test_create_destroy(void) {
+    TEST("create and destroy");
+    
+    SkipList *list = skiplist_create();
+    assert(list != NULL);
+    assert(skiplist_size(list) == 0);
+    assert(skiplist_is_empty(list) == 1);
+    
+    int key, val;
+    assert(skiplist_min(list, &key, &val) == -1);
+    assert(skiplist_max(list, &key, &val) == -1);
+    assert(skiplist_find(list, 1, &val) == -1);
+    assert(skiplist_erase(list, 1, NULL) == -1);
+    skiplist_destroy(list);
+    skiplist_destroy(NULL);
+    
+    assert(skiplist_size(NULL) == 0);
+    assert(skiplist_is_empty(NULL) == 1);
+    assert(skiplist_insert(NULL, 1, 1) == -1);
+    assert(skiplist_contains(NULL, 1) == 0);
+    
+    PASS();
+    return 0;
+}
+
+int test_insert_find_erase(void) {
+    TEST("insert, find and erase");
+    
+    SkipList *list = skiplist_create();
+    int keys[] = {50, 10, 40, 20, 30, -5};
+    for (int i = 0; i < 6; i++) {
+        assert(skiplist_insert(list, keys[i], keys[i] * 2) == 0);
+    }
+    assert(skiplist_size(list) == 6);
+    
+    int key, val;
+    assert(skiplist_find(list, 40, &val) == 0 && val == 80);
+    assert(skiplist_contains(list, -5) == 1);
+    assert(skiplist_contains(list, 25) == 0);
+    assert(skiplist_min(list, &key, &val) == 0 && key == -5 && val == -10);
+    assert(skiplist_max(list, &key, NULL) == 0 && key == 50);
+    
+    // Inserting an existing key overwrites its value
+    assert(skiplist_insert(list, 20, 7) == 0);
+    assert(skiplist_size(list) == 6);
+    assert(skiplist_find(list, 20, &val) == 0 && val == 7);
+    
+    assert(skiplist_erase(list, 20, &val) == 0 && val == 7);
+    assert(skiplist_erase(list, 20, NULL) == -1);
+    assert(skiplist_contains(list, 20) == 0);
+    assert(skiplist_size(list) == 5);
+    
+    assert(skiplist_erase(list, 50, NULL) == 0);
+    assert(skiplist_max(list, &key, NULL) == 0 && key == 40);
+    
+    skiplist_clear(list);
+    assert(skiplist_is_empty(list) == 1);
+    assert(skiplist_insert(list, 3, 3) == 0);
+    assert(skiplist_find(list, 3, &val) == 0 && val == 3);
+    
+    skiplist_destroy(list);
+    PASS();
+    return 0;
+}
+
+int test_range(void) {
+    TEST("range scans");
+    
+    SkipList *list = skiplist_create();
+    for (int i = 0; i < 100; i += 3) {
+        skiplist_insert(list, i, -i);
+    }
+    
+    SkipListRange range;
+    int key, val;
+    int expected = 12;
+    assert(skiplist_range_init(list, 10, 30, &range) == 0);
+    while (skiplist_range_next(&range, &key, &val) == 0) {
+        assert(key == expected && val == -expected);
+        expected += 3;
+    }
+    assert(expected == 33);
+    
+    // Empty and inverted ranges yield nothing
+    assert(skiplist_range_init(list, 13, 14, &range) == 0);
+    assert(skiplist_range_next(&range, &key, NULL) == -1);
+    assert(skiplist_range_init(list, 30, 10, &range) == 0);
+    assert(skiplist_range_next(&range, &key, NULL) == -1);
+    assert(skiplist_range_init(list, 200, 300, &range) == 0);
+    assert(skiplist_range_next(&range, &key, NULL) == -1);
+    assert(skiplist_range_init(NULL, 0, 1, &range) == -1);
+    
+    // Container iterator walks every key in order
+    ContainerIter it;
+    const int *span;
+    size_t n;
+    expected = 0;
+    assert(skiplist_iter_init(list, &it) == 0);
+    while ((n = container_iter_next(&it, &span)) > 0) {
+        assert(n == 1 && span[0] == expected);
+        expected += 3;
+    }
+    assert(expected == 102);
+    
+    skiplist_destroy(list);
+    PASS();
+    return 0;
+}
+
+int test_matches_reference(void) {
+    TEST("random operations match a presence table");
+    
+    SkipList *list = skiplist_create_seeded(42);
+    int present[KEY_SPACE] = {0};
+    int values[KEY_SPACE] = {0};
+    size_t count = 0;
+    srand(7);
+    
+    for (int step = 0; step < 20000; step++) {
+        int key = rand() % KEY_SPACE;
+        int op = rand() % 3;
+        if (op < 2) {
+            int value = rand();
+            assert(skiplist_insert(list, key, value) == 0);
+            count += !present[key];
+            present[key] = 1;
+            values[key] = value;
+        } else {
+            int val;
+            int rc = skiplist_erase(list, key, &val);
+            assert(rc == (present[key] ? 0 : -1));
+            if (rc == 0) {
+                assert(val == values[key]);
+                present[key] = 0;
+                count--;
+            }
+        }
+    }
+    assert(skiplist_size(list) == count);
+    
+    // Ordered walk visits exactly the present keys
+    SkipListRange range;
+    int key, val;
+    int prev = -1;
+    size_t seen = 0;
+    skiplist_range_init(list, 0, KEY_SPACE, &range);
+    while (skiplist_range_next(&range, &key, &val) == 0) {
+        assert(key > prev && present[key] && val == values[key]);
+        prev = key;
+        seen++;
+    }
+    assert(seen == count);
+    
+    for (int k = 0; k < KEY_SPACE; k++) {
+        assert(skiplist_contains(list, k) == present[k]);
+    }
+    
+    skiplist_destroy(list);
+    PASS();
+    return 0;
+}
+
+int main(void) {
+    printf("=== Running Skip List Tests ===\n\n");
+    
+    int failed = 0;
+    
+    failed += test_create_destroy();
+    failed += test_insert_find_erase();
+    failed += test_range();
+    failed += test_matches_reference();
+    
+    printf("\n");
+    if (failed == 0) {
+        printf("✓ All tests passed!\n");
+    } else {
+        printf("✗ %d test(s) failed\n", failed);
+    }
+    
+    return failed;
+}
@@ -178,6 +178,124 @@ int test_error_handling(void) {
     return 0;
 }
 
+int test_growth_policy(void) {
+    TEST("growth policy");
+    
+    Stack *stack = stack_create_with_capacity(4);
+    GrowthPolicy policy = growth_policy_default();
+    policy.kind = GROWTH_FIXED;
+    policy.increment = 3;
+    assert(stack_set_growth_policy(stack, policy) == 0);
+    
+    for (int i = 0; i < 8; i++) {
+        stack_push(stack, i);
+    }
+    assert(stack_capacity(stack) == 10);
+    
+    int val;
+    stack_peek(stack, &val);
+    assert(val == 7);
+    
+    policy.kind = GROWTH_PAGE_ALIGNED;
+    assert(stack_set_growth_policy(stack, policy) == 0);
+    for (int i = 8; i < 11; i++) {
+        stack_push(stack, i);
+    }
+    assert(stack_capacity(stack) * sizeof(int) % growth_page_size() == 0);
+    
+    stack_destroy(stack);
+    PASS();
+    return 0;
+}
+
+int test_inline_storage(void) {
+    TEST("inline storage and stack_init");
+    
+    Stack *stack = stack_create_with_capacity(4);
+    for (int i = 0; i < STACK_INLINE_CAPACITY; i++) {
+        assert(stack_push(stack, i) == 0);
+    }
+    assert(stack_capacity(stack) == STACK_INLINE_CAPACITY);
+    assert(stack_push(stack, 100) == 0);
+    assert(stack_capacity(stack) == 2 * STACK_INLINE_CAPACITY);
+    
+    int val;
+    assert(stack_pop(stack, &val) == 0 && val == 100);
+    assert(stack_pop(stack, &val) == 0 && val == STACK_INLINE_CAPACITY - 1);
+    stack_destroy(stack);
+    
+    assert(stack_init(NULL, 0) == NULL);
+    
+    StackStorage storage;
+    stack = stack_init(&storage, 0);
+    assert(stack != NULL);
+    assert((void*)stack == (void*)&storage);
+    for (int i = 0; i < 50; i++) {
+        assert(stack_push(stack, i) == 0);
+    }
+    assert(stack_size(stack) == 50);
+    assert(stack_peek(stack, &val) == 0 && val == 49);
+    stack_destroy(stack);
+    
+    PASS();
+    return 0;
+}
+
+int test_bulk_operations(void) {
+    TEST("bulk push/pop/peek and reserve");
+    
+    Stack *stack = stack_create_with_capacity(2);
+    assert(stack_reserve(stack, 100) == 0);
+    assert(stack_capacity(stack) == 100);
+    assert(stack_reserve(stack, 10) == 0);
+    assert(stack_capacity(stack) == 100);
+    assert(stack_reserve(NULL, 10) == -1);
+    
+    int values[40];
+    for (int i = 0; i < 40; i++) {
+        values[i] = i;
+    }
+    assert(stack_push_n(stack, values, 40) == 0);
+    assert(stack_push_n(stack, NULL, 0) == 0);
+    assert(stack_push_n(stack, NULL, 3) == -1);
+    assert(stack_size(stack) == 40);
+    
+    int top;
+    assert(stack_peek(stack, &top) == 0 && top == 39);
+    
+    int out[10];
+    assert(stack_peek_n(stack, out, 3) == 0);
+    assert(out[0] == 37 && out[1] == 38 && out[2] == 39);
+    assert(stack_size(stack) == 40);
+    
+    assert(stack_pop_n(stack, out, 10) == 0);
+    for (int i = 0; i < 10; i++) {
+        assert(out[i] == 30 + i);
+    }
+    assert(stack_size(stack) == 30);
+    
+    // All or nothing
+    int big[64];
+    assert(stack_pop_n(stack, big, 31) == -1);
+    assert(stack_peek_n(stack, big, 31) == -1);
+    assert(stack_size(stack) == 30);
+    assert(stack_pop_n(stack, big, 30) == 0);
+    assert(stack_is_empty(stack) == 1);
+    assert(stack_pop_n(stack, big, 0) == 0);
+    
+    // Bulk push grows past the reserved capacity
+    for (int round = 0; round < 5; round++) {
+        assert(stack_push_n(stack, values, 40) == 0);
+    }
+    assert(stack_size(stack) == 200);
+    assert(stack_capacity(stack) >= 200);
+    assert(stack_peek(stack, &top) == 0 && top == 39);
+    
+    stack_destroy(stack);
+    PASS();
+    return 0;
+}
+
 int main(void) {
     printf("=== Running Stack Tests ===\n\n");
     
@@ -191,6 +309,9 @@ int main(void) {
     failed += test_clear();
     failed += test_peek_after_push();
     failed += test_error_handling();
+    failed += test_growth_policy();
+    failed += test_inline_storage();
+    failed += test_bulk_operations();
     
     printf("\n");
     if (failed == 0) {
@@ -0,0 +1,229 @@
+#include <stdio.h>
+#include <assert.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "../include/timer_wheel.h"
+
+#define TEST(name) printf("Testing %s... ", name)
+#define PASS() printf("✓ PASS\n")
+
+#define NUM_TIMERS 2000
+
+typedef struct {
+    int id;
+    uint64_t fired_at;
+    int fire_count;
+    TimerWheel *wheel;
+    Timer timer;
+} Job;
+
+static void _record(Timer *timer, void *ctx) {
+    Job *job = ctx;
+    assert(timer == &job->timer);
+    job->fired_at = twheel_now(job->wheel);
+    job->fire_count++;
+}
+
+static void _periodic(Timer *timer, void *ctx) {
+    Job *job = ctx;
+    job->fire_count++;
+    twheel_schedule(job->wheel, timer, 10);
+}
+
+static void _job_init(Job *job, int id, TimerWheel *wheel, TimerCallback cb) {
+    job->id = id;
+    job->fired_at = 0;
+    job->fire_count = 0;
+    job->wheel = wheel;
+    twheel_timer_init(&job->timer, cb, job);
+}
+
+int test_create_destroy(void) {
+    TEST("create and destroy");
+    
+    TimerWheel *wheel = twheel_create(100);
+    assert(wheel != NULL);
+    assert(twheel_now(wheel) == 100);
+    assert(twheel_size(wheel) == 0);
+    
+    // An empty wheel just moves its clock
+    assert(twheel_advance(wheel, 1000000) == 0);
+    assert(twheel_now(wheel) == 1000100);
+    twheel_destroy(wheel);
+    twheel_destroy(NULL);
+    
+    Timer t;
+    twheel_timer_init(&t, NULL, NULL);
+    assert(twheel_is_pending(&t) == 0);
+    assert(twheel_schedule(NULL, &t, 1) == -1);
+    assert(twheel_cancel(NULL, &t) == -1);
+    assert(twheel_size(NULL) == 0);
+    
+    PASS();
+    return 0;
+}
+
+int test_fire_and_cancel(void) {
+    TEST("fire, cancel and reschedule");
+    
+    TimerWheel *wheel = twheel_create(0);
+    Job jobs[4];
+    for (int i = 0; i < 4; i++) {
+        _job_init(&jobs[i], i, wheel, _record);
+    }
+    
+    assert(twheel_schedule(wheel, &jobs[0].timer, 5) == 0);
+    assert(twheel_schedule(wheel, &jobs[1].timer, 70) == 0);
+    assert(twheel_schedule(wheel, &jobs[2].timer, 5000) == 0);
+    assert(twheel_schedule(wheel, &jobs[3].timer, 0) == 0);
+    assert(twheel_size(wheel) == 4);
+    assert(twheel_is_pending(&jobs[2].timer) == 1);
+    
+    assert(twheel_advance(wheel, 1) == 1);
+    assert(jobs[3].fire_count == 1 && jobs[3].fired_at == 1);
+    assert(twheel_cancel(wheel, &jobs[3].timer) == -1);
+    
+    assert(twheel_cancel(wheel, &jobs[0].timer) == 0);
+    assert(twheel_is_pending(&jobs[0].timer) == 0);
+    
+    // Rescheduling a pending timer moves it
+    assert(twheel_schedule(wheel, &jobs[1].timer, 200) == 0);
+    assert(twheel_size(wheel) == 2);
+    
+    assert(twheel_advance(wheel, 199) == 0);
+    assert(twheel_advance(wheel, 1) == 1);
+    assert(jobs[1].fired_at == 201);
+    assert(twheel_advance(wheel, 5000) == 1);
+    assert(jobs[2].fired_at == 5000);
+    assert(jobs[0].fire_count == 0);
+    assert(twheel_size(wheel) == 0);
+    
+    twheel_destroy(wheel);
+    PASS();
+    return 0;
+}
+
+int test_long_delays(void) {
+    TEST("deadlines across levels");
+    
+    // Odd start so deadlines straddle slot boundaries on every level
+    TimerWheel *wheel = twheel_create(123456789);
+    uint64_t delays[] = {1, 63, 64, 65, 4095, 4096, 4097, 262143,
+                         262144, 300001, (1u << 22) + 17};
+    Job jobs[11];
+    for (int i = 0; i < 11; i++) {
+        _job_init(&jobs[i], i, wheel, _record);
+        assert(twheel_schedule(wheel, &jobs[i].timer, delays[i]) == 0);
+    }
+    
+    assert(twheel_advance(wheel, (1u << 22) + 100) == 11);
+    for (int i = 0; i < 11; i++) {
+        assert(jobs[i].fire_count == 1);
+        assert(jobs[i].fired_at == 123456789 + delays[i]);
+    }
+    
+    // Beyond the wheel's span a timer still arms and cancels
+    Job far;
+    _job_init(&far, 99, wheel, _record);
+    assert(twheel_schedule(wheel, &far.timer, (uint64_t)1 << 40) == 0);
+    assert(twheel_schedule(wheel, &far.timer, UINT64_MAX) == -1);
+    assert(twheel_cancel(wheel, &far.timer) == 0);
+    
+    twheel_destroy(wheel);
+    PASS();
+    return 0;
+}
+
+int test_periodic(void) {
+    TEST("callbacks that reschedule");
+    
+    TimerWheel *wheel = twheel_create(0);
+    Job job;
+    _job_init(&job, 0, wheel, _periodic);
+    twheel_schedule(wheel, &job.timer, 10);
+    
+    assert(twheel_advance(wheel, 1000) == 100);
+    assert(job.fire_count == 100);
+    assert(twheel_is_pending(&job.timer) == 1);
+    
+    twheel_destroy(wheel);
+    PASS();
+    return 0;
+}
+
+int test_matches_reference(void) {
+    TEST("random schedule/cancel against deadlines");
+    
+    TimerWheel *wheel = twheel_create(777);
+    Job *jobs = malloc(NUM_TIMERS * sizeof(Job));
+    uint64_t *deadline = calloc(NUM_TIMERS, sizeof(uint64_t));
+    for (int i = 0; i < NUM_TIMERS; i++) {
+        _job_init(&jobs[i], i, wheel, _record);
+    }
+    
+    srand(2024);
+    for (int round = 0; round < 3000; round++) {
+        for (int op = 0; op < 5; op++) {
+            int i = rand() % NUM_TIMERS;
+            if (deadline[i] && rand() % 3 == 0) {
+                assert(twheel_cancel(wheel, &jobs[i].timer) == 0);
+                deadline[i] = 0;
+            } else {
+                uint64_t delay = 1 + (uint64_t)(rand() % 20000);
+                assert(twheel_schedule(wheel, &jobs[i].timer, delay) == 0);
+                deadline[i] = twheel_now(wheel) + delay;
+            }
+        }
+        
+        uint64_t step = (uint64_t)(rand() % 50);
+        uint64_t before = twheel_now(wheel);
+        int fired_before[NUM_TIMERS];
+        for (int i = 0; i < NUM_TIMERS; i++) {
+            fired_before[i] = jobs[i].fire_count;
+        }
+        
+        size_t expected = 0;
+        for (int i = 0; i < NUM_TIMERS; i++) {
+            expected += deadline[i] && deadline[i] <= before + step;
+        }
+        assert(twheel_advance(wheel, step) == expected);
+        
+        for (int i = 0; i < NUM_TIMERS; i++) {
+            if (deadline[i] && deadline[i] <= before + step) {
+                assert(jobs[i].fire_count == fired_before[i] + 1);
+                assert(jobs[i].fired_at == deadline[i]);
+                deadline[i] = 0;
+            } else {
+                assert(jobs[i].fire_count == fired_before[i]);
+            }
+            assert(twheel_is_pending(&jobs[i].timer) == (deadline[i] != 0));
+        }
+    }
+    
+    free(jobs);
+    free(deadline);
+    twheel_destroy(wheel);
+    PASS();
+    return 0;
+}
+
+int main(void) {
+    printf("=== Running Timer Wheel Tests ===\n\n");
+    
+    int failed = 0;
+    
+    failed += test_create_destroy();
+    failed += test_fire_and_cancel();
+    failed += test_long_delays();
+    failed += test_periodic();
+    failed += test_matches_reference();
+    
+    printf("\n");
+    if (failed == 0) {
+        printf("✓ All tests passed!\n");
+    } else {
+        printf("✗ %d test(s) failed\n", failed);
+    }
+    
+    return failed;
+}
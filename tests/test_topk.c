@@ -0,0 +1,144 @@
+#include <stdio.h>
+#include <assert.h>
+#include <stdlib.h>
+#include <limits.h>
+#include "../include/topk.h"
+
+#define TEST(name) printf("Testing %s... ", name)
+#define PASS() printf("✓ PASS\n")
+
+static int _cmp_desc(const void *a, const void *b) {
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x < y) - (x > y);
+}
+
+static int _cmp_asc(const void *a, const void *b) {
+    return -_cmp_desc(a, b);
+}
+
+int test_create_destroy(void) {
+    TEST("create and destroy");
+    
+    TopK *tk = topk_create(3, PQUEUE_MAX);
+    assert(tk != NULL);
+    assert(topk_k(tk) == 3);
+    assert(topk_size(tk) == 0);
+    
+    int val;
+    assert(topk_threshold(tk, &val) == -1);
+    topk_destroy(tk);
+    topk_destroy(NULL);
+    
+    assert(topk_create(0, PQUEUE_MAX) == NULL);
+    assert(topk_create(3, (PQueueOrder)9) == NULL);
+    assert(topk_offer(NULL, 1) == -1);
+    assert(topk_offer_n(NULL, &val, 1) == 0);
+    assert(topk_size(NULL) == 0);
+    
+    PASS();
+    return 0;
+}
+
+int test_offer(void) {
+    TEST("offer and threshold");
+    
+    TopK *tk = topk_create(3, PQUEUE_MAX);
+    assert(topk_offer(tk, 5) == 1);
+    assert(topk_offer(tk, INT_MIN) == 1);
+    assert(topk_offer(tk, 9) == 1);
+    
+    int val;
+    assert(topk_threshold(tk, &val) == 0 && val == INT_MIN);
+    assert(topk_offer(tk, 7) == 1);
+    assert(topk_threshold(tk, &val) == 0 && val == 5);
+    assert(topk_offer(tk, 5) == 0);
+    assert(topk_offer(tk, 1) == 0);
+    assert(topk_offer(tk, INT_MAX) == 1);
+    assert(topk_size(tk) == 3);
+    
+    int out[3];
+    assert(topk_result(tk, out) == 3);
+    assert(out[0] == INT_MAX && out[1] == 9 && out[2] == 7);
+    
+    // Reading the result leaves the selector intact
+    assert(topk_offer(tk, 8) == 1);
+    assert(topk_result(tk, out) == 3);
+    assert(out[0] == INT_MAX && out[1] == 9 && out[2] == 8);
+    
+    topk_clear(tk);
+    assert(topk_size(tk) == 0);
+    assert(topk_threshold(tk, &val) == -1);
+    assert(topk_offer(tk, -1) == 1);
+    assert(topk_result(tk, out) == 1 && out[0] == -1);
+    topk_destroy(tk);
+    
+    PASS();
+    return 0;
+}
+
+int test_matches_sort(void) {
+    TEST("offer_n against a full sort");
+    
+    size_t n = 20011;
+    int *values = malloc(n * sizeof(int));
+    int *sorted = malloc(n * sizeof(int));
+    srand(99);
+    for (size_t i = 0; i < n; i++) {
+        values[i] = rand() % 100000 - 50000;
+        sorted[i] = values[i];
+    }
+    
+    size_t ks[] = {1, 7, 100, 20011, 30000};
+    for (int order = 0; order < 2; order++) {
+        qsort(sorted, n, sizeof(int), order ? _cmp_desc : _cmp_asc);
+        for (size_t c = 0; c < 5; c++) {
+            size_t k = ks[c];
+            TopK *tk = topk_create(k, order ? PQUEUE_MAX : PQUEUE_MIN);
+            
+            // Uneven chunks exercise the fill phase, blocks and tails
+            size_t pos = 0;
+            while (pos < n) {
+                size_t chunk = 1 + (size_t)rand() % 97;
+                if (chunk > n - pos) {
+                    chunk = n - pos;
+                }
+                topk_offer_n(tk, values + pos, chunk);
+                pos += chunk;
+            }
+            
+            size_t expected = k < n ? k : n;
+            int *out = malloc(expected * sizeof(int));
+            assert(topk_result(tk, out) == expected);
+            for (size_t i = 0; i < expected; i++) {
+                assert(out[i] == sorted[i]);
+            }
+            free(out);
+            topk_destroy(tk);
+        }
+    }
+    
+    free(values);
+    free(sorted);
+    PASS();
+    return 0;
+}
+
+int main(void) {
+    printf("=== Running Top-K Tests ===\n\n");
+    
+    int failed = 0;
+    
+    failed += test_create_destroy();
+    failed += test_offer();
+    failed += test_matches_sort();
+    
+    printf("\n");
+    if (failed == 0) {
+        printf("✓ All tests passed!\n");
+    } else {
+        printf("✗ %d test(s) failed\n", failed);
+    }
+    
+    return failed;
+}
@@ -0,0 +1,185 @@
+#include <stdio.h>
+#include <assert.h>
+#include <stdlib.h>
+#include "../include/unrolled_list.h"
+#include "../include/array.h"
+
+#define TEST(name) printf("Testing %s... ", name)
+#define PASS() printf("✓ PASS\n")
+
+static void _assert_matches(const UnrolledList *list, const DynamicArray *ref) {
+    assert(ulist_size(list) == array_size(ref));
+    
+    ContainerIter it;
+    const int *span;
+    size_t n;
+    size_t index = 0;
+    ulist_iter_init(list, &it);
+    while ((n = container_iter_next(&it, &span)) > 0) {
+        for (size_t i = 0; i < n; i++) {
+            int expected;
+            array_get(ref, index++, &expected);
+            assert(span[i] == expected);
+        }
+    }
+    assert(index == array_size(ref));
+}
+
+int test_create_destroy(void) {
+    TEST("create and destroy");
+    
+    UnrolledList *list = ulist_create();
+    assert(list != NULL);
+    assert(ulist_size(list) == 0);
+    assert(ulist_is_empty(list) == 1);
+    assert(ulist_node_count(list) == 0);
+    ulist_destroy(list);
+    ulist_destroy(NULL);
+    
+    assert(ulist_size(NULL) == 0);
+    assert(ulist_is_empty(NULL) == 1);
+    
+    PASS();
+    return 0;
+}
+
+int test_push_pop(void) {
+    TEST("push/pop both ends");
+    
+    UnrolledList *list = ulist_create();
+    for (int i = 0; i < 100; i++) {
+        assert(ulist_push_back(list, i) == 0);
+    }
+    assert(ulist_size(list) == 100);
+    // push_back fills nodes completely
+    assert(ulist_node_count(list) == (100 + 12) / 13);
+    
+    for (int i = 1; i <= 20; i++) {
+        assert(ulist_push_front(list, -i) == 0);
+    }
+    
+    int val;
+    assert(ulist_get(list, 0, &val) == 0 && val == -20);
+    assert(ulist_get(list, 119, &val) == 0 && val == 99);
+    
+    assert(ulist_pop_front(list, &val) == 0 && val == -20);
+    assert(ulist_pop_back(list, &val) == 0 && val == 99);
+    assert(ulist_pop_back(list, &val) == 0 && val == 98);
+    assert(ulist_size(list) == 117);
+    
+    while (ulist_pop_front(list, &val) == 0) {
+    }
+    assert(ulist_is_empty(list) == 1);
+    assert(ulist_node_count(list) == 0);
+    assert(ulist_pop_back(list, &val) == -1);
+    
+    ulist_destroy(list);
+    PASS();
+    return 0;
+}
+
+int test_indexed_operations(void) {
+    TEST("insert/remove/get/set by index");
+    
+    UnrolledList *list = ulist_create();
+    assert(ulist_insert_at(list, 1, 5) == -1);
+    assert(ulist_insert_after(list, 0, 5) == -1);
+    assert(ulist_insert_at(list, 0, 1) == 0);
+    assert(ulist_insert_after(list, 0, 3) == 0);
+    assert(ulist_insert_at(list, 1, 2) == 0);
+    
+    int val;
+    for (int i = 0; i < 3; i++) {
+        assert(ulist_get(list, (size_t)i, &val) == 0 && val == i + 1);
+    }
+    assert(ulist_get(list, 3, &val) == -1);
+    assert(ulist_set(list, 1, 20) == 0);
+    assert(ulist_get(list, 1, &val) == 0 && val == 20);
+    assert(ulist_set(list, 3, 0) == -1);
+    assert(ulist_find(list, 20) == 1);
+    assert(ulist_find(list, 2) == -1);
+    
+    assert(ulist_remove_at(list, 1, &val) == 0 && val == 20);
+    assert(ulist_remove_at(list, 2, NULL) == -1);
+    assert(ulist_size(list) == 2);
+    
+    ulist_destroy(list);
+    PASS();
+    return 0;
+}
+
+int test_matches_dynamic_array(void) {
+    TEST("random edits match DynamicArray");
+    
+    UnrolledList *list = ulist_create();
+    DynamicArray *ref = array_create(16);
+    srand(11);
+    
+    for (int step = 0; step < 20000; step++) {
+        size_t size = array_size(ref);
+        int op = rand() % 5;
+        if (op < 2 || size == 0) {
+            size_t idx = (size_t)rand() % (size + 1);
+            assert(ulist_insert_at(list, idx, step) == 0);
+            array_insert(ref, idx, step);
+        } else if (op < 4) {
+            size_t idx = (size_t)rand() % size;
+            int a, b;
+            assert(ulist_remove_at(list, idx, &a) == 0);
+            array_remove(ref, idx, &b);
+            assert(a == b);
+        } else {
+            size_t idx = (size_t)rand() % size;
+            int a, b;
+            assert(ulist_get(list, idx, &a) == 0);
+            array_get(ref, idx, &b);
+            assert(a == b);
+        }
+    }
+    _assert_matches(list, ref);
+    
+    // Removals merge nodes: they stay at least roughly half full
+    assert(ulist_node_count(list) <= array_size(ref) / 3 + 2);
+    
+    ulist_reverse(list);
+    size_t n = array_size(ref);
+    for (size_t i = 0; i < n / 2; i++) {
+        int a, b;
+        array_get(ref, i, &a);
+        array_get(ref, n - 1 - i, &b);
+        array_set(ref, i, b);
+        array_set(ref, n - 1 - i, a);
+    }
+    _assert_matches(list, ref);
+    assert(ulist_push_back(list, 12345) == 0);
+    int val;
+    assert(ulist_get(list, n, &val) == 0 && val == 12345);
+    
+    ulist_clear(list);
+    assert(ulist_is_empty(list) == 1);
+    
+    array_destroy(ref);
+    ulist_destroy(list);
+    PASS();
+    return 0;
+}
+
+int main(void) {
+    printf("=== Running Unrolled List Tests ===\n\n");
+    
+    int failed = 0;
+    
+    failed += test_create_destroy();
+    failed += test_push_pop();
+    failed += test_indexed_operations();
+    failed += test_matches_dynamic_array();
+    
+    printf("\n");
+    if (failed == 0) {
+        printf("✓ All tests passed!\n");
+    } else {
+        printf("✗ %d test(s) failed\n", failed);
+    }
+    
+    return failed;
+}